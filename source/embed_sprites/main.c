@@ -0,0 +1,273 @@
+﻿//***************************************************************************
+// 
+// 파일: main.c
+// 
+// 설명: DDS 스프라이트를 C 배열로 변환하는 빌드 도구
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 사용법: embed_sprites <out.c> <name>=<file.dds> [<name>=<file.dds> ...]
+// 
+// A8R8G8B8 DDS의 픽셀을 16바이트 정렬된 const uint32_t 배열로 출력하고
+// const embedded_sprite_t g_embedded_<name>_sprite를 정의함
+// 출력 내용이 기존 파일과 같으면 파일을 건드리지 않음 (불필요한 재컴파일 방지)
+// 
+//***************************************************************************
+
+#ifndef _CRT_SECURE_NO_WARNINGS
+#define _CRT_SECURE_NO_WARNINGS
+#endif // _CRT_SECURE_NO_WARNINGS
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define DDS_MAGIC 0x20534444 // "DDS "
+#define DDS_FILE_HEADER_SIZE 128
+#define DDS_HEADER_SIZE 124
+
+#define DDPF_ALPHAPIXELS 0x1
+#define DDPF_FOURCC 0x4
+#define DDPF_RGB 0x40
+
+#define NUM_MAX_NAME_LENGTH 64
+#define NUM_PIXELS_PER_LINE 8
+
+typedef struct output_buffer
+{
+    char* pa_data;
+    size_t length;
+    size_t capacity;
+} output_buffer_t;
+
+static bool append(output_buffer_t* p_buffer, const char* format, ...);
+static bool embed_sprite(output_buffer_t* p_buffer, const char* name, const char* filename);
+static char* read_file_or_null(const char* filename, size_t* p_out_size);
+static uint32_t read_u32(const char* p);
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <out.c> <name>=<file.dds> [<name>=<file.dds> ...]\n", argv[0]);
+        return 1;
+    }
+
+    output_buffer_t buffer;
+    memset(&buffer, 0, sizeof(output_buffer_t));
+
+    // MSVC가 한글 주석을 UTF-8로 읽도록 BOM 추가
+    append(&buffer, "\xef\xbb\xbf");
+    append(&buffer, "//***************************************************************************\n");
+    append(&buffer, "// \n");
+    append(&buffer, "// 파일: embedded_sprites.c\n");
+    append(&buffer, "// \n");
+    append(&buffer, "// 설명: 실행 파일에 포함되는 스프라이트 픽셀\n");
+    append(&buffer, "// \n");
+    append(&buffer, "// embed_sprites가 빌드 전에 생성하는 파일이므로 직접 수정하지 말 것\n");
+    append(&buffer, "// \n");
+    append(&buffer, "//***************************************************************************\n");
+    append(&buffer, "\n");
+    append(&buffer, "#include \"precompiled.h\"\n");
+    append(&buffer, "#include \"embedded_sprites.h\"\n");
+
+    for (int i = 2; i < argc; ++i)
+    {
+        const char* p_separator = strchr(argv[i], '=');
+        if (p_separator == NULL || p_separator == argv[i] || p_separator - argv[i] >= NUM_MAX_NAME_LENGTH)
+        {
+            fprintf(stderr, "invalid argument: %s\n", argv[i]);
+            free(buffer.pa_data);
+            return 1;
+        }
+
+        char name[NUM_MAX_NAME_LENGTH];
+        memcpy(name, argv[i], (size_t)(p_separator - argv[i]));
+        name[p_separator - argv[i]] = '\0';
+
+        if (!embed_sprite(&buffer, name, p_separator + 1))
+        {
+            free(buffer.pa_data);
+            return 1;
+        }
+    }
+
+    // 내용이 같으면 쓰지 않음
+    size_t old_size;
+    char* pa_old_data = read_file_or_null(argv[1], &old_size);
+    const bool b_unchanged = pa_old_data != NULL && old_size == buffer.length && memcmp(pa_old_data, buffer.pa_data, old_size) == 0;
+    free(pa_old_data);
+
+    if (!b_unchanged)
+    {
+        FILE* p_file = fopen(argv[1], "wb");
+        if (p_file == NULL || fwrite(buffer.pa_data, 1, buffer.length, p_file) != buffer.length)
+        {
+            fprintf(stderr, "Failed to write %s\n", argv[1]);
+            if (p_file != NULL)
+            {
+                fclose(p_file);
+            }
+            free(buffer.pa_data);
+            return 1;
+        }
+
+        fclose(p_file);
+    }
+
+    free(buffer.pa_data);
+
+    return 0;
+}
+
+static bool append(output_buffer_t* p_buffer, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    const int length = vsnprintf(NULL, 0, format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        return false;
+    }
+
+    if (p_buffer->length + (size_t)length + 1 > p_buffer->capacity)
+    {
+        size_t new_capacity = (p_buffer->capacity == 0) ? 4096 : p_buffer->capacity * 2;
+        while (p_buffer->length + (size_t)length + 1 > new_capacity)
+        {
+            new_capacity *= 2;
+        }
+
+        char* pa_new_data = (char*)realloc(p_buffer->pa_data, new_capacity);
+        if (pa_new_data == NULL)
+        {
+            return false;
+        }
+
+        p_buffer->pa_data = pa_new_data;
+        p_buffer->capacity = new_capacity;
+    }
+
+    va_start(args, format);
+    vsnprintf(p_buffer->pa_data + p_buffer->length, (size_t)length + 1, format, args);
+    va_end(args);
+
+    p_buffer->length += (size_t)length;
+    return true;
+}
+
+static bool embed_sprite(output_buffer_t* p_buffer, const char* name, const char* filename)
+{
+    size_t file_size;
+    char* pa_data = read_file_or_null(filename, &file_size);
+    if (pa_data == NULL)
+    {
+        fprintf(stderr, "Failed to read %s\n", filename);
+        return false;
+    }
+
+    // 헤더 검증, 게임이 사용하는 A8R8G8B8만 지원
+    const char* p_pixel_format = pa_data + 76;
+    if (file_size < DDS_FILE_HEADER_SIZE
+        || read_u32(pa_data) != DDS_MAGIC
+        || read_u32(pa_data + 4) != DDS_HEADER_SIZE
+        || (read_u32(p_pixel_format + 4) & DDPF_FOURCC) != 0
+        || (read_u32(p_pixel_format + 4) & (DDPF_RGB | DDPF_ALPHAPIXELS)) != (DDPF_RGB | DDPF_ALPHAPIXELS)
+        || read_u32(p_pixel_format + 12) != 32
+        || read_u32(p_pixel_format + 16) != 0x00ff0000
+        || read_u32(p_pixel_format + 20) != 0x0000ff00
+        || read_u32(p_pixel_format + 24) != 0x000000ff
+        || read_u32(p_pixel_format + 28) != 0xff000000)
+    {
+        fprintf(stderr, "%s: not an A8R8G8B8 DDS file\n", filename);
+        free(pa_data);
+        return false;
+    }
+
+    const size_t height = read_u32(pa_data + 12);
+    const size_t width = read_u32(pa_data + 16);
+    const size_t num_pixels = width * height;
+    if (num_pixels == 0 || (file_size - DDS_FILE_HEADER_SIZE) / sizeof(uint32_t) < num_pixels)
+    {
+        fprintf(stderr, "%s: invalid size\n", filename);
+        free(pa_data);
+        return false;
+    }
+
+    // 경로 구분자가 플랫폼마다 달라도 같은 결과가 나오도록 파일 이름만 기록
+    const char* p_basename = filename;
+    for (const char* p = filename; *p != '\0'; ++p)
+    {
+        if (*p == '/' || *p == '\\')
+        {
+            p_basename = p + 1;
+        }
+    }
+
+    bool b_result = append(p_buffer, "\n// %s (%zux%zu)\n", p_basename, width, height);
+    b_result &= append(p_buffer, "ALIGN16 static const uint32_t s_%s_pixels[%zu] =\n{\n", name, num_pixels);
+
+    const char* p_pixels = pa_data + DDS_FILE_HEADER_SIZE;
+    for (size_t i = 0; i < num_pixels; ++i)
+    {
+        const bool b_line_start = (i % NUM_PIXELS_PER_LINE == 0);
+        const bool b_line_end = (i % NUM_PIXELS_PER_LINE == NUM_PIXELS_PER_LINE - 1) || (i == num_pixels - 1);
+
+        b_result &= append(p_buffer, "%s0x%08x%s%s",
+                           b_line_start ? "    " : "",
+                           read_u32(p_pixels + i * sizeof(uint32_t)),
+                           (i == num_pixels - 1) ? "" : ",",
+                           b_line_end ? "\n" : " ");
+    }
+
+    b_result &= append(p_buffer, "};\n\n");
+    b_result &= append(p_buffer, "const embedded_sprite_t g_embedded_%s_sprite = { %zu, %zu, s_%s_pixels };\n", name, width, height, name);
+
+    free(pa_data);
+
+    if (!b_result)
+    {
+        fprintf(stderr, "Failed to malloc output\n");
+    }
+
+    return b_result;
+}
+
+static char* read_file_or_null(const char* filename, size_t* p_out_size)
+{
+    FILE* p_file = fopen(filename, "rb");
+    if (p_file == NULL)
+    {
+        return NULL;
+    }
+
+    fseek(p_file, 0, SEEK_END);
+    const long file_size = ftell(p_file);
+    fseek(p_file, 0, SEEK_SET);
+
+    char* pa_data = (file_size > 0) ? (char*)malloc((size_t)file_size) : NULL;
+    if (pa_data != NULL && fread(pa_data, 1, (size_t)file_size, p_file) != (size_t)file_size)
+    {
+        free(pa_data);
+        pa_data = NULL;
+    }
+
+    fclose(p_file);
+
+    *p_out_size = (size_t)file_size;
+    return pa_data;
+}
+
+// DDS는 리틀 엔디안
+static uint32_t read_u32(const char* p)
+{
+    const uint8_t* p_bytes = (const uint8_t*)p;
+    return (uint32_t)p_bytes[0] | ((uint32_t)p_bytes[1] << 8) | ((uint32_t)p_bytes[2] << 16) | ((uint32_t)p_bytes[3] << 24);
+}
\ No newline at end of file
@@ -0,0 +1,208 @@
+﻿//***************************************************************************
+// 
+// 파일: asset_loader.c
+// 
+// 설명: 워커 스레드 텍스쳐 비동기 로더
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "asset_loader.h"
+#include "dds_texture.h"
+
+// 페이지마다 한 픽셀씩 읽음
+#define NUM_PIXELS_PER_PAGE (4096 / sizeof(uint32_t))
+
+static THREAD_FUNC(run_asset_worker);
+static void touch_texture(const i_texture_t* p_texture);
+
+bool asset_loader_init(asset_loader_t* p_loader, size_t num_threads)
+{
+    ASSERT(p_loader != NULL, "p_loader == NULL");
+
+    memset(p_loader, 0, sizeof(asset_loader_t));
+
+    if (num_threads == 0)
+    {
+        const size_t num_processors = get_num_processors();
+        num_threads = (num_processors > 1) ? num_processors - 1 : 1;
+    }
+    num_threads = MIN(num_threads, ASSET_LOADER_NUM_MAX_THREADS);
+
+    init_lock(&p_loader->lock);
+    init_cond(&p_loader->job_queued);
+    init_cond(&p_loader->job_done);
+    p_loader->b_initialized = true;
+
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        if (!create_thread(&p_loader->threads[i], run_asset_worker, p_loader))
+        {
+            ASSERT(false, "Failed to create thread");
+            goto failed_init;
+        }
+
+        ++p_loader->num_threads;
+    }
+
+    return true;
+
+failed_init:
+    asset_loader_shutdown(p_loader);
+    return false;
+}
+
+void asset_loader_shutdown(asset_loader_t* p_loader)
+{
+    ASSERT(p_loader != NULL, "p_loader == NULL");
+
+    if (!p_loader->b_initialized)
+    {
+        return;
+    }
+
+    enter_lock(&p_loader->lock);
+    p_loader->b_shutdown = true;
+    wake_all_cond(&p_loader->job_queued);
+    leave_lock(&p_loader->lock);
+
+    for (size_t i = 0; i < p_loader->num_threads; ++i)
+    {
+        join_thread(p_loader->threads[i]);
+    }
+
+    for (size_t i = 0; i < p_loader->num_jobs; ++i)
+    {
+        SAFE_RELEASE(p_loader->jobs[i].p_texture);
+    }
+
+    delete_cond(&p_loader->job_done);
+    delete_cond(&p_loader->job_queued);
+    delete_lock(&p_loader->lock);
+    memset(p_loader, 0, sizeof(asset_loader_t));
+}
+
+asset_handle_t asset_loader_load_texture_async(asset_loader_t* p_loader, const char* filename)
+{
+    ASSERT(p_loader != NULL, "p_loader == NULL");
+    ASSERT(filename != NULL, "filename == NULL");
+
+    enter_lock(&p_loader->lock);
+
+    if (p_loader->num_jobs >= ASSET_LOADER_NUM_MAX_JOBS)
+    {
+        leave_lock(&p_loader->lock);
+        ASSERT(false, "Too many asset jobs");
+        return ASSET_HANDLE_INVALID;
+    }
+
+    const asset_handle_t handle = (asset_handle_t)p_loader->num_jobs;
+    asset_job_t* p_job = &p_loader->jobs[handle];
+    snprintf(p_job->path, sizeof(p_job->path), "%s", filename);
+    p_job->state = ASSET_STATE_QUEUED;
+    p_job->p_texture = NULL;
+    ++p_loader->num_jobs;
+
+    wake_cond(&p_loader->job_queued);
+    leave_lock(&p_loader->lock);
+
+    return handle;
+}
+
+bool asset_loader_wait_texture(asset_loader_t* p_loader, const asset_handle_t handle, i_texture_t** pp_out_texture)
+{
+    ASSERT(p_loader != NULL, "p_loader == NULL");
+    ASSERT(pp_out_texture != NULL, "pp_out_texture == NULL");
+
+    enter_lock(&p_loader->lock);
+
+    if (handle < 0 || (size_t)handle >= p_loader->num_jobs)
+    {
+        leave_lock(&p_loader->lock);
+        ASSERT(false, "invalid handle");
+        return false;
+    }
+
+    asset_job_t* p_job = &p_loader->jobs[handle];
+    while (p_job->state == ASSET_STATE_QUEUED)
+    {
+        wait_cond(&p_loader->job_done, &p_loader->lock);
+    }
+
+    *pp_out_texture = p_job->p_texture;
+    p_job->p_texture = NULL;
+    const bool b_loaded = (p_job->state == ASSET_STATE_LOADED && *pp_out_texture != NULL);
+
+    leave_lock(&p_loader->lock);
+
+    return b_loaded;
+}
+
+bool asset_loader_is_ready(asset_loader_t* p_loader, const asset_handle_t handle)
+{
+    ASSERT(p_loader != NULL, "p_loader == NULL");
+
+    enter_lock(&p_loader->lock);
+    const bool b_ready = handle >= 0 && (size_t)handle < p_loader->num_jobs
+        && p_loader->jobs[handle].state != ASSET_STATE_QUEUED;
+    leave_lock(&p_loader->lock);
+
+    return b_ready;
+}
+
+static THREAD_FUNC(run_asset_worker)
+{
+    asset_loader_t* p_loader = (asset_loader_t*)p_param;
+
+    enter_lock(&p_loader->lock);
+
+    while (true)
+    {
+        while (!p_loader->b_shutdown && p_loader->next_job == p_loader->num_jobs)
+        {
+            wait_cond(&p_loader->job_queued, &p_loader->lock);
+        }
+
+        if (p_loader->b_shutdown)
+        {
+            break;
+        }
+
+        asset_job_t* p_job = &p_loader->jobs[p_loader->next_job++];
+
+        // 로드는 락 밖에서
+        leave_lock(&p_loader->lock);
+
+        i_texture_t* p_texture = NULL;
+        const bool b_loaded = load_mapped_dds_texture(p_job->path, &p_texture);
+        if (b_loaded)
+        {
+            touch_texture(p_texture);
+        }
+
+        enter_lock(&p_loader->lock);
+
+        p_job->p_texture = p_texture;
+        p_job->state = b_loaded ? ASSET_STATE_LOADED : ASSET_STATE_FAILED;
+        wake_all_cond(&p_loader->job_done);
+    }
+
+    leave_lock(&p_loader->lock);
+
+    return THREAD_RETURN;
+}
+
+static void touch_texture(const i_texture_t* p_texture)
+{
+    const volatile uint32_t* p_bitmap = (const volatile uint32_t*)p_texture->vtbl->get_bitmap(p_texture);
+    const size_t num_pixels = p_texture->vtbl->get_width(p_texture) * p_texture->vtbl->get_height(p_texture);
+
+    for (size_t i = 0; i < num_pixels; i += NUM_PIXELS_PER_PAGE)
+    {
+        (void)p_bitmap[i];
+    }
+}
\ No newline at end of file
@@ -0,0 +1,85 @@
+﻿//***************************************************************************
+// 
+// 파일: asset_loader.h
+// 
+// 설명: 워커 스레드 텍스쳐 비동기 로더
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// load_texture_async()는 작업을 큐에 넣고 핸들만 바로 반환
+// 워커가 load_mapped_dds_texture()로 로드한 뒤 모든 페이지를 한 번 읽어서
+// 매핑 페이지 폴트와 포맷 변환 비용을 워커에서 끝냄
+// 호출한 스레드는 wait_texture()에서 처음 텍스쳐가 필요할 때만 대기
+// 
+// safe99_file_system은 미리 빌드된 DLL이라 i_file_system_t에 함수를 추가할 수 없으므로
+// 게임 쪽 로더로 구현
+// 
+//***************************************************************************
+
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "safe99_common/defines.h"
+#include "platform.h"
+
+#define ASSET_LOADER_NUM_MAX_THREADS 4
+#define ASSET_LOADER_NUM_MAX_JOBS 16
+
+#define ASSET_HANDLE_INVALID (-1)
+
+typedef int asset_handle_t;
+
+typedef enum asset_state
+{
+    ASSET_STATE_QUEUED,
+    ASSET_STATE_LOADED,
+    ASSET_STATE_FAILED
+} asset_state_t;
+
+typedef struct asset_job
+{
+    char path[MAX_PATH];
+    asset_state_t state;
+
+    // wait_texture()로 가져가면 NULL
+    i_texture_t* p_texture;
+} asset_job_t;
+
+typedef struct asset_loader
+{
+    bool b_initialized;
+
+    thread_t threads[ASSET_LOADER_NUM_MAX_THREADS];
+    size_t num_threads;
+
+    // jobs, num_jobs, next_job, b_shutdown은 lock으로 보호
+    lock_t lock;
+    cond_t job_queued;
+    cond_t job_done;
+
+    asset_job_t jobs[ASSET_LOADER_NUM_MAX_JOBS];
+    size_t num_jobs;
+    size_t next_job;
+    bool b_shutdown;
+} asset_loader_t;
+
+START_EXTERN_C
+
+// num_threads가 0이면 코어 수 - 1 (최소 1)
+bool asset_loader_init(asset_loader_t* p_loader, size_t num_threads);
+
+// 아직 가져가지 않은 텍스쳐는 해제, 대기 중인 작업은 버림
+void asset_loader_shutdown(asset_loader_t* p_loader);
+
+asset_handle_t asset_loader_load_texture_async(asset_loader_t* p_loader, const char* filename);
+
+// 로드가 끝날 때까지 대기 후 텍스쳐 소유권을 넘김
+bool asset_loader_wait_texture(asset_loader_t* p_loader, const asset_handle_t handle, i_texture_t** pp_out_texture);
+
+bool asset_loader_is_ready(asset_loader_t* p_loader, const asset_handle_t handle);
+
+END_EXTERN_C
+
+#endif // ASSET_LOADER_H
\ No newline at end of file
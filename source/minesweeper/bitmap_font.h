@@ -0,0 +1,61 @@
+//***************************************************************************
+//
+// 파일: bitmap_font.h
+//
+// 설명: 오버레이 텍스트용 5x7 비트맵 폰트
+//
+// 작성자: bumpsgoodman
+//
+// 작성일: 2026/10/19
+//
+// 렌더러 DLL의 draw_text는 GDI를 거치므로 매 프레임 그리는 진단 텍스트는 이 폰트 사용
+// 초기화할 때 출력 가능한 ASCII (0x20 ~ 0x7e) 글리프를 scale배로 미리 래스터화해 둠
+// - 글리프 픽셀은 0xffffffff(글자)/0(빈칸) 마스크이므로 색은 AND 한 번으로 입힘
+// - 출력할 수 없는 문자는 '?'
+// 문자열 단위 캐시는 text_cache.h
+//
+//***************************************************************************
+
+#ifndef BITMAP_FONT_H
+#define BITMAP_FONT_H
+
+#include "safe99_common/defines.h"
+
+#define BITMAP_FONT_FIRST_CHAR 0x20
+#define BITMAP_FONT_NUM_GLYPHS 95
+
+// 글자 5 x 7 + 오른쪽, 아래 한 칸 간격
+#define BITMAP_FONT_GLYPH_WIDTH 6
+#define BITMAP_FONT_GLYPH_HEIGHT 8
+
+typedef struct bitmap_font
+{
+    int scale;
+
+    // scale을 곱한 크기
+    int glyph_width;
+    int glyph_height;
+
+    // 글리프마다 glyph_width * glyph_height개의 마스크
+    uint32_t* pa_glyph_masks;
+} bitmap_font_t;
+
+START_EXTERN_C
+
+bool bitmap_font_init(bitmap_font_t* p_font, const int scale);
+void bitmap_font_release(bitmap_font_t* p_font);
+
+// p_dst는 bitmap_font_get_text_width(length) x glyph_height, pitch == 너비
+// 글자가 아닌 픽셀은 0 (투명)
+void bitmap_font_render(const bitmap_font_t* p_font, const char* text, const size_t length,
+                        const uint32_t argb, uint32_t* p_dst);
+
+FORCEINLINE int bitmap_font_get_text_width(const bitmap_font_t* p_font, const size_t length)
+{
+    ASSERT(p_font != NULL, "p_font == NULL");
+    return p_font->glyph_width * (int)length;
+}
+
+END_EXTERN_C
+
+#endif // BITMAP_FONT_H
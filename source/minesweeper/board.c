@@ -0,0 +1,154 @@
+﻿//***************************************************************************
+// 
+// 파일: board.c
+// 
+// 설명: 지뢰찾기 보드
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "board.h"
+
+void make_mine(bool* p_mines, const int rows, const int cols, const int num_mines)
+{
+    ASSERT(p_mines != NULL, "p_mines == NULL");
+
+    int count = 0;
+    while (count != num_mines)
+    {
+        const int index = (int)(next_board_random() % (uint64_t)(rows * cols));
+        
+        if (p_mines[index])
+        {
+            continue;
+        }
+
+        p_mines[index] = true;
+
+        ++count;
+    }
+}
+
+bool is_valid_position(const int x, const int y)
+{
+    return (x >= 0 && x < gp_game->cols
+            && y >= 0 && y < gp_game->rows);
+}
+
+int count_adjacent_mines(const int x, const int y)
+{
+    int count = 0;
+    count += (is_valid_position(x, y - 1) && gp_game->pa_mines[(y - 1) * gp_game->cols + x]);
+    count += (is_valid_position(x, y + 1) && gp_game->pa_mines[(y + 1) * gp_game->cols + x]);
+    count += (is_valid_position(x - 1, y) && gp_game->pa_mines[y * gp_game->cols + (x - 1)]);
+    count += (is_valid_position(x + 1, y) && gp_game->pa_mines[y * gp_game->cols + (x + 1)]);
+    count += (is_valid_position(x - 1, y - 1) && gp_game->pa_mines[(y - 1) * gp_game->cols + (x - 1)]);
+    count += (is_valid_position(x + 1, y - 1) && gp_game->pa_mines[(y - 1) * gp_game->cols + (x + 1)]);
+    count += (is_valid_position(x - 1, y + 1) && gp_game->pa_mines[(y + 1) * gp_game->cols + (x - 1)]);
+    count += (is_valid_position(x + 1, y + 1) && gp_game->pa_mines[(y + 1) * gp_game->cols + (x + 1)]);
+    return count;
+}
+
+void open_tile(const int x, const int y)
+{
+    latency_mark(LATENCY_STAGE_OPEN_TILE);
+
+    // 재귀 깊이 근사값
+    // (rows * cols - num_max_mines) * 8 + 1 (처음 넣는 타일)
+    const size_t num_safe_tiles = (size_t)gp_game->rows * (size_t)gp_game->cols - (size_t)gp_game->num_max_mines;
+    if (num_safe_tiles > (SIZE_MAX / sizeof(int) - 1) / 8)
+    {
+        ASSERT(false, "Too many tiles");
+        return;
+    }
+    const size_t num_max_stack = num_safe_tiles * 8 + 1;
+
+    int stack_index = 0;
+    int* stack_x = (int*)malloc(sizeof(int) * num_max_stack);
+    int* stack_y = (int*)malloc(sizeof(int) * num_max_stack);
+    if (stack_x == NULL || stack_y == NULL)
+    {
+        ASSERT(false, "Failed to malloc stack");
+        goto failed_malloc;
+    }
+
+    stack_x[stack_index] = x;
+    stack_y[stack_index] = y;
+    ++stack_index;
+
+    while (stack_index > 0)
+    {
+        --stack_index;
+        const int tile_x = stack_x[stack_index];
+        const int tile_y = stack_y[stack_index];
+
+        if (!is_valid_position(tile_x, tile_y))
+        {
+            continue;
+        }
+
+        const tile_t tile = gp_game->pa_tiles[tile_y * gp_game->cols + tile_x];
+        if (tile != TILE_BLIND && tile != TILE_FLAG && tile != TILE_UNKNOWN)
+        {
+            continue;
+        }
+
+        const int count = count_adjacent_mines(tile_x, tile_y);
+
+        if (gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] == TILE_FLAG)
+        {
+            ++gp_game->num_mines;
+        }
+
+        if (count == 0)
+        {
+            set_board_tile(tile_x, tile_y, TILE_OPEN);
+
+            stack_x[stack_index] = tile_x;
+            stack_y[stack_index] = tile_y - 1;
+            ++stack_index;
+
+            stack_x[stack_index] = tile_x;
+            stack_y[stack_index] = tile_y + 1;
+            ++stack_index;
+
+            stack_x[stack_index] = tile_x - 1;
+            stack_y[stack_index] = tile_y;
+            ++stack_index;
+
+            stack_x[stack_index] = tile_x + 1;
+            stack_y[stack_index] = tile_y;
+            ++stack_index;
+
+            stack_x[stack_index] = tile_x - 1;
+            stack_y[stack_index] = tile_y - 1;
+            ++stack_index;
+
+            stack_x[stack_index] = tile_x + 1;
+            stack_y[stack_index] = tile_y - 1;
+            ++stack_index;
+
+            stack_x[stack_index] = tile_x - 1;
+            stack_y[stack_index] = tile_y + 1;
+            ++stack_index;
+
+            stack_x[stack_index] = tile_x + 1;
+            stack_y[stack_index] = tile_y + 1;
+            ++stack_index;
+        }
+        else
+        {
+            set_board_tile(tile_x, tile_y, TILE_1 + count - 1);
+        }
+
+        --gp_game->num_tiles;
+    }
+
+failed_malloc:
+    SAFE_FREE(stack_y);
+    SAFE_FREE(stack_x);
+}
\ No newline at end of file
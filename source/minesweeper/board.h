@@ -0,0 +1,60 @@
+﻿//***************************************************************************
+// 
+// 파일: board.h
+// 
+// 설명: 지뢰찾기 보드
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// gp_game의 보드를 대상으로 동작
+// 
+//***************************************************************************
+
+#ifndef BOARD_H
+#define BOARD_H
+
+#include "safe99_common/defines.h"
+#include "game.h"
+
+START_EXTERN_C
+
+// 지뢰 배치 난수 (splitmix64), 상태가 gp_game->random_state 하나라 저장 파일에 그대로 저장
+// rand()는 상태를 꺼낼 수 없고 RAND_MAX가 32767이라 큰 보드의 뒤쪽에 지뢰를 놓지 못함
+FORCEINLINE void seed_board_random(const uint64_t seed)
+{
+    gp_game->random_state = seed;
+}
+
+FORCEINLINE uint64_t next_board_random(void)
+{
+    uint64_t z = (gp_game->random_state += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+void make_mine(bool* p_mines, const int rows, const int cols, const int num_mines);
+
+bool is_valid_position(const int x, const int y);
+int count_adjacent_mines(const int x, const int y);
+void open_tile(const int x, const int y);
+
+// 보드 타일은 항상 이 함수로 바꿈 (미니맵은 바뀐 타일의 블록만 갱신)
+FORCEINLINE void set_board_tile(const int x, const int y, const tile_t tile)
+{
+    const int index = y * gp_game->cols + x;
+    const tile_t old_tile = gp_game->pa_tiles[index];
+    if (old_tile == tile)
+    {
+        return;
+    }
+
+    gp_game->pa_tiles[index] = tile;
+    minimap_update_tile(&gp_game->minimap, (const int*)gp_game->pa_tiles, x, y, old_tile);
+}
+
+END_EXTERN_C
+
+#endif // BOARD_H
\ No newline at end of file
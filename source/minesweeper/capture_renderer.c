@@ -0,0 +1,409 @@
+﻿//***************************************************************************
+// 
+// 파일: capture_renderer.c
+// 
+// 설명: 그리기를 캡처 슬롯에도 똑같이 그리는 렌더러
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "capture_renderer.h"
+#include "safe99_soft_renderer/headless_renderer.h"
+
+typedef struct capture_renderer
+{
+    i_soft_renderer_t base;
+
+    size_t ref_count;
+
+    i_soft_renderer_t* p_inner;
+
+    // 캡처 슬롯에 그리는 렌더러 (대상은 프레임마다 슬롯으로 바꿈)
+    i_soft_renderer_t* p_mirror;
+
+    frame_capture_t* p_capture;
+    bool b_in_frame;
+    bool b_has_slot;
+} capture_renderer_t;
+
+// clip_line()은 p_this가 없으므로 감싼 렌더러의 함수를 기억해 둠
+static bool (__stdcall* s_pf_inner_clip_line)(int* p_out_start_x, int* p_out_start_y,
+                                              int* p_out_end_x, int* p_out_end_y,
+                                              const rect_t* p_clip_window);
+
+static bool begin_mirror(capture_renderer_t* p_renderer, uint64_t* p_out_begin);
+static void end_mirror(capture_renderer_t* p_renderer, const uint64_t begin);
+
+static size_t __stdcall renderer_add_ref(i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_release(i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_get_ref_count(const i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_get_width(const i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_get_height(const i_soft_renderer_t* p_this);
+static void __stdcall renderer_update_window_size(i_soft_renderer_t* p_this);
+static bool __stdcall renderer_initialize(i_soft_renderer_t* p_this, HWND hwnd, const bool b_full_screen);
+static void __stdcall renderer_on_draw(const i_soft_renderer_t* p_this);
+static void __stdcall renderer_clear(i_soft_renderer_t* p_this, const color_t color);
+static void __stdcall renderer_draw_pixel(i_soft_renderer_t* p_this, const int x, const int y, const color_t color);
+static void __stdcall renderer_draw_horizontal_line(i_soft_renderer_t* p_this, const int y, const color_t color);
+static void __stdcall renderer_draw_vertical_line(i_soft_renderer_t* p_this, const int x, const color_t color);
+static void __stdcall renderer_draw_line(i_soft_renderer_t* p_this,
+                                         const int start_x, const int start_y,
+                                         const int end_x, const int end_y,
+                                         const color_t color);
+static void __stdcall renderer_draw_rectangle(i_soft_renderer_t* p_this,
+                                              const int x, const int y,
+                                              const size_t width, const size_t height,
+                                              const color_t color);
+static void __stdcall renderer_draw_bitmap(i_soft_renderer_t* p_this,
+                                           const int x, const int y,
+                                           const int sprite_x, const int sprite_y, const size_t sprite_width, const size_t sprite_height,
+                                           const uint32_t* p_bitmap, const size_t width, const size_t height);
+static void __stdcall renderer_draw_text(i_soft_renderer_t* p_this, const int x, const int y,
+                                         const wchar_t* text, const size_t length, const color_t color);
+static bool __stdcall renderer_clip_line(int* p_out_start_x, int* p_out_start_y,
+                                         int* p_out_end_x, int* p_out_end_y,
+                                         const rect_t* p_clip_window);
+static bool __stdcall renderer_create_vertex_buffer(const i_soft_renderer_t* p_this,
+                                                    const size_t* p_offsets, const semantic_t* p_semantics, const size_t num_semantics,
+                                                    const void* p_vertices, const size_t num_vertices,
+                                                    i_vertex_buffer_t** pp_out_vertex_buffer);
+static bool __stdcall renderer_create_index_buffer(const i_soft_renderer_t* p_this,
+                                                   const uint_t* p_indices, const size_t num_indices,
+                                                   i_index_buffer_t** pp_out_index_buffer);
+static bool __stdcall renderer_create_mesh(const i_soft_renderer_t* p_this,
+                                           i_vertex_buffer_t* p_vertex_buffer,
+                                           i_index_buffer_t* p_index_buffer,
+                                           i_texture_t* p_texture_or_null,
+                                           const color_t wireframe_color,
+                                           i_mesh_t** pp_out_mesh);
+static void __stdcall renderer_draw_mesh2(i_soft_renderer_t* p_this,
+                                          const i_mesh_t* p_mesh, const matrix_t* p_transform_mat, const bool b_wireframe);
+static void __stdcall renderer_draw_mesh3(i_soft_renderer_t* p_this,
+                                          const i_mesh_t* p_mesh, const matrix_t* p_transform_mat, const bool b_wireframe);
+
+static i_soft_renderer_vtbl_t s_renderer_vtbl =
+{
+    renderer_add_ref,
+    renderer_release,
+    renderer_get_ref_count,
+    renderer_get_width,
+    renderer_get_height,
+    renderer_update_window_size,
+    renderer_initialize,
+    renderer_on_draw,
+    renderer_clear,
+    renderer_draw_pixel,
+    renderer_draw_horizontal_line,
+    renderer_draw_vertical_line,
+    renderer_draw_line,
+    renderer_draw_rectangle,
+    renderer_draw_bitmap,
+    renderer_draw_text,
+    renderer_clip_line,
+    renderer_create_vertex_buffer,
+    renderer_create_index_buffer,
+    renderer_create_mesh,
+    renderer_draw_mesh2,
+    renderer_draw_mesh3
+};
+
+bool create_capture_renderer(i_soft_renderer_t* p_inner, frame_capture_t* p_capture, i_soft_renderer_t** pp_out_renderer)
+{
+    ASSERT(p_inner != NULL, "p_inner == NULL");
+    ASSERT(p_capture != NULL, "p_capture == NULL");
+    ASSERT(pp_out_renderer != NULL, "pp_out_renderer == NULL");
+
+    const size_t width = p_inner->vtbl->get_width(p_inner);
+    const size_t height = p_inner->vtbl->get_height(p_inner);
+    ASSERT(width == p_capture->width && height == p_capture->height, "capture size mismatch");
+
+    capture_renderer_t* p_renderer = (capture_renderer_t*)malloc(sizeof(capture_renderer_t));
+    if (p_renderer == NULL)
+    {
+        ASSERT(false, "Failed to malloc renderer");
+        return false;
+    }
+
+    memset(p_renderer, 0, sizeof(capture_renderer_t));
+
+    if (!create_headless_renderer(width, height, &p_renderer->p_mirror))
+    {
+        ASSERT(false, "Failed to create mirror renderer");
+        free(p_renderer);
+        return false;
+    }
+
+    p_inner->vtbl->add_ref(p_inner);
+    s_pf_inner_clip_line = p_inner->vtbl->clip_line;
+
+    p_renderer->base.vtbl = &s_renderer_vtbl;
+    p_renderer->ref_count = 1;
+    p_renderer->p_inner = p_inner;
+    p_renderer->p_capture = p_capture;
+
+    *pp_out_renderer = &p_renderer->base;
+    return true;
+}
+
+// 프레임의 첫 그리기에서 슬롯을 받음, 슬롯이 있으면 시작 시각을 기록하고 true
+static bool begin_mirror(capture_renderer_t* p_renderer, uint64_t* p_out_begin)
+{
+    if (!p_renderer->b_in_frame)
+    {
+        uint32_t* p_slot = frame_capture_begin_frame(p_renderer->p_capture);
+        headless_renderer_set_target(p_renderer->p_mirror, p_slot);
+
+        p_renderer->b_in_frame = true;
+        p_renderer->b_has_slot = (p_slot != NULL);
+    }
+
+    if (!p_renderer->b_has_slot)
+    {
+        return false;
+    }
+
+    *p_out_begin = get_perf_counter();
+    return true;
+}
+
+static void end_mirror(capture_renderer_t* p_renderer, const uint64_t begin)
+{
+    frame_capture_add_time(p_renderer->p_capture, get_perf_counter() - begin);
+}
+
+static size_t __stdcall renderer_add_ref(i_soft_renderer_t* p_this)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    return ++p_renderer->ref_count;
+}
+
+static size_t __stdcall renderer_release(i_soft_renderer_t* p_this)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    if (--p_renderer->ref_count == 0)
+    {
+        // 그리던 프레임은 넘기지 않고 버림 (슬롯은 end_frame() 전이라 쓰기 스레드가 읽지 않음)
+        SAFE_RELEASE(p_renderer->p_mirror);
+        SAFE_RELEASE(p_renderer->p_inner);
+        free(p_renderer);
+        return 0;
+    }
+
+    return p_renderer->ref_count;
+}
+
+static size_t __stdcall renderer_get_ref_count(const i_soft_renderer_t* p_this)
+{
+    return ((const capture_renderer_t*)p_this)->ref_count;
+}
+
+static size_t __stdcall renderer_get_width(const i_soft_renderer_t* p_this)
+{
+    const capture_renderer_t* p_renderer = (const capture_renderer_t*)p_this;
+    return p_renderer->p_inner->vtbl->get_width(p_renderer->p_inner);
+}
+
+static size_t __stdcall renderer_get_height(const i_soft_renderer_t* p_this)
+{
+    const capture_renderer_t* p_renderer = (const capture_renderer_t*)p_this;
+    return p_renderer->p_inner->vtbl->get_height(p_renderer->p_inner);
+}
+
+// 캡처 크기는 시작할 때 고정, 창 크기가 바뀌면 캡처 쪽은 잘려서 그려짐
+static void __stdcall renderer_update_window_size(i_soft_renderer_t* p_this)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->update_window_size(p_renderer->p_inner);
+}
+
+static bool __stdcall renderer_initialize(i_soft_renderer_t* p_this, HWND hwnd, const bool b_full_screen)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    return p_renderer->p_inner->vtbl->initialize(p_renderer->p_inner, hwnd, b_full_screen);
+}
+
+static void __stdcall renderer_on_draw(const i_soft_renderer_t* p_this)
+{
+    // vtbl 시그니처가 const이지만 렌더러는 항상 create_capture_renderer()에서 할당한 객체
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+
+    p_renderer->p_inner->vtbl->on_draw(p_renderer->p_inner);
+
+    if (p_renderer->b_in_frame)
+    {
+        frame_capture_end_frame(p_renderer->p_capture);
+        p_renderer->b_in_frame = false;
+    }
+}
+
+static void __stdcall renderer_clear(i_soft_renderer_t* p_this, const color_t color)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->clear(p_renderer->p_inner, color);
+
+    uint64_t begin;
+    if (begin_mirror(p_renderer, &begin))
+    {
+        p_renderer->p_mirror->vtbl->clear(p_renderer->p_mirror, color);
+        end_mirror(p_renderer, begin);
+    }
+}
+
+static void __stdcall renderer_draw_pixel(i_soft_renderer_t* p_this, const int x, const int y, const color_t color)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_pixel(p_renderer->p_inner, x, y, color);
+
+    uint64_t begin;
+    if (begin_mirror(p_renderer, &begin))
+    {
+        p_renderer->p_mirror->vtbl->draw_pixel(p_renderer->p_mirror, x, y, color);
+        end_mirror(p_renderer, begin);
+    }
+}
+
+static void __stdcall renderer_draw_horizontal_line(i_soft_renderer_t* p_this, const int y, const color_t color)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_horizontal_line(p_renderer->p_inner, y, color);
+
+    uint64_t begin;
+    if (begin_mirror(p_renderer, &begin))
+    {
+        p_renderer->p_mirror->vtbl->draw_horizontal_line(p_renderer->p_mirror, y, color);
+        end_mirror(p_renderer, begin);
+    }
+}
+
+static void __stdcall renderer_draw_vertical_line(i_soft_renderer_t* p_this, const int x, const color_t color)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_vertical_line(p_renderer->p_inner, x, color);
+
+    uint64_t begin;
+    if (begin_mirror(p_renderer, &begin))
+    {
+        p_renderer->p_mirror->vtbl->draw_vertical_line(p_renderer->p_mirror, x, color);
+        end_mirror(p_renderer, begin);
+    }
+}
+
+static void __stdcall renderer_draw_line(i_soft_renderer_t* p_this,
+                                         const int start_x, const int start_y,
+                                         const int end_x, const int end_y,
+                                         const color_t color)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_line(p_renderer->p_inner, start_x, start_y, end_x, end_y, color);
+
+    uint64_t begin;
+    if (begin_mirror(p_renderer, &begin))
+    {
+        p_renderer->p_mirror->vtbl->draw_line(p_renderer->p_mirror, start_x, start_y, end_x, end_y, color);
+        end_mirror(p_renderer, begin);
+    }
+}
+
+static void __stdcall renderer_draw_rectangle(i_soft_renderer_t* p_this,
+                                              const int x, const int y,
+                                              const size_t width, const size_t height,
+                                              const color_t color)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_rectangle(p_renderer->p_inner, x, y, width, height, color);
+
+    uint64_t begin;
+    if (begin_mirror(p_renderer, &begin))
+    {
+        p_renderer->p_mirror->vtbl->draw_rectangle(p_renderer->p_mirror, x, y, width, height, color);
+        end_mirror(p_renderer, begin);
+    }
+}
+
+static void __stdcall renderer_draw_bitmap(i_soft_renderer_t* p_this,
+                                           const int x, const int y,
+                                           const int sprite_x, const int sprite_y, const size_t sprite_width, const size_t sprite_height,
+                                           const uint32_t* p_bitmap, const size_t width, const size_t height)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_bitmap(p_renderer->p_inner, x, y,
+                                           sprite_x, sprite_y, sprite_width, sprite_height,
+                                           p_bitmap, width, height);
+
+    uint64_t begin;
+    if (begin_mirror(p_renderer, &begin))
+    {
+        p_renderer->p_mirror->vtbl->draw_bitmap(p_renderer->p_mirror, x, y,
+                                                sprite_x, sprite_y, sprite_width, sprite_height,
+                                                p_bitmap, width, height);
+        end_mirror(p_renderer, begin);
+    }
+}
+
+// GDI 텍스트는 캡처하지 않음
+static void __stdcall renderer_draw_text(i_soft_renderer_t* p_this, const int x, const int y,
+                                         const wchar_t* text, const size_t length, const color_t color)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_text(p_renderer->p_inner, x, y, text, length, color);
+}
+
+static bool __stdcall renderer_clip_line(int* p_out_start_x, int* p_out_start_y,
+                                         int* p_out_end_x, int* p_out_end_y,
+                                         const rect_t* p_clip_window)
+{
+    ASSERT(s_pf_inner_clip_line != NULL, "no inner renderer");
+    return s_pf_inner_clip_line(p_out_start_x, p_out_start_y, p_out_end_x, p_out_end_y, p_clip_window);
+}
+
+static bool __stdcall renderer_create_vertex_buffer(const i_soft_renderer_t* p_this,
+                                                    const size_t* p_offsets, const semantic_t* p_semantics, const size_t num_semantics,
+                                                    const void* p_vertices, const size_t num_vertices,
+                                                    i_vertex_buffer_t** pp_out_vertex_buffer)
+{
+    const capture_renderer_t* p_renderer = (const capture_renderer_t*)p_this;
+    return p_renderer->p_inner->vtbl->create_vertex_buffer(p_renderer->p_inner,
+                                                           p_offsets, p_semantics, num_semantics,
+                                                           p_vertices, num_vertices,
+                                                           pp_out_vertex_buffer);
+}
+
+static bool __stdcall renderer_create_index_buffer(const i_soft_renderer_t* p_this,
+                                                   const uint_t* p_indices, const size_t num_indices,
+                                                   i_index_buffer_t** pp_out_index_buffer)
+{
+    const capture_renderer_t* p_renderer = (const capture_renderer_t*)p_this;
+    return p_renderer->p_inner->vtbl->create_index_buffer(p_renderer->p_inner, p_indices, num_indices, pp_out_index_buffer);
+}
+
+static bool __stdcall renderer_create_mesh(const i_soft_renderer_t* p_this,
+                                           i_vertex_buffer_t* p_vertex_buffer,
+                                           i_index_buffer_t* p_index_buffer,
+                                           i_texture_t* p_texture_or_null,
+                                           const color_t wireframe_color,
+                                           i_mesh_t** pp_out_mesh)
+{
+    const capture_renderer_t* p_renderer = (const capture_renderer_t*)p_this;
+    return p_renderer->p_inner->vtbl->create_mesh(p_renderer->p_inner,
+                                                  p_vertex_buffer, p_index_buffer, p_texture_or_null,
+                                                  wireframe_color, pp_out_mesh);
+}
+
+// 메시는 캡처하지 않음
+static void __stdcall renderer_draw_mesh2(i_soft_renderer_t* p_this,
+                                          const i_mesh_t* p_mesh, const matrix_t* p_transform_mat, const bool b_wireframe)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_mesh2(p_renderer->p_inner, p_mesh, p_transform_mat, b_wireframe);
+}
+
+static void __stdcall renderer_draw_mesh3(i_soft_renderer_t* p_this,
+                                          const i_mesh_t* p_mesh, const matrix_t* p_transform_mat, const bool b_wireframe)
+{
+    capture_renderer_t* p_renderer = (capture_renderer_t*)p_this;
+    p_renderer->p_inner->vtbl->draw_mesh3(p_renderer->p_inner, p_mesh, p_transform_mat, b_wireframe);
+}
\ No newline at end of file
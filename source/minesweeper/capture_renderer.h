@@ -0,0 +1,34 @@
+﻿//***************************************************************************
+// 
+// 파일: capture_renderer.h
+// 
+// 설명: 그리기를 캡처 슬롯에도 똑같이 그리는 렌더러
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// safe99_soft_renderer DLL은 프레임 버퍼를 공개하지 않으므로 화면을 읽어 올 수 없음
+// 대신 원래 렌더러를 감싸서 같은 그리기를 headless_renderer로 캡처 슬롯에 바로 그림
+// - 프레임의 첫 그리기에서 frame_capture_begin_frame(), on_draw()에서 end_frame()
+// - 슬롯이 없는 프레임 (링이 가득 참)은 원래 렌더러에만 그림
+// - 캡처 쪽 그리기 시간은 frame_capture_add_time()으로 프레임마다 더함
+// draw_text(), 메시 그리기는 원래 렌더러에만 그림 (오버레이 텍스트는 bitmap_font라 캡처됨)
+// 
+//***************************************************************************
+
+#ifndef CAPTURE_RENDERER_H
+#define CAPTURE_RENDERER_H
+
+#include "safe99_common/defines.h"
+#include "safe99_soft_renderer/i_soft_renderer.h"
+#include "frame_capture.h"
+
+START_EXTERN_C
+
+// p_inner는 참조를 하나 더 가짐, p_capture는 렌더러보다 오래 살아야 하며 크기가 p_inner와 같아야 함
+bool create_capture_renderer(i_soft_renderer_t* p_inner, frame_capture_t* p_capture, i_soft_renderer_t** pp_out_renderer);
+
+END_EXTERN_C
+
+#endif // CAPTURE_RENDERER_H
\ No newline at end of file
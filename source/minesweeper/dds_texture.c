@@ -0,0 +1,308 @@
+﻿//***************************************************************************
+// 
+// 파일: dds_texture.c
+// 
+// 설명: 메모리 맵 DDS 텍스쳐
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "dds_texture.h"
+#include "mapped_file.h"
+
+#define DDS_MAGIC 0x20534444 // "DDS "
+#define DDS_HEADER_SIZE 124
+#define DDS_PIXEL_FORMAT_SIZE 32
+
+#define DDPF_ALPHAPIXELS 0x1
+#define DDPF_FOURCC 0x4
+#define DDPF_RGB 0x40
+
+typedef struct dds_pixel_format
+{
+    uint32_t size;
+    uint32_t flags;
+    uint32_t four_cc;
+    uint32_t rgb_bit_count;
+    uint32_t r_mask;
+    uint32_t g_mask;
+    uint32_t b_mask;
+    uint32_t a_mask;
+} dds_pixel_format_t;
+
+typedef struct dds_header
+{
+    uint32_t magic;
+    uint32_t size;
+    uint32_t flags;
+    uint32_t height;
+    uint32_t width;
+    uint32_t pitch_or_linear_size;
+    uint32_t depth;
+    uint32_t mip_map_count;
+    uint32_t reserved1[11];
+    dds_pixel_format_t pixel_format;
+    uint32_t caps;
+    uint32_t caps2;
+    uint32_t caps3;
+    uint32_t caps4;
+    uint32_t reserved2;
+} dds_header_t;
+
+typedef struct dds_texture
+{
+    i_texture_t base;
+
+    size_t ref_count;
+
+    size_t width;
+    size_t height;
+
+    // 매핑된 픽셀 또는 pa_converted_bitmap
+    const uint32_t* p_bitmap;
+    uint32_t* pa_converted_bitmap;
+
+    mapped_file_t file;
+} dds_texture_t;
+
+static bool get_channel_shift(const uint32_t mask, uint32_t* p_out_shift);
+static bool convert_to_a8r8g8b8(const dds_pixel_format_t* p_pixel_format, const char* p_pixels,
+                                const size_t width, const size_t height, uint32_t* p_out_bitmap);
+
+static size_t __stdcall texture_add_ref(i_texture_t* p_this);
+static size_t __stdcall texture_release(i_texture_t* p_this);
+static size_t __stdcall texture_get_ref_count(const i_texture_t* p_this);
+static size_t __stdcall texture_get_width(const i_texture_t* p_this);
+static size_t __stdcall texture_get_height(const i_texture_t* p_this);
+static const char* __stdcall texture_get_bitmap(const i_texture_t* p_this);
+
+static i_texture_vtbl_t s_texture_vtbl =
+{
+    texture_add_ref,
+    texture_release,
+    texture_get_ref_count,
+    texture_get_width,
+    texture_get_height,
+    texture_get_bitmap
+};
+
+bool load_mapped_dds_texture(const char* filename, i_texture_t** pp_out_texture)
+{
+    ASSERT(filename != NULL, "filename == NULL");
+    ASSERT(pp_out_texture != NULL, "pp_out_texture == NULL");
+
+    dds_texture_t* p_texture = (dds_texture_t*)malloc(sizeof(dds_texture_t));
+    if (p_texture == NULL)
+    {
+        ASSERT(false, "Failed to malloc texture");
+        return false;
+    }
+    memset(p_texture, 0, sizeof(dds_texture_t));
+
+    if (!mapped_file_open(&p_texture->file, filename))
+    {
+        goto failed_load;
+    }
+
+    // 헤더 검증
+    if (p_texture->file.size < sizeof(dds_header_t))
+    {
+        goto failed_load;
+    }
+
+    dds_header_t header;
+    memcpy(&header, p_texture->file.p_data, sizeof(dds_header_t));
+
+    const dds_pixel_format_t* p_pixel_format = &header.pixel_format;
+    if (header.magic != DDS_MAGIC
+        || header.size != DDS_HEADER_SIZE
+        || p_pixel_format->size != DDS_PIXEL_FORMAT_SIZE
+        || header.width == 0 || header.height == 0)
+    {
+        goto failed_load;
+    }
+
+    // 압축 포맷, DX10 확장 헤더는 지원하지 않음
+    if ((p_pixel_format->flags & DDPF_FOURCC) != 0
+        || (p_pixel_format->flags & DDPF_RGB) == 0
+        || (p_pixel_format->rgb_bit_count != 32 && p_pixel_format->rgb_bit_count != 24))
+    {
+        goto failed_load;
+    }
+
+    const size_t width = header.width;
+    const size_t height = header.height;
+    const size_t pitch = width * (p_pixel_format->rgb_bit_count / 8);
+    if ((p_texture->file.size - sizeof(dds_header_t)) / height < pitch)
+    {
+        goto failed_load;
+    }
+
+    const char* p_pixels = p_texture->file.p_data + sizeof(dds_header_t);
+
+    const bool b_a8r8g8b8 = p_pixel_format->rgb_bit_count == 32
+        && (p_pixel_format->flags & DDPF_ALPHAPIXELS) != 0
+        && p_pixel_format->a_mask == 0xff000000
+        && p_pixel_format->r_mask == 0x00ff0000
+        && p_pixel_format->g_mask == 0x0000ff00
+        && p_pixel_format->b_mask == 0x000000ff;
+
+    if (b_a8r8g8b8)
+    {
+        // 매핑 시작 주소는 페이지 정렬이고 헤더가 128바이트이므로 uint32_t 정렬이 보장됨
+        p_texture->p_bitmap = (const uint32_t*)p_pixels;
+    }
+    else
+    {
+        p_texture->pa_converted_bitmap = (uint32_t*)malloc(sizeof(uint32_t) * width * height);
+        if (p_texture->pa_converted_bitmap == NULL)
+        {
+            ASSERT(false, "Failed to malloc bitmap");
+            goto failed_load;
+        }
+
+        if (!convert_to_a8r8g8b8(p_pixel_format, p_pixels, width, height, p_texture->pa_converted_bitmap))
+        {
+            goto failed_load;
+        }
+
+        p_texture->p_bitmap = p_texture->pa_converted_bitmap;
+        mapped_file_close(&p_texture->file);
+    }
+
+    p_texture->base.vtbl = &s_texture_vtbl;
+    p_texture->ref_count = 1;
+    p_texture->width = width;
+    p_texture->height = height;
+
+    *pp_out_texture = &p_texture->base;
+    return true;
+
+failed_load:
+    SAFE_FREE(p_texture->pa_converted_bitmap);
+    mapped_file_close(&p_texture->file);
+    free(p_texture);
+
+    return false;
+}
+
+bool is_zero_copy_dds_texture(const i_texture_t* p_texture)
+{
+    ASSERT(p_texture != NULL, "p_texture == NULL");
+    ASSERT(p_texture->vtbl == &s_texture_vtbl, "not a dds texture");
+
+    const dds_texture_t* p_dds_texture = (const dds_texture_t*)p_texture;
+    return p_dds_texture->pa_converted_bitmap == NULL;
+}
+
+// 8비트 채널 마스크만 지원, 마스크가 0이면 shift는 의미 없음
+static bool get_channel_shift(const uint32_t mask, uint32_t* p_out_shift)
+{
+    if (mask == 0)
+    {
+        *p_out_shift = 0;
+        return true;
+    }
+
+    for (uint32_t shift = 0; shift <= 24; shift += 8)
+    {
+        if (mask == (0xffu << shift))
+        {
+            *p_out_shift = shift;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool convert_to_a8r8g8b8(const dds_pixel_format_t* p_pixel_format, const char* p_pixels,
+                                const size_t width, const size_t height, uint32_t* p_out_bitmap)
+{
+    const uint32_t a_mask = (p_pixel_format->flags & DDPF_ALPHAPIXELS) != 0 ? p_pixel_format->a_mask : 0;
+
+    uint32_t r_shift;
+    uint32_t g_shift;
+    uint32_t b_shift;
+    uint32_t a_shift;
+    if (!get_channel_shift(p_pixel_format->r_mask, &r_shift)
+        || !get_channel_shift(p_pixel_format->g_mask, &g_shift)
+        || !get_channel_shift(p_pixel_format->b_mask, &b_shift)
+        || !get_channel_shift(a_mask, &a_shift))
+    {
+        return false;
+    }
+
+    const size_t bytes_per_pixel = p_pixel_format->rgb_bit_count / 8;
+    const uint8_t* p_src = (const uint8_t*)p_pixels;
+
+    for (size_t i = 0; i < width * height; ++i)
+    {
+        // 리틀 엔디안
+        uint32_t pixel = (uint32_t)p_src[0] | ((uint32_t)p_src[1] << 8) | ((uint32_t)p_src[2] << 16);
+        if (bytes_per_pixel == 4)
+        {
+            pixel |= (uint32_t)p_src[3] << 24;
+        }
+        p_src += bytes_per_pixel;
+
+        // 알파 채널이 없으면 불투명
+        const uint32_t a = (a_mask != 0) ? (pixel & a_mask) >> a_shift : 0xff;
+        const uint32_t r = (pixel & p_pixel_format->r_mask) >> r_shift;
+        const uint32_t g = (pixel & p_pixel_format->g_mask) >> g_shift;
+        const uint32_t b = (pixel & p_pixel_format->b_mask) >> b_shift;
+
+        p_out_bitmap[i] = (a << 24) | (r << 16) | (g << 8) | b;
+    }
+
+    return true;
+}
+
+static size_t __stdcall texture_add_ref(i_texture_t* p_this)
+{
+    dds_texture_t* p_texture = (dds_texture_t*)p_this;
+    return ++p_texture->ref_count;
+}
+
+static size_t __stdcall texture_release(i_texture_t* p_this)
+{
+    dds_texture_t* p_texture = (dds_texture_t*)p_this;
+    if (--p_texture->ref_count == 0)
+    {
+        SAFE_FREE(p_texture->pa_converted_bitmap);
+        mapped_file_close(&p_texture->file);
+        free(p_texture);
+
+        return 0;
+    }
+
+    return p_texture->ref_count;
+}
+
+static size_t __stdcall texture_get_ref_count(const i_texture_t* p_this)
+{
+    const dds_texture_t* p_texture = (const dds_texture_t*)p_this;
+    return p_texture->ref_count;
+}
+
+static size_t __stdcall texture_get_width(const i_texture_t* p_this)
+{
+    const dds_texture_t* p_texture = (const dds_texture_t*)p_this;
+    return p_texture->width;
+}
+
+static size_t __stdcall texture_get_height(const i_texture_t* p_this)
+{
+    const dds_texture_t* p_texture = (const dds_texture_t*)p_this;
+    return p_texture->height;
+}
+
+static const char* __stdcall texture_get_bitmap(const i_texture_t* p_this)
+{
+    const dds_texture_t* p_texture = (const dds_texture_t*)p_this;
+    return (const char*)p_texture->p_bitmap;
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+﻿//***************************************************************************
+// 
+// 파일: dds_texture.h
+// 
+// 설명: 메모리 맵 DDS 텍스쳐
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 파일을 매핑하고 헤더를 검증한 뒤 i_texture_t로 반환
+// - A8R8G8B8이면 get_bitmap()이 매핑된 픽셀을 그대로 가리킴 (복사 없음)
+// - 그 외 비압축 32/24비트 포맷은 A8R8G8B8로 변환한 사본을 만들고 매핑은 바로 해제
+// 텍스쳐가 해제될 때까지 매핑이 유지됨
+// 
+//***************************************************************************
+
+#ifndef DDS_TEXTURE_H
+#define DDS_TEXTURE_H
+
+#include "safe99_common/defines.h"
+
+bool load_mapped_dds_texture(const char* filename, i_texture_t** pp_out_texture);
+
+// load_mapped_dds_texture()로 만든 텍스쳐만 전달
+bool is_zero_copy_dds_texture(const i_texture_t* p_texture);
+
+#endif // DDS_TEXTURE_H
\ No newline at end of file
@@ -0,0 +1,135 @@
+﻿//***************************************************************************
+// 
+// 파일: debug_console.c
+// 
+// 설명: 보드 상태를 콘솔에 출력하는 디버그 콘솔
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "debug_console.h"
+
+#define MINE_ATTRIBUTES (FOREGROUND_RED | FOREGROUND_INTENSITY)
+#define TILE_ATTRIBUTES (FOREGROUND_RED | FOREGROUND_GREEN | FOREGROUND_BLUE)
+
+static CHAR_INFO* s_pa_buffer;
+static int s_width;
+static int s_height;
+
+static bool s_b_visible;
+static bool s_b_drawn;
+static uint32_t s_board_version;
+
+bool debug_console_init(const int rows, const int cols)
+{
+    ASSERT(rows > 0, "rows == 0");
+    ASSERT(cols > 0, "cols == 0");
+
+    // 타일 한 개당 "x " 두 칸
+    s_width = cols * 2;
+    s_height = rows;
+
+    s_pa_buffer = (CHAR_INFO*)malloc(sizeof(CHAR_INFO) * s_width * s_height);
+    if (s_pa_buffer == NULL)
+    {
+        ASSERT(false, "Failed to malloc console buffer");
+        return false;
+    }
+
+    s_b_visible = false;
+    s_b_drawn = false;
+    s_board_version = 0;
+
+    return true;
+}
+
+void debug_console_shutdown(void)
+{
+    SAFE_FREE(s_pa_buffer);
+    s_width = 0;
+    s_height = 0;
+    s_b_visible = false;
+}
+
+void debug_console_set_visible(const bool b_visible)
+{
+    s_b_visible = b_visible;
+
+    // 다시 켜질 때 보드가 바뀌지 않았어도 출력
+    s_b_drawn = false;
+}
+
+bool debug_console_is_visible(void)
+{
+    return s_b_visible;
+}
+
+void debug_console_draw(const bool* p_mines, const tile_t* p_tiles, const uint32_t board_version)
+{
+    ASSERT(p_mines != NULL, "p_mines == NULL");
+    ASSERT(p_tiles != NULL, "p_tiles == NULL");
+
+    if (!s_b_visible || s_pa_buffer == NULL)
+    {
+        return;
+    }
+
+    if (s_b_drawn && s_board_version == board_version)
+    {
+        return;
+    }
+
+    const int cols = s_width / 2;
+    for (int y = 0; y < s_height; ++y)
+    {
+        CHAR_INFO* p_line = s_pa_buffer + y * s_width;
+        for (int x = 0; x < cols; ++x)
+        {
+            const bool b_mine = p_mines[y * cols + x];
+            const tile_t tile = p_tiles[y * cols + x];
+
+            wchar_t ch;
+            switch (tile)
+            {
+            case TILE_BLIND:
+                ch = b_mine ? L'o' : L'.';
+                break;
+            case TILE_FLAG:
+            case TILE_FLAG_MINE:
+                ch = L'F';
+                break;
+            case TILE_UNKNOWN:
+            case TILE_OPEN_UNKNOWN:
+                ch = L'?';
+                break;
+            case TILE_MINE:
+            case TILE_GAMEOVER_MINE:
+                ch = L'*';
+                break;
+            case TILE_OPEN:
+                ch = L' ';
+                break;
+            default:
+                ch = L'1' + (tile - TILE_1);
+                break;
+            }
+
+            p_line[x * 2].Char.UnicodeChar = ch;
+            p_line[x * 2].Attributes = b_mine ? MINE_ATTRIBUTES : TILE_ATTRIBUTES;
+            p_line[x * 2 + 1].Char.UnicodeChar = L' ';
+            p_line[x * 2 + 1].Attributes = TILE_ATTRIBUTES;
+        }
+    }
+
+    const COORD buffer_size = { (SHORT)s_width, (SHORT)s_height };
+    const COORD buffer_coord = { 0, 0 };
+    SMALL_RECT region = { 0, 0, (SHORT)(s_width - 1), (SHORT)(s_height - 1) };
+    WriteConsoleOutput(GetStdHandle(STD_OUTPUT_HANDLE), s_pa_buffer, buffer_size, buffer_coord, &region);
+
+    s_b_drawn = true;
+    s_board_version = board_version;
+}
\ No newline at end of file
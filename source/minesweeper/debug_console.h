@@ -0,0 +1,31 @@
+﻿//***************************************************************************
+// 
+// 파일: debug_console.h
+// 
+// 설명: 보드 상태를 콘솔에 출력하는 디버그 콘솔
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 기본값은 비활성화
+// 보드가 바뀌었을 때만 버퍼 하나로 모아 WriteConsoleOutput 한 번으로 출력함
+// 
+//***************************************************************************
+
+#ifndef DEBUG_CONSOLE_H
+#define DEBUG_CONSOLE_H
+
+#include "safe99_common/defines.h"
+#include "game.h"
+
+bool debug_console_init(const int rows, const int cols);
+void debug_console_shutdown(void);
+
+void debug_console_set_visible(const bool b_visible);
+bool debug_console_is_visible(void);
+
+// board_version이 마지막으로 출력한 버전과 다를 때만 다시 출력
+void debug_console_draw(const bool* p_mines, const tile_t* p_tiles, const uint32_t board_version);
+
+#endif // DEBUG_CONSOLE_H
\ No newline at end of file
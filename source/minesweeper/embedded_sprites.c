@@ -0,0 +1,1279 @@
+﻿//***************************************************************************
+// 
+// 파일: embedded_sprites.c
+// 
+// 설명: 실행 파일에 포함되는 스프라이트 픽셀
+// 
+// embed_sprites가 빌드 전에 생성하는 파일이므로 직접 수정하지 말 것
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "embedded_sprites.h"
+
+// tiles.dds (128x32)
+ALIGN16 static const uint32_t s_tiles_pixels[4096] =
+{
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000,
+    0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffff0000, 0xffff0000, 0xffffffff,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000,
+    0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffffffff, 0xffffffff,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffc0c0c0,
+    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
+    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000,
+    0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xff008080,
+    0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
+    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000,
+    0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xff008080,
+    0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
+    0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000,
+    0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xff008080,
+    0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000,
+    0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080,
+    0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000,
+    0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xff008080,
+    0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
+    0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
+    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000,
+    0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xff008080,
+    0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff0000ff, 0xff0000ff, 0xff0000ff,
+    0xff0000ff, 0xff0000ff, 0xff0000ff, 0xff0000ff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000,
+    0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xff008000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000080, 0xff000080, 0xff000080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xff800000,
+    0xff800000, 0xff800000, 0xff800000, 0xff800000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff008080, 0xff008080, 0xff008080, 0xff008080,
+    0xff008080, 0xff008080, 0xff008080, 0xff008080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0
+};
+
+const embedded_sprite_t g_embedded_tiles_sprite = { 128, 32, s_tiles_pixels };
+
+// numbers.dds (130x23)
+ALIGN16 static const uint32_t s_numbers_pixels[2990] =
+{
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xffff0000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xff800000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff000000, 0xffff0000, 0xff000000,
+    0xff000000, 0xffff0000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xffff0000, 0xff000000, 0xff000000, 0xff800000, 0xff000000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff800000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000, 0xff800000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000, 0xffff0000,
+    0xffff0000, 0xffff0000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000
+};
+
+const embedded_sprite_t g_embedded_numbers_sprite = { 130, 23, s_numbers_pixels };
+
+// faces.dds (120x24)
+ALIGN16 static const uint32_t s_faces_pixels[2880] =
+{
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+    0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0c0c0, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xff808000, 0xff000000, 0xff808000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff808000, 0xff000000,
+    0xff808000, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xff000000, 0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffffff00,
+    0xff000000, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xff000000, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000,
+    0xff000000, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff808000, 0xff000000, 0xff808000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff808000, 0xff000000,
+    0xff808000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffff00, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff000000, 0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffffff00,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xff000000, 0xffffff00,
+    0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffff00, 0xff000000, 0xff000000, 0xff000000,
+    0xff000000, 0xffffff00, 0xff000000, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00,
+    0xff808000, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000,
+    0xff808000, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff808000, 0xff000000, 0xffffff00, 0xff000000, 0xff808000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff808000, 0xff000000, 0xffffff00, 0xff000000, 0xff808000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00, 0xffffff00,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff000000, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000,
+    0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xffffff00, 0xffffff00, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xff000000,
+    0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff000000, 0xff000000, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00, 0xffffff00,
+    0xff000000, 0xff000000, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff000000, 0xff000000, 0xff000000, 0xff000000, 0xff000000,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffffffff, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xff808080, 0xff808080,
+    0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffffffff, 0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0, 0xffc0c0c0,
+    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xffc0c0c0, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080,
+    0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080, 0xff808080
+};
+
+const embedded_sprite_t g_embedded_faces_sprite = { 120, 24, s_faces_pixels };
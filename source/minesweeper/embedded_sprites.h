@@ -0,0 +1,32 @@
+﻿//***************************************************************************
+// 
+// 파일: embedded_sprites.h
+// 
+// 설명: 실행 파일에 포함되는 스프라이트
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// embedded_sprites.c는 빌드 전에 embed_sprites가 sprite/*.dds에서 생성함
+// 픽셀은 A8R8G8B8, 16바이트 정렬
+// 
+//***************************************************************************
+
+#ifndef EMBEDDED_SPRITES_H
+#define EMBEDDED_SPRITES_H
+
+#include "safe99_common/defines.h"
+
+typedef struct embedded_sprite
+{
+    size_t width;
+    size_t height;
+    const uint32_t* p_pixels;
+} embedded_sprite_t;
+
+extern const embedded_sprite_t g_embedded_tiles_sprite;
+extern const embedded_sprite_t g_embedded_numbers_sprite;
+extern const embedded_sprite_t g_embedded_faces_sprite;
+
+#endif // EMBEDDED_SPRITES_H
\ No newline at end of file
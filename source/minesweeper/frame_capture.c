@@ -0,0 +1,327 @@
+﻿//***************************************************************************
+// 
+// 파일: frame_capture.c
+// 
+// 설명: 게임 화면 녹화용 프레임 링 버퍼와 쓰기 스레드
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "frame_capture.h"
+
+// 파일 쓰기 버퍼 (프레임 몇 개 분량을 모아서 씀)
+#define FRAME_CAPTURE_FILE_BUFFER_SIZE (4 * 1024 * 1024)
+
+static THREAD_FUNC(run_capture_writer);
+static void write_frame(frame_capture_t* p_capture, const uint32_t* p_frame, const uint32_t frame_index);
+static void write_full_frame(frame_capture_t* p_capture, const uint32_t* p_frame, const uint32_t frame_index);
+static void write_delta_frame(frame_capture_t* p_capture, const uint32_t* p_frame, const uint32_t frame_index);
+static void write_uint32s(frame_capture_t* p_capture, const uint32_t* p_values, const size_t num_values);
+
+bool frame_capture_start(frame_capture_t* p_capture, const char* filename,
+                         const size_t width, const size_t height, const frame_capture_mode_t mode)
+{
+    ASSERT(p_capture != NULL, "p_capture == NULL");
+    ASSERT(filename != NULL, "filename == NULL");
+    ASSERT(width > 0, "width == 0");
+    ASSERT(height > 0, "height == 0");
+
+    memset(p_capture, 0, sizeof(frame_capture_t));
+
+    p_capture->mode = mode;
+    p_capture->width = width;
+    p_capture->height = height;
+
+    const size_t num_pixels = width * height;
+
+    p_capture->pa_slots = (uint32_t*)malloc(sizeof(uint32_t) * num_pixels * FRAME_CAPTURE_NUM_SLOTS);
+    p_capture->pa_prev_frame = (uint32_t*)malloc(sizeof(uint32_t) * num_pixels);
+
+    // 최악의 경우 모든 블록이 바뀜: 픽셀 전체 + 블록마다 위치 2개
+    const size_t num_blocks = ((width + FRAME_CAPTURE_BLOCK_SIZE - 1) / FRAME_CAPTURE_BLOCK_SIZE)
+                              * ((height + FRAME_CAPTURE_BLOCK_SIZE - 1) / FRAME_CAPTURE_BLOCK_SIZE);
+    p_capture->pa_delta_buffer = (uint32_t*)malloc(sizeof(uint32_t) * (num_pixels + num_blocks * 2));
+    if (p_capture->pa_slots == NULL || p_capture->pa_prev_frame == NULL || p_capture->pa_delta_buffer == NULL)
+    {
+        ASSERT(false, "Failed to malloc capture slots");
+        goto failed_init;
+    }
+
+    p_capture->p_file = fopen(filename, "wb");
+    if (p_capture->p_file == NULL)
+    {
+        goto failed_init;
+    }
+    setvbuf(p_capture->p_file, NULL, _IOFBF, FRAME_CAPTURE_FILE_BUFFER_SIZE);
+
+    const uint32_t header[] =
+    {
+        FRAME_CAPTURE_MAGIC,
+        FRAME_CAPTURE_VERSION,
+        (uint32_t)width,
+        (uint32_t)height,
+        FRAME_CAPTURE_BLOCK_SIZE,
+        (uint32_t)mode
+    };
+    write_uint32s(p_capture, header, sizeof(header) / sizeof(header[0]));
+
+    p_capture->frequency = get_perf_frequency();
+
+    // 자동 리셋, 슬롯을 넘길 때마다 깨움
+    if (!init_event(&p_capture->frame_event))
+    {
+        ASSERT(false, "Failed to create capture event");
+        goto failed_init;
+    }
+
+    if (!create_thread(&p_capture->thread, run_capture_writer, p_capture))
+    {
+        ASSERT(false, "Failed to create capture thread");
+        goto failed_event;
+    }
+
+    p_capture->b_started = true;
+    return true;
+
+failed_event:
+    delete_event(&p_capture->frame_event);
+
+failed_init:
+    if (p_capture->p_file != NULL)
+    {
+        fclose(p_capture->p_file);
+    }
+    SAFE_FREE(p_capture->pa_delta_buffer);
+    SAFE_FREE(p_capture->pa_prev_frame);
+    SAFE_FREE(p_capture->pa_slots);
+    memset(p_capture, 0, sizeof(frame_capture_t));
+    return false;
+}
+
+void frame_capture_stop(frame_capture_t* p_capture)
+{
+    ASSERT(p_capture != NULL, "p_capture == NULL");
+
+    if (!p_capture->b_started)
+    {
+        return;
+    }
+
+    // 남은 슬롯을 모두 쓴 뒤 스레드가 끝남
+    _InterlockedExchange(&p_capture->b_stop, 1);
+    set_event(&p_capture->frame_event);
+    join_thread(p_capture->thread);
+    delete_event(&p_capture->frame_event);
+
+    frame_capture_stats_t stats;
+    frame_capture_get_stats(p_capture, &stats);
+
+    const uint32_t end_record[] =
+    {
+        FRAME_CAPTURE_RECORD_END,
+        (uint32_t)stats.num_frames,
+        (uint32_t)stats.num_dropped_frames,
+        (uint32_t)(stats.average_capture_ms * 1000.0),
+        (uint32_t)(stats.max_capture_ms * 1000.0)
+    };
+    write_uint32s(p_capture, end_record, sizeof(end_record) / sizeof(end_record[0]));
+    fclose(p_capture->p_file);
+
+    SAFE_FREE(p_capture->pa_delta_buffer);
+    SAFE_FREE(p_capture->pa_prev_frame);
+    SAFE_FREE(p_capture->pa_slots);
+    memset(p_capture, 0, sizeof(frame_capture_t));
+}
+
+uint32_t* frame_capture_begin_frame(frame_capture_t* p_capture)
+{
+    ASSERT(p_capture != NULL, "p_capture == NULL");
+    ASSERT(p_capture->b_started, "capture not started");
+    ASSERT(p_capture->p_current_slot == NULL, "frame already begun");
+
+    const uint64_t begin = get_perf_counter();
+
+    p_capture->frame_ticks = 0;
+    ++p_capture->num_frames;
+
+    // head는 이 스레드만 바꾸므로 그냥 읽고, tail은 쓰기 스레드가 공개한 값을 읽음
+    const long head = p_capture->head;
+    const long tail = p_capture->tail;
+    if ((unsigned long)(head - tail) >= FRAME_CAPTURE_NUM_SLOTS)
+    {
+        // 쓰기 스레드가 밀렸으므로 기다리지 않고 버림
+        ++p_capture->num_dropped_frames;
+    }
+    else
+    {
+        const size_t slot_index = (size_t)head % FRAME_CAPTURE_NUM_SLOTS;
+        p_capture->slot_frame_indices[slot_index] = (uint32_t)(p_capture->num_frames - 1);
+        p_capture->p_current_slot = p_capture->pa_slots + slot_index * p_capture->width * p_capture->height;
+    }
+
+    p_capture->frame_ticks += get_perf_counter() - begin;
+
+    return p_capture->p_current_slot;
+}
+
+void frame_capture_end_frame(frame_capture_t* p_capture)
+{
+    ASSERT(p_capture != NULL, "p_capture == NULL");
+    ASSERT(p_capture->b_started, "capture not started");
+
+    const uint64_t begin = get_perf_counter();
+
+    if (p_capture->p_current_slot != NULL)
+    {
+        // 슬롯 내용을 쓴 뒤에 head를 공개 (Interlocked는 전체 배리어)
+        _InterlockedExchange(&p_capture->head, p_capture->head + 1);
+        set_event(&p_capture->frame_event);
+        p_capture->p_current_slot = NULL;
+    }
+
+    p_capture->frame_ticks += get_perf_counter() - begin;
+
+    p_capture->total_ticks += p_capture->frame_ticks;
+    p_capture->max_ticks = MAX(p_capture->max_ticks, p_capture->frame_ticks);
+}
+
+void frame_capture_get_stats(const frame_capture_t* p_capture, frame_capture_stats_t* p_out_stats)
+{
+    ASSERT(p_capture != NULL, "p_capture == NULL");
+    ASSERT(p_out_stats != NULL, "p_out_stats == NULL");
+
+    memset(p_out_stats, 0, sizeof(frame_capture_stats_t));
+
+    p_out_stats->num_frames = p_capture->num_frames;
+    p_out_stats->num_dropped_frames = p_capture->num_dropped_frames;
+    p_out_stats->num_written_frames = (size_t)p_capture->num_written_frames;
+    p_out_stats->num_written_bytes = p_capture->num_written_bytes;
+
+    if (p_capture->num_frames > 0 && p_capture->frequency > 0)
+    {
+        const double ms_per_tick = 1000.0 / (double)p_capture->frequency;
+        p_out_stats->average_capture_ms = (double)p_capture->total_ticks * ms_per_tick / (double)p_capture->num_frames;
+        p_out_stats->max_capture_ms = (double)p_capture->max_ticks * ms_per_tick;
+    }
+}
+
+static THREAD_FUNC(run_capture_writer)
+{
+    frame_capture_t* p_capture = (frame_capture_t*)p_param;
+
+    while (true)
+    {
+        wait_event(&p_capture->frame_event);
+
+        // stop 신호를 head보다 먼저 읽어야 마지막 슬롯을 놓치지 않음
+        const bool b_stop = (p_capture->b_stop != 0);
+
+        long tail = p_capture->tail;
+        while (tail != p_capture->head)
+        {
+            const size_t slot_index = (size_t)tail % FRAME_CAPTURE_NUM_SLOTS;
+            const uint32_t* p_slot = p_capture->pa_slots + slot_index * p_capture->width * p_capture->height;
+
+            write_frame(p_capture, p_slot, p_capture->slot_frame_indices[slot_index]);
+
+            // 슬롯을 다 읽은 뒤에 렌더 스레드에 돌려줌
+            ++tail;
+            _InterlockedExchange(&p_capture->tail, tail);
+            _InterlockedIncrement(&p_capture->num_written_frames);
+        }
+
+        if (b_stop)
+        {
+            break;
+        }
+    }
+
+    return THREAD_RETURN;
+}
+
+static void write_frame(frame_capture_t* p_capture, const uint32_t* p_frame, const uint32_t frame_index)
+{
+    if (p_capture->mode == FRAME_CAPTURE_MODE_DELTA && p_capture->b_has_prev_frame)
+    {
+        write_delta_frame(p_capture, p_frame, frame_index);
+    }
+    else
+    {
+        write_full_frame(p_capture, p_frame, frame_index);
+    }
+
+    // 델타 기준 프레임, 슬롯은 곧 렌더 스레드가 다시 쓰므로 복사해 둠
+    if (p_capture->mode == FRAME_CAPTURE_MODE_DELTA && !p_capture->b_has_prev_frame)
+    {
+        memcpy(p_capture->pa_prev_frame, p_frame, sizeof(uint32_t) * p_capture->width * p_capture->height);
+        p_capture->b_has_prev_frame = true;
+    }
+}
+
+static void write_full_frame(frame_capture_t* p_capture, const uint32_t* p_frame, const uint32_t frame_index)
+{
+    const uint32_t record[] = { FRAME_CAPTURE_RECORD_FULL, frame_index, 0 };
+    write_uint32s(p_capture, record, sizeof(record) / sizeof(record[0]));
+    write_uint32s(p_capture, p_frame, p_capture->width * p_capture->height);
+}
+
+// 블록 행 단위로 이전 프레임과 비교, 다른 블록만 모아서 쓰고 이전 프레임을 갱신
+// 블록 수를 레코드 앞에 써야 하므로 블록은 pa_delta_buffer에 모은 뒤 한 번에 씀
+static void write_delta_frame(frame_capture_t* p_capture, const uint32_t* p_frame, const uint32_t frame_index)
+{
+    const size_t width = p_capture->width;
+    const size_t height = p_capture->height;
+
+    uint32_t* p_delta = p_capture->pa_delta_buffer;
+    uint32_t num_blocks = 0;
+
+    for (size_t block_y = 0; block_y < height; block_y += FRAME_CAPTURE_BLOCK_SIZE)
+    {
+        const size_t block_height = MIN(FRAME_CAPTURE_BLOCK_SIZE, height - block_y);
+
+        for (size_t block_x = 0; block_x < width; block_x += FRAME_CAPTURE_BLOCK_SIZE)
+        {
+            const size_t block_width = MIN(FRAME_CAPTURE_BLOCK_SIZE, width - block_x);
+            const size_t row_size = sizeof(uint32_t) * block_width;
+
+            bool b_dirty = false;
+            for (size_t y = block_y; y < block_y + block_height && !b_dirty; ++y)
+            {
+                const size_t offset = y * width + block_x;
+                b_dirty = (memcmp(p_frame + offset, p_capture->pa_prev_frame + offset, row_size) != 0);
+            }
+
+            if (!b_dirty)
+            {
+                continue;
+            }
+
+            *p_delta++ = (uint32_t)(block_x / FRAME_CAPTURE_BLOCK_SIZE);
+            *p_delta++ = (uint32_t)(block_y / FRAME_CAPTURE_BLOCK_SIZE);
+
+            for (size_t y = 0; y < block_height; ++y)
+            {
+                const size_t offset = (block_y + y) * width + block_x;
+                memcpy(p_delta, p_frame + offset, row_size);
+                memcpy(p_capture->pa_prev_frame + offset, p_frame + offset, row_size);
+                p_delta += block_width;
+            }
+
+            ++num_blocks;
+        }
+    }
+
+    const uint32_t record[] = { FRAME_CAPTURE_RECORD_DELTA, frame_index, num_blocks };
+    write_uint32s(p_capture, record, sizeof(record) / sizeof(record[0]));
+    write_uint32s(p_capture, p_capture->pa_delta_buffer, (size_t)(p_delta - p_capture->pa_delta_buffer));
+}
+
+static void write_uint32s(frame_capture_t* p_capture, const uint32_t* p_values, const size_t num_values)
+{
+    const size_t num_written = fwrite(p_values, sizeof(uint32_t), num_values, p_capture->p_file);
+    p_capture->num_written_bytes += sizeof(uint32_t) * num_written;
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+﻿//***************************************************************************
+// 
+// 파일: frame_capture.h
+// 
+// 설명: 게임 화면 녹화용 프레임 링 버퍼와 쓰기 스레드
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 렌더 스레드 (생산자) 하나와 쓰기 스레드 (소비자) 하나만 쓰는 SPSC 링
+// - 슬롯은 시작할 때 FRAME_CAPTURE_NUM_SLOTS개를 미리 할당, 렌더러가 슬롯에 바로 그림 (복사 없음)
+// - begin_frame()은 빈 슬롯이 없으면 NULL (프레임을 버림), 렌더 스레드는 I/O를 기다리지 않음
+// - 쓰기 스레드는 슬롯을 그대로 (RAW) 또는 이전 프레임과 다른 블록만 (DELTA) 파일에 씀
+// 파일 형식 (모두 리틀 엔디언 uint32_t)
+// - 헤더: FRAME_CAPTURE_MAGIC, 버전, 너비, 높이, 블록 크기, 모드
+// - 프레임: 레코드 종류, 프레임 번호 (버린 프레임은 번호가 비어 있음), 블록 수
+//   FULL은 너비 x 높이 픽셀, DELTA는 블록마다 (블록 x, 블록 y) + 블록 픽셀 (가장자리 블록은 잘린 크기)
+// - 끝: END, 프레임 수, 버린 프레임 수, 프레임당 평균/최대 캡처 시간 (마이크로초)
+// 
+//***************************************************************************
+
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <stdio.h>
+
+#include "safe99_common/defines.h"
+#include "platform.h"
+
+#define FRAME_CAPTURE_NUM_SLOTS 8
+#define FRAME_CAPTURE_BLOCK_SIZE 16
+
+// "MSCP"
+#define FRAME_CAPTURE_MAGIC 0x5043534d
+#define FRAME_CAPTURE_VERSION 1
+
+typedef enum frame_capture_mode
+{
+    FRAME_CAPTURE_MODE_RAW,
+    FRAME_CAPTURE_MODE_DELTA
+} frame_capture_mode_t;
+
+typedef enum frame_capture_record
+{
+    FRAME_CAPTURE_RECORD_FULL,
+    FRAME_CAPTURE_RECORD_DELTA,
+    FRAME_CAPTURE_RECORD_END
+} frame_capture_record_t;
+
+typedef struct frame_capture_stats
+{
+    size_t num_frames;
+    size_t num_dropped_frames;
+    size_t num_written_frames;
+    uint64_t num_written_bytes;
+
+    // 렌더 스레드가 프레임마다 캡처에 쓴 시간 (frame_capture_add_time()으로 더한 시간)
+    double average_capture_ms;
+    double max_capture_ms;
+} frame_capture_stats_t;
+
+typedef struct frame_capture
+{
+    bool b_started;
+    frame_capture_mode_t mode;
+
+    size_t width;
+    size_t height;
+
+    // FRAME_CAPTURE_NUM_SLOTS x 너비 x 높이
+    uint32_t* pa_slots;
+    uint32_t slot_frame_indices[FRAME_CAPTURE_NUM_SLOTS];
+
+    // 계속 증가하는 인덱스, 슬롯은 % FRAME_CAPTURE_NUM_SLOTS
+    // head는 렌더 스레드만, tail은 쓰기 스레드만 증가 (Interlocked로 공개)
+    volatile long head;
+    volatile long tail;
+
+    // begin_frame() ~ end_frame() 사이의 슬롯, 버린 프레임이면 NULL
+    uint32_t* p_current_slot;
+
+    thread_t thread;
+    event_t frame_event;
+    volatile long b_stop;
+
+    // 쓰기 스레드 전용
+    FILE* p_file;
+    uint32_t* pa_prev_frame;
+    bool b_has_prev_frame;
+    uint32_t* pa_delta_buffer;
+
+    // 렌더 스레드 통계
+    uint64_t frequency;
+    uint64_t frame_ticks;
+    uint64_t total_ticks;
+    uint64_t max_ticks;
+    size_t num_frames;
+    size_t num_dropped_frames;
+
+    // 쓰기 스레드 통계 (num_written_bytes는 실행 중에 읽으면 근삿값)
+    volatile long num_written_frames;
+    uint64_t num_written_bytes;
+} frame_capture_t;
+
+START_EXTERN_C
+
+bool frame_capture_start(frame_capture_t* p_capture, const char* filename,
+                         const size_t width, const size_t height, const frame_capture_mode_t mode);
+
+// 링에 남은 프레임을 모두 쓰고 끝 레코드를 쓴 뒤 종료
+void frame_capture_stop(frame_capture_t* p_capture);
+
+// 렌더 스레드, 이번 프레임을 그릴 슬롯 (너비 x 높이, pitch == 너비), 링이 가득 차면 NULL
+uint32_t* frame_capture_begin_frame(frame_capture_t* p_capture);
+
+// 렌더 스레드, 슬롯을 쓰기 스레드에 넘김
+void frame_capture_end_frame(frame_capture_t* p_capture);
+
+// 렌더 스레드, 이번 프레임의 캡처 비용에 더함 (get_perf_counter() 틱)
+FORCEINLINE void frame_capture_add_time(frame_capture_t* p_capture, const uint64_t ticks)
+{
+    ASSERT(p_capture != NULL, "p_capture == NULL");
+    p_capture->frame_ticks += ticks;
+}
+
+void frame_capture_get_stats(const frame_capture_t* p_capture, frame_capture_stats_t* p_out_stats);
+
+END_EXTERN_C
+
+#endif // FRAME_CAPTURE_H
\ No newline at end of file
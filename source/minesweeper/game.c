@@ -12,29 +12,73 @@
 
 #include "precompiled.h"
 #include "game.h"
+#include "asset_loader.h"
+#include "board.h"
+#include "capture_renderer.h"
+#include "embedded_sprites.h"
+#include "game_save.h"
+#include "static_texture.h"
 
 // 전역 변수
 extern HWND g_hwnd;
 
 // 전역 함수
 static void update(const float delta_time);
-static void draw(void);
 
-static void print_info(void);
+static bool is_key_triggered(const uint8_t key);
+static void start_capture(const frame_capture_mode_t mode);
+static void stop_capture(void);
+static bool acquire_sprite_atlas(void);
+static asset_handle_t load_sprite_texture_async(const char* sprite_directory, const char* filename);
+static bool wait_sprite_texture(const asset_handle_t handle,
+                                const embedded_sprite_t* p_embedded_sprite, static_texture_t* p_static_texture,
+                                i_texture_t** pp_out_texture);
+
+// 기본 테마 텍스쳐
+static static_texture_t s_tiles_texture;
+static static_texture_t s_numbers_texture;
+static static_texture_t s_faces_texture;
+
+// 스프라이트 디렉터리가 지정된 경우에만 사용, 기본 테마는 ASSET_HANDLE_INVALID
+static asset_loader_t s_asset_loader;
+static asset_handle_t s_tiles_handle = ASSET_HANDLE_INVALID;
+static asset_handle_t s_numbers_handle = ASSET_HANDLE_INVALID;
+static asset_handle_t s_faces_handle = ASSET_HANDLE_INVALID;
+
+bool begin_load_game_assets(void)
+{
+    s_tiles_handle = ASSET_HANDLE_INVALID;
+    s_numbers_handle = ASSET_HANDLE_INVALID;
+    s_faces_handle = ASSET_HANDLE_INVALID;
+
+    // 기본 테마는 실행 파일에 포함된 픽셀을 그대로 사용하므로 로드할 파일이 없음
+    const char* sprite_directory = getenv(SPRITE_DIRECTORY_ENV);
+    if (sprite_directory == NULL)
+    {
+        return true;
+    }
+
+    if (!asset_loader_init(&s_asset_loader, 0))
+    {
+        ASSERT(false, "Failed to init asset loader");
+        return false;
+    }
 
-static void make_mine(bool* p_mines, const int rows, const int cols, const int num_mines);
+    s_tiles_handle = load_sprite_texture_async(sprite_directory, SPRITE_TILES_FILENAME);
+    s_numbers_handle = load_sprite_texture_async(sprite_directory, SPRITE_NUMBERS_FILENAME);
+    s_faces_handle = load_sprite_texture_async(sprite_directory, SPRITE_FACES_FILENAME);
 
-static bool is_valid_position(const int x, const int y);
-static void open_tile(const int x, const int y);
+    return true;
+}
 
-bool init_game(const int rows, const int cols, const int num_mines)
+bool init_game(const int rows, const int cols, const int num_mines, const int scale)
 {
     ASSERT(rows >= 9, "width < 9");
     ASSERT(cols >= 9, "height < 9");
     ASSERT(num_mines > 0, "num_mines == 0");
+    ASSERT(scale >= 1 && scale <= GAME_NUM_MAX_SCALE, "invalid scale");
 
     visible_cursor(false);
-    srand((unsigned int)time(NULL));
 
     memset(gp_game, 0, sizeof(game_t));
 
@@ -55,6 +99,8 @@ bool init_game(const int rows, const int cols, const int num_mines)
             goto failed_init;
         }
 
+        startup_mark(STARTUP_PHASE_DLL_LOAD);
+
         // 인스턴스 생성 함수
         create_instance_func pf_create_renderer = (create_instance_func)GetProcAddress(gp_game->h_renderer_dll, "create_instance");
         create_instance_func pf_create_file_system = (create_instance_func)GetProcAddress(gp_game->h_file_system_dll, "create_instance");
@@ -67,6 +113,8 @@ bool init_game(const int rows, const int cols, const int num_mines)
             goto failed_init;
         }
 
+        startup_mark(STARTUP_PHASE_RENDERER_INIT);
+
         // 파일 시스템 초기화
         pf_create_file_system(&gp_game->p_file_system);
         if (!gp_game->p_file_system->vtbl->initialize(gp_game->p_file_system))
@@ -74,6 +122,8 @@ bool init_game(const int rows, const int cols, const int num_mines)
             ASSERT(false, "Failed init file system");
             goto failed_init;
         }
+
+        startup_mark(STARTUP_PHASE_FILE_SYSTEM_INIT);
     }
 
     // 프레임 초기화
@@ -82,39 +132,7 @@ bool init_game(const int rows, const int cols, const int num_mines)
         gp_game->fps = 0;
 
         timer_init(&gp_game->frame_timer);
-    }
-
-    // 텍스쳐 로드
-    {
-        // 타일 로드
-        if (!gp_game->p_file_system->vtbl->load_a8r8g8b8_dds(gp_game->p_file_system,
-                                                             "..\\..\\sprite\\tiles.dds",
-                                                             &gp_game->p_tiles_texture))
-        {
-            MessageBox(NULL, L"Failed to load texture", L"Error", MB_OK | MB_ICONERROR);
-            ASSERT(false, "Failed to load texture");
-            goto failed_init;
-        }
-
-        // 숫자 로드
-        if (!gp_game->p_file_system->vtbl->load_a8r8g8b8_dds(gp_game->p_file_system,
-                                                             "..\\..\\sprite\\numbers.dds",
-                                                             &gp_game->p_numbers_texture))
-        {
-            MessageBox(NULL, L"Failed to load texture", L"Error", MB_OK | MB_ICONERROR);
-            ASSERT(false, "Failed to load texture");
-            goto failed_init;
-        }
-
-        // 얼굴 로드
-        if (!gp_game->p_file_system->vtbl->load_a8r8g8b8_dds(gp_game->p_file_system,
-                                                             "..\\..\\sprite\\faces.dds",
-                                                             &gp_game->p_faces_texture))
-        {
-            MessageBox(NULL, L"Failed to load texture", L"Error", MB_OK | MB_ICONERROR);
-            ASSERT(false, "Failed to load texture");
-            goto failed_init;
-        }
+        latency_init();
     }
 
     // 게임 초기화
@@ -127,6 +145,7 @@ bool init_game(const int rows, const int cols, const int num_mines)
         gp_game->b_left_mouse_pressed = false;
         gp_game->b_right_mouse_pressed = false;
         gp_game->num_tiles = rows * cols;
+        gp_game->scale = scale;
 
         // 지뢰 초기화
         gp_game->pa_mines = (bool*)malloc(sizeof(bool) * rows * cols);
@@ -146,21 +165,54 @@ bool init_game(const int rows, const int cols, const int num_mines)
         }
         memset(gp_game->pa_tiles, TILE_BLIND, sizeof(tile_t) * rows * cols);
 
+        // 미니맵 초기화
+        if (!minimap_init(&gp_game->minimap, rows, cols))
+        {
+            ASSERT(false, "Failed to init minimap");
+            goto failed_init;
+        }
+        minimap_clear(&gp_game->minimap, TILE_BLIND);
+
+        // 오버레이 폰트 초기화
+        if (!bitmap_font_init(&gp_game->font, scale))
+        {
+            ASSERT(false, "Failed to init bitmap font");
+            goto failed_init;
+        }
+
+        if (!text_cache_init(&gp_game->text_cache, &gp_game->font))
+        {
+            ASSERT(false, "Failed to init text cache");
+            goto failed_init;
+        }
+
         // 얼굴 위치 초기화
         const int WINDOW_WIDTH = (int)gp_game->p_renderer->vtbl->get_width(gp_game->p_renderer);
         const int WINDOW_HEIGHT = (int)gp_game->p_renderer->vtbl->get_height(gp_game->p_renderer);
 
-        gp_game->face_x = WINDOW_WIDTH / 2 - SPRITE_FACE_WIDTH / 2;
-        gp_game->face_y = INFO_HEIGHT / 2 - SPRITE_FACE_HEIGHT / 2;
+        gp_game->face_x = WINDOW_WIDTH / 2 - SPRITE_FACE_WIDTH * scale / 2;
+        gp_game->face_y = (INFO_HEIGHT / 2 - SPRITE_FACE_HEIGHT / 2) * scale;
 
         // 게임 타이머 초기화
         gp_game->game_time = 0;
         timer_init(&gp_game->game_timer);
 
         // 지뢰 생성
+        seed_board_random((uint64_t)time(NULL));
         make_mine(gp_game->pa_mines, rows, cols, num_mines);
+        gp_game->board_version = 0;
+
+        // 디버그 콘솔 초기화
+        if (!debug_console_init(rows, cols))
+        {
+            ASSERT(false, "Failed to init debug console");
+            goto failed_init;
+        }
     }
 
+    // 텍스쳐는 워커에서 로드 중이며 첫 프레임에서 기다림
+    startup_mark(STARTUP_PHASE_GAME_INIT);
+
     return true;
 
 failed_init:
@@ -170,11 +222,21 @@ failed_init:
 
 void shutdown_game(void)
 {
+    // 녹화 중이면 남은 프레임을 쓰고 원래 렌더러로 돌림
+    stop_capture();
+
     // 게임 리소스 해제
+    debug_console_shutdown();
+    text_cache_release(&gp_game->text_cache);
+    bitmap_font_release(&gp_game->font);
+    minimap_release(&gp_game->minimap);
     SAFE_FREE(gp_game->pa_tiles);
     SAFE_FREE(gp_game->pa_mines);
 
     // 텍스쳐 해제
+    asset_loader_shutdown(&s_asset_loader);
+    palette_board_release(&gp_game->palette_board);
+    sprite_atlas_release(&gp_game->sprite_atlas);
     SAFE_RELEASE(gp_game->p_tiles_texture);
     SAFE_RELEASE(gp_game->p_numbers_texture);
     SAFE_RELEASE(gp_game->p_faces_texture);
@@ -192,6 +254,26 @@ void shutdown_game(void)
 
 void tick_game(void)
 {
+    // 로드에 실패했으면 WM_QUIT이 올 때까지 아무것도 하지 않음
+    static bool b_atlas_failed;
+    if (b_atlas_failed)
+    {
+        return;
+    }
+
+    // 첫 프레임에서만 에셋 로드가 끝나기를 기다림
+    if (gp_game->sprite_atlas.pa_pixels == NULL && !acquire_sprite_atlas())
+    {
+        b_atlas_failed = true;
+
+        MessageBox(NULL, L"Failed to load texture", L"Error", MB_OK | MB_ICONERROR);
+        ASSERT(false, "Failed to load texture");
+        DestroyWindow(g_hwnd);
+        return;
+    }
+
+    PROFILE_BEGIN_FRAME();
+
     // 업데이트 시작
     {
         static float start_time;
@@ -200,7 +282,9 @@ void tick_game(void)
         const float elapsed_time = end_time - start_time;
         if (elapsed_time >= gp_game->update_ticks_per_frame)
         {
+            PROFILE_BEGIN("update");
             update(elapsed_time);
+            PROFILE_END();
 
             start_time = end_time;
         }
@@ -210,9 +294,20 @@ void tick_game(void)
     {
         static float start_time;
         static int frame_count;
+        static bool b_first_frame_drawn;
 
-        draw();
-        print_info();
+        draw_game();
+
+        if (!b_first_frame_drawn)
+        {
+            startup_mark(STARTUP_PHASE_FIRST_FRAME);
+            startup_print();
+            b_first_frame_drawn = true;
+        }
+
+        PROFILE_BEGIN("debug_console");
+        debug_console_draw(gp_game->pa_mines, gp_game->pa_tiles, gp_game->board_version);
+        PROFILE_END();
 
         const float end_time = timer_get_time(&gp_game->frame_timer);
         const float elapsed_time = (end_time - start_time) * 1000.0f;
@@ -226,6 +321,8 @@ void tick_game(void)
 
         ++frame_count;
     }
+
+    PROFILE_END_FRAME();
 }
 
 static void update(const float delta_time)
@@ -236,6 +333,83 @@ static void update(const float delta_time)
     const int ROWS = gp_game->rows;
     const int COLS = gp_game->cols;
 
+    // 화면 좌표는 확대된 크기 기준
+    const int TILE_WIDTH = SPRITE_TILE_WIDTH * gp_game->scale;
+    const int TILE_HEIGHT = SPRITE_TILE_HEIGHT * gp_game->scale;
+    const int FACE_WIDTH = SPRITE_FACE_WIDTH * gp_game->scale;
+    const int FACE_HEIGHT = SPRITE_FACE_HEIGHT * gp_game->scale;
+    const int INFO_AREA_HEIGHT = INFO_HEIGHT * gp_game->scale;
+
+    latency_mark(LATENCY_STAGE_UPDATE);
+
+    // 지연 시간 오버레이 토글
+    if (is_key_triggered(VK_F2))
+    {
+        gp_game->b_latency_overlay = !gp_game->b_latency_overlay;
+    }
+
+    // 디버그 콘솔 토글
+    if (is_key_triggered(VK_F1))
+    {
+        debug_console_set_visible(!debug_console_is_visible());
+    }
+
+    // 지연 시간 CSV 저장
+    if (is_key_triggered(VK_F3))
+    {
+        latency_dump_csv("latency.csv");
+    }
+
+    // 프로파일러 오버레이 토글
+    if (is_key_triggered(VK_F4))
+    {
+        gp_game->b_profiler_overlay = !gp_game->b_profiler_overlay;
+    }
+
+    // 프로파일 저장
+    if (is_key_triggered(VK_F5))
+    {
+        profiler_export_chrome_trace("profile.json");
+    }
+
+    // 팔레트 보드 토글
+    if (is_key_triggered(VK_F6) && gp_game->b_palette_board_available)
+    {
+        gp_game->b_palette_board = !gp_game->b_palette_board;
+    }
+
+    // 미니맵 토글
+    if (is_key_triggered(VK_F7))
+    {
+        gp_game->b_minimap = !gp_game->b_minimap;
+    }
+
+    // 녹화 토글
+    if (is_key_triggered(VK_F8))
+    {
+        if (gp_game->frame_capture.b_started)
+        {
+            stop_capture();
+        }
+        else
+        {
+            start_capture((get_key_state(VK_SHIFT) != KEYBOARD_STATE_UP) ? FRAME_CAPTURE_MODE_RAW : FRAME_CAPTURE_MODE_DELTA);
+        }
+    }
+
+    // 저장 (F9), 불러오기 (Shift + F9)
+    if (is_key_triggered(VK_F9))
+    {
+        if (get_key_state(VK_SHIFT) != KEYBOARD_STATE_UP)
+        {
+            load_game(GAME_SAVE_FILENAME);
+        }
+        else
+        {
+            save_game(GAME_SAVE_FILENAME);
+        }
+    }
+
     if (!gp_game->b_left_mouse_pressed && get_left_mouse_state() == MOUSE_STATE_DOWN)
     {
         gp_game->b_left_mouse_pressed = true;
@@ -252,8 +426,8 @@ static void update(const float delta_time)
         const int mouse_y = get_mouse_y();
 
         // 얼굴 클릭 시 게임 재시작
-        if (mouse_x >= gp_game->face_x && mouse_x <= gp_game->face_x + SPRITE_FACE_WIDTH
-            && mouse_y >= gp_game->face_y && mouse_y <= gp_game->face_y + SPRITE_FACE_HEIGHT)
+        if (mouse_x >= gp_game->face_x && mouse_x <= gp_game->face_x + FACE_WIDTH
+            && mouse_y >= gp_game->face_y && mouse_y <= gp_game->face_y + FACE_HEIGHT)
         {
             gp_game->num_mines = gp_game->num_max_mines;
             gp_game->num_tiles = gp_game->rows * gp_game->cols;
@@ -262,7 +436,9 @@ static void update(const float delta_time)
 
             memset(gp_game->pa_mines, false, sizeof(bool) * gp_game->rows * gp_game->cols);
             memset(gp_game->pa_tiles, TILE_BLIND, sizeof(tile_t) * gp_game->rows * gp_game->cols);
+            minimap_clear(&gp_game->minimap, TILE_BLIND);
             make_mine(gp_game->pa_mines, gp_game->rows, gp_game->cols, gp_game->num_max_mines);
+            ++gp_game->board_version;
 
             gp_game->b_left_mouse_pressed = false;
             gp_game->b_right_mouse_pressed = false;
@@ -294,12 +470,12 @@ static void update(const float delta_time)
         const int mouse_y = (int)get_mouse_y();
 
         // 스크린 좌표 -> 타일 좌표 변환
-        const int tile_x = mouse_x / SPRITE_TILE_WIDTH;
-        const int tile_y = (mouse_y - INFO_HEIGHT) / SPRITE_TILE_HEIGHT;
+        const int tile_x = mouse_x / TILE_WIDTH;
+        const int tile_y = (mouse_y - INFO_AREA_HEIGHT) / TILE_HEIGHT;
 
         // 타일 클릭 시
         if (mouse_x >= 0 && mouse_x < WINDOW_WIDTH
-            && mouse_y >= INFO_HEIGHT && mouse_y < WINDOW_HEIGHT)
+            && mouse_y >= INFO_AREA_HEIGHT && mouse_y < WINDOW_HEIGHT)
         {
             // 지뢰일 경우
             const bool b_gameover_mine = gp_game->pa_mines[tile_y * gp_game->cols + tile_x];
@@ -313,17 +489,19 @@ static void update(const float delta_time)
                         const bool b_mine = gp_game->pa_mines[i * gp_game->cols + j];
                         if (b_mine)
                         {
-                            gp_game->pa_tiles[i * gp_game->cols + j] = TILE_MINE;
+                            set_board_tile(j, i, TILE_MINE);
                         }
                     }
                 }
 
-                gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] = TILE_GAMEOVER_MINE;
+                set_board_tile(tile_x, tile_y, TILE_GAMEOVER_MINE);
                 gp_game->b_running = false;
+                ++gp_game->board_version;
             }
             else if (gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] != TILE_FLAG)
             {
                 open_tile(tile_x, tile_y);
+                ++gp_game->board_version;
 
                 // 남은 타일의 수와 지뢰 개수가 같으면 승리
                 if (gp_game->num_tiles == gp_game->num_max_mines)
@@ -343,25 +521,29 @@ static void update(const float delta_time)
         const int mouse_y = (int)get_mouse_y();
 
         if (mouse_x >= 0 && mouse_x < WINDOW_WIDTH
-            && mouse_y >= INFO_HEIGHT && mouse_y < WINDOW_HEIGHT)
+            && mouse_y >= INFO_AREA_HEIGHT && mouse_y < WINDOW_HEIGHT)
         {
             // 스크린 좌표 -> 타일 좌표 변환
-            const int tile_x = mouse_x / SPRITE_TILE_WIDTH;
-            const int tile_y = (mouse_y - INFO_HEIGHT) / SPRITE_TILE_HEIGHT;
+            const int tile_x = mouse_x / TILE_WIDTH;
+            const int tile_y = (mouse_y - INFO_AREA_HEIGHT) / TILE_HEIGHT;
 
+            // 열린 타일은 바뀌지 않으므로 board_version도 그대로 둠 (디버그 콘솔을 다시 그리지 않음)
             const tile_t tile = gp_game->pa_tiles[tile_y * gp_game->cols + tile_x];
             switch (tile)
             {
             case TILE_BLIND:
                 --gp_game->num_mines;
-                gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] = TILE_FLAG;
+                set_board_tile(tile_x, tile_y, TILE_FLAG);
+                ++gp_game->board_version;
                 break;
             case TILE_FLAG:
                 gp_game->num_mines++;
-                gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] = TILE_UNKNOWN;
+                set_board_tile(tile_x, tile_y, TILE_UNKNOWN);
+                ++gp_game->board_version;
                 break;
             case TILE_UNKNOWN:
-                gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] = TILE_BLIND;
+                set_board_tile(tile_x, tile_y, TILE_BLIND);
+                ++gp_game->board_version;
                 break;
             default:
                 break;
@@ -372,297 +554,139 @@ static void update(const float delta_time)
     }
 }
 
-void draw(void)
+static bool is_key_triggered(const uint8_t key)
 {
-    const int WINDOW_WIDTH = (int)gp_game->p_renderer->vtbl->get_width(gp_game->p_renderer);
-    const int WINDOW_HEIGHT = (int)gp_game->p_renderer->vtbl->get_height(gp_game->p_renderer);
-
-    const int NUM_MINES_DIGIT0_X = SPRITE_NUMBER_WIDTH * 2;
-    const int NUM_MINES_DIGIT0_Y = INFO_HEIGHT / 2 - SPRITE_NUMBER_HEIGHT / 2;
-    const int NUM_MINES_DIGIT1_X = SPRITE_NUMBER_WIDTH * 1;
-    const int NUM_MINES_DIGIT1_Y = INFO_HEIGHT / 2 - SPRITE_NUMBER_HEIGHT / 2;
-    const int NUM_MINES_DIGIT2_X = SPRITE_NUMBER_WIDTH * 0;
-    const int NUM_MINES_DIGIT2_Y = INFO_HEIGHT / 2 - SPRITE_NUMBER_HEIGHT / 2;
-
-    const int TIMER_DIGIT0_X = WINDOW_WIDTH - SPRITE_NUMBER_WIDTH * 1;
-    const int TIMER_DIGIT0_Y = INFO_HEIGHT / 2 - SPRITE_NUMBER_HEIGHT / 2;
-    const int TIMER_DIGIT1_X = WINDOW_WIDTH - SPRITE_NUMBER_WIDTH * 2;
-    const int TIMER_DIGIT1_Y = INFO_HEIGHT / 2 - SPRITE_NUMBER_HEIGHT / 2;
-    const int TIMER_DIGIT2_X = WINDOW_WIDTH - SPRITE_NUMBER_WIDTH * 3;
-    const int TIMER_DIGIT2_Y = INFO_HEIGHT / 2 - SPRITE_NUMBER_HEIGHT / 2;
+    static keyboard_state_t s_prev_key_states[256];
 
-    const int START_TILE_X = 0;
-    const int START_TILE_Y = INFO_HEIGHT;
+    const keyboard_state_t state = get_key_state(key);
+    const bool b_triggered = (state != KEYBOARD_STATE_UP && s_prev_key_states[key] == KEYBOARD_STATE_UP);
+    s_prev_key_states[key] = state;
 
-    const int mouse_x = get_mouse_x();
-    const int mouse_y = get_mouse_y();
-
-    int face_index = 0;
+    return b_triggered;
+}
 
-    gp_game->p_renderer->vtbl->clear(gp_game->p_renderer, argb_to_color(0xffc6c6c6));
+// 캡처 렌더러로 바꿔 끼우므로 draw_game()은 그대로
+static void start_capture(const frame_capture_mode_t mode)
+{
+    i_soft_renderer_t* p_renderer = gp_game->p_renderer;
+    const size_t width = p_renderer->vtbl->get_width(p_renderer);
+    const size_t height = p_renderer->vtbl->get_height(p_renderer);
 
-    // 지뢰 개수 그리기
+    if (!frame_capture_start(&gp_game->frame_capture, "capture.bin", width, height, mode))
     {
-        const char* p_bitmap = gp_game->p_numbers_texture->vtbl->get_bitmap(gp_game->p_numbers_texture);
-        const int bitmap_width = (int)gp_game->p_numbers_texture->vtbl->get_width(gp_game->p_numbers_texture);
-        const int bitmap_height = (int)gp_game->p_numbers_texture->vtbl->get_height(gp_game->p_numbers_texture);
-
-        const int digit0_index = (gp_game->num_mines <= 0) ? 0 : gp_game->num_mines % 10;
-        const int digit1_index = (gp_game->num_mines <= 0) ? 0 : gp_game->num_mines / 10 % 10;
-        const int digit2_index = (gp_game->num_mines <= 0) ? 0 : gp_game->num_mines / 100 % 10;
-
-        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, NUM_MINES_DIGIT0_X, NUM_MINES_DIGIT0_Y,
-                                                digit0_index * SPRITE_NUMBER_WIDTH, 0, SPRITE_NUMBER_WIDTH, SPRITE_NUMBER_HEIGHT,
-                                                (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
-        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, NUM_MINES_DIGIT1_X, NUM_MINES_DIGIT1_Y,
-                                                digit1_index * SPRITE_NUMBER_WIDTH, 0, SPRITE_NUMBER_WIDTH, SPRITE_NUMBER_HEIGHT,
-                                                (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
-        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, NUM_MINES_DIGIT2_X, NUM_MINES_DIGIT2_Y,
-                                                digit2_index * SPRITE_NUMBER_WIDTH, 0, SPRITE_NUMBER_WIDTH, SPRITE_NUMBER_HEIGHT,
-                                                (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
+        return;
     }
 
-    // 타이머 그리기
+    i_soft_renderer_t* p_capture_renderer = NULL;
+    if (!create_capture_renderer(p_renderer, &gp_game->frame_capture, &p_capture_renderer))
     {
-        const char* p_bitmap = gp_game->p_numbers_texture->vtbl->get_bitmap(gp_game->p_numbers_texture);
-        const int bitmap_width = (int)gp_game->p_numbers_texture->vtbl->get_width(gp_game->p_numbers_texture);
-        const int bitmap_height = (int)gp_game->p_numbers_texture->vtbl->get_height(gp_game->p_numbers_texture);
-
-        const int digit0_index = gp_game->game_time % 10;
-        const int digit1_index = gp_game->game_time / 10 % 10;
-        const int digit2_index = gp_game->game_time / 100 % 10;
-
-        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, TIMER_DIGIT0_X, TIMER_DIGIT0_Y,
-                                                digit0_index * SPRITE_NUMBER_WIDTH, 0, SPRITE_NUMBER_WIDTH, SPRITE_NUMBER_HEIGHT,
-                                                (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
-        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, TIMER_DIGIT1_X, TIMER_DIGIT1_Y,
-                                                digit1_index * SPRITE_NUMBER_WIDTH, 0, SPRITE_NUMBER_WIDTH, SPRITE_NUMBER_HEIGHT,
-                                                (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
-        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, TIMER_DIGIT2_X, TIMER_DIGIT2_Y,
-                                                digit2_index * SPRITE_NUMBER_WIDTH, 0, SPRITE_NUMBER_WIDTH, SPRITE_NUMBER_HEIGHT,
-                                                (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
+        frame_capture_stop(&gp_game->frame_capture);
+        return;
     }
 
-    // 타일 그리기
-    // 윈도우 좌표 -> 타일 좌표 변환
-    const int tile_x = mouse_x / SPRITE_TILE_WIDTH;
-    const int tile_y = (mouse_y - INFO_HEIGHT) / SPRITE_TILE_HEIGHT;
-
-    const char* p_bitmap = gp_game->p_tiles_texture->vtbl->get_bitmap(gp_game->p_tiles_texture);
-    const int bitmap_width = (int)gp_game->p_tiles_texture->vtbl->get_width(gp_game->p_tiles_texture);
-    const int bitmap_height = (int)gp_game->p_tiles_texture->vtbl->get_height(gp_game->p_tiles_texture);
+    // 게임이 가진 참조는 p_window_renderer로 옮김
+    gp_game->p_window_renderer = p_renderer;
+    gp_game->p_renderer = p_capture_renderer;
+}
 
-    for (int y = 0; y < gp_game->rows; ++y)
+static void stop_capture(void)
+{
+    if (!gp_game->frame_capture.b_started)
     {
-        for (int x = 0; x < gp_game->cols; ++x)
-        {
-            tile_t tile = gp_game->pa_tiles[y * gp_game->cols + x];
-            if (get_left_mouse_state() == MOUSE_STATE_DOWN && tile_x == x && tile_y == y)
-            {
-                face_index = 2;
-
-                if (gp_game->b_running && tile == TILE_BLIND)
-                {
-                    tile = TILE_OPEN;
-                }
-            }
-
-            switch (tile)
-            {
-            case TILE_BLIND:
-            case TILE_OPEN:
-            case TILE_FLAG:
-            case TILE_UNKNOWN:
-            case TILE_OPEN_UNKNOWN:
-            case TILE_MINE:
-            case TILE_GAMEOVER_MINE:
-            case TILE_FLAG_MINE:
-                if (!gp_game->b_running && gp_game->num_tiles == gp_game->num_max_mines
-                    && tile == TILE_BLIND)
-                {
-                    tile = TILE_FLAG;
-                }
-
-                gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, START_TILE_X + x * SPRITE_TILE_WIDTH, START_TILE_Y + y * SPRITE_TILE_HEIGHT,
-                                                        tile * SPRITE_TILE_WIDTH, 0, SPRITE_TILE_WIDTH, SPRITE_TILE_HEIGHT,
-                                                        (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
-                break;
-            case TILE_1:
-            case TILE_2:
-            case TILE_3:
-            case TILE_4:
-            case TILE_5:
-            case TILE_6:
-            case TILE_7:
-            case TILE_8:
-                gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, START_TILE_X + x * SPRITE_TILE_WIDTH, START_TILE_Y + y * SPRITE_TILE_HEIGHT,
-                                                        (tile - 8) * SPRITE_TILE_WIDTH, SPRITE_TILE_HEIGHT, SPRITE_TILE_WIDTH, SPRITE_TILE_HEIGHT,
-                                                        (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
-                break;
-            default:
-                ASSERT(false, "Invalid tile");
-                break;
-            }
-        }
+        return;
     }
 
-    // 얼굴 그리기
-    {
-        const char* p_bitmap = gp_game->p_faces_texture->vtbl->get_bitmap(gp_game->p_faces_texture);
-        const int bitmap_width = (int)gp_game->p_faces_texture->vtbl->get_width(gp_game->p_faces_texture);
-        const int bitmap_height = (int)gp_game->p_faces_texture->vtbl->get_height(gp_game->p_faces_texture);
-
-        if (get_left_mouse_state() == MOUSE_STATE_DOWN
-            && mouse_x >= gp_game->face_x && mouse_x <= gp_game->face_x + SPRITE_FACE_WIDTH
-            && mouse_y >= gp_game->face_y && mouse_y <= gp_game->face_y + SPRITE_FACE_HEIGHT)
-        {
-            face_index = 1;
-        }
-
-        if (!gp_game->b_running)
-        {
-            face_index = (gp_game->num_tiles == gp_game->num_max_mines) ? 3 : 4;
-        }
-
-        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, gp_game->face_x, gp_game->face_y,
-                                                face_index * SPRITE_FACE_WIDTH, 0, SPRITE_FACE_WIDTH, SPRITE_FACE_HEIGHT,
-                                                (uint32_t*)p_bitmap, bitmap_width, bitmap_height);
-    }
+    SAFE_RELEASE(gp_game->p_renderer);
+    gp_game->p_renderer = gp_game->p_window_renderer;
+    gp_game->p_window_renderer = NULL;
 
-    gp_game->p_renderer->vtbl->on_draw(gp_game->p_renderer);
+    frame_capture_stop(&gp_game->frame_capture);
 }
 
-static void print_info(void)
+static bool acquire_sprite_atlas(void)
 {
-    gotoxy(0, 0);
-    for (int y = 0; y < gp_game->rows; ++y)
+    // 타일 로드
+    if (!wait_sprite_texture(s_tiles_handle, &g_embedded_tiles_sprite, &s_tiles_texture, &gp_game->p_tiles_texture))
     {
-        for (int x = 0; x < gp_game->cols; ++x)
-        {
-            printf("%c ", gp_game->pa_mines[y * gp_game->cols + x] == true ? 'o' : '.');
-        }
-        printf("\n");
+        goto failed_load;
     }
-    printf("\n");
-}
 
-static void make_mine(bool* p_mines, const int rows, const int cols, const int num_mines)
-{
-    ASSERT(p_mines != NULL, "p_mines == NULL");
-
-    int count = 0;
-    while (count != num_mines)
+    // 숫자 로드
+    if (!wait_sprite_texture(s_numbers_handle, &g_embedded_numbers_sprite, &s_numbers_texture, &gp_game->p_numbers_texture))
     {
-        const int index = rand() % (rows * cols);
-        
-        if (p_mines[index])
-        {
-            continue;
-        }
-
-        p_mines[index] = true;
-
-        ++count;
+        goto failed_load;
     }
-}
-
-static bool is_valid_position(const int x, const int y)
-{
-    return (x >= 0 && x < gp_game->cols
-            && y >= 0 && y < gp_game->rows);
-}
 
-static void open_tile(const int x, const int y)
-{
-    // 재귀 깊이 근사값
-    // (rows * cols - num_max_mines) * 8
+    // 얼굴 로드
+    if (!wait_sprite_texture(s_faces_handle, &g_embedded_faces_sprite, &s_faces_texture, &gp_game->p_faces_texture))
+    {
+        goto failed_load;
+    }
 
-    int stack_index = 0;
-    int* stack_x = (int*)malloc(sizeof(int) * (gp_game->rows * gp_game->cols - gp_game->num_max_mines) * 8);
-    int* stack_y = (int*)malloc(sizeof(int) * (gp_game->rows * gp_game->cols - gp_game->num_max_mines) * 8);
-    ASSERT(stack_x != NULL, "Failed to malloc stack_x");
-    ASSERT(stack_y != NULL, "Failed to malloc stack_y");
+    startup_mark(STARTUP_PHASE_ASSET_WAIT);
 
-    stack_x[stack_index] = x;
-    stack_y[stack_index] = y;
-    ++stack_index;
+    // 로드할 에셋이 더 없으므로 워커 종료
+    asset_loader_shutdown(&s_asset_loader);
 
-    while (stack_index > 0)
+    // 아틀라스로 복사했으므로 텍스쳐는 더 필요 없음
+    if (!sprite_atlas_build(&gp_game->sprite_atlas,
+                            gp_game->p_tiles_texture, gp_game->p_numbers_texture, gp_game->p_faces_texture))
     {
-        --stack_index;
-        const int tile_x = stack_x[stack_index];
-        const int tile_y = stack_y[stack_index];
-
-        if (!is_valid_position(tile_x, tile_y))
-        {
-            continue;
-        }
+        ASSERT(false, "Failed to build sprite atlas");
+        goto failed_load;
+    }
 
-        const tile_t tile = gp_game->pa_tiles[tile_y * gp_game->cols + tile_x];
-        if (tile != TILE_BLIND && tile != TILE_FLAG && tile != TILE_UNKNOWN)
-        {
-            continue;
-        }
+    SAFE_RELEASE(gp_game->p_tiles_texture);
+    SAFE_RELEASE(gp_game->p_numbers_texture);
+    SAFE_RELEASE(gp_game->p_faces_texture);
 
-        int count = 0;
-        count += (is_valid_position(tile_x, tile_y - 1) && gp_game->pa_mines[(tile_y - 1) * gp_game->cols + tile_x]);
-        count += (is_valid_position(tile_x, tile_y + 1) && gp_game->pa_mines[(tile_y + 1) * gp_game->cols + tile_x]);
-        count += (is_valid_position(tile_x - 1, tile_y) && gp_game->pa_mines[tile_y * gp_game->cols + (tile_x - 1)]);
-        count += (is_valid_position(tile_x + 1, tile_y) && gp_game->pa_mines[tile_y * gp_game->cols + (tile_x + 1)]);
-        count += (is_valid_position(tile_x - 1, tile_y - 1) && gp_game->pa_mines[(tile_y - 1) * gp_game->cols + (tile_x - 1)]);
-        count += (is_valid_position(tile_x + 1, tile_y - 1) && gp_game->pa_mines[(tile_y - 1) * gp_game->cols + (tile_x + 1)]);
-        count += (is_valid_position(tile_x - 1, tile_y + 1) && gp_game->pa_mines[(tile_y + 1) * gp_game->cols + (tile_x - 1)]);
-        count += (is_valid_position(tile_x + 1, tile_y + 1) && gp_game->pa_mines[(tile_y + 1) * gp_game->cols + (tile_x + 1)]);
-
-        if (gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] == TILE_FLAG)
+    // 확대 모드면 여기서 한 번만 확대하고 원본 아틀라스는 버림 (프레임마다 확대하지 않음)
+    if (gp_game->scale > 1)
+    {
+        sprite_atlas_t scaled_atlas;
+        if (!sprite_atlas_build_scaled(&scaled_atlas, &gp_game->sprite_atlas, gp_game->scale))
         {
-            ++gp_game->num_mines;
+            ASSERT(false, "Failed to build scaled sprite atlas");
+            goto failed_load;
         }
 
-        if (count == 0)
-        {
-            gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] = TILE_OPEN;
-
-            stack_x[stack_index] = tile_x;
-            stack_y[stack_index] = tile_y - 1;
-            ++stack_index;
-
-            stack_x[stack_index] = tile_x;
-            stack_y[stack_index] = tile_y + 1;
-            ++stack_index;
-
-            stack_x[stack_index] = tile_x - 1;
-            stack_y[stack_index] = tile_y;
-            ++stack_index;
+        sprite_atlas_release(&gp_game->sprite_atlas);
+        gp_game->sprite_atlas = scaled_atlas;
+    }
 
-            stack_x[stack_index] = tile_x + 1;
-            stack_y[stack_index] = tile_y;
-            ++stack_index;
+    // 타일이 16색을 넘는 테마면 팔레트 보드 없이 ARGB 경로만 사용
+    gp_game->b_palette_board_available = palette_board_init(&gp_game->palette_board, &gp_game->sprite_atlas,
+                                                            gp_game->rows, gp_game->cols, BACKGROUND_ARGB);
 
-            stack_x[stack_index] = tile_x - 1;
-            stack_y[stack_index] = tile_y - 1;
-            ++stack_index;
+    return true;
 
-            stack_x[stack_index] = tile_x + 1;
-            stack_y[stack_index] = tile_y - 1;
-            ++stack_index;
+failed_load:
+    // 확대 전 아틀라스가 남아 있으면 다음 틱이 로드된 것으로 보므로 함께 해제
+    sprite_atlas_release(&gp_game->sprite_atlas);
+    SAFE_RELEASE(gp_game->p_tiles_texture);
+    SAFE_RELEASE(gp_game->p_numbers_texture);
+    SAFE_RELEASE(gp_game->p_faces_texture);
+    return false;
+}
 
-            stack_x[stack_index] = tile_x - 1;
-            stack_y[stack_index] = tile_y + 1;
-            ++stack_index;
+static asset_handle_t load_sprite_texture_async(const char* sprite_directory, const char* filename)
+{
+    char path[MAX_PATH];
+    snprintf(path, sizeof(path), "%s/%s", sprite_directory, filename);
 
-            stack_x[stack_index] = tile_x + 1;
-            stack_y[stack_index] = tile_y + 1;
-            ++stack_index;
-        }
-        else
-        {
-            gp_game->pa_tiles[tile_y * gp_game->cols + tile_x] = TILE_1 + count - 1;
-        }
+    return asset_loader_load_texture_async(&s_asset_loader, path);
+}
 
-        --gp_game->num_tiles;
+static bool wait_sprite_texture(const asset_handle_t handle,
+                                const embedded_sprite_t* p_embedded_sprite, static_texture_t* p_static_texture,
+                                i_texture_t** pp_out_texture)
+{
+    if (handle == ASSET_HANDLE_INVALID)
+    {
+        init_static_texture(p_static_texture, p_embedded_sprite->width, p_embedded_sprite->height, p_embedded_sprite->p_pixels);
+        *pp_out_texture = &p_static_texture->base;
+        return true;
     }
 
-    free(stack_x);
-    free(stack_y);
+    return asset_loader_wait_texture(&s_asset_loader, handle, pp_out_texture);
 }
\ No newline at end of file
@@ -16,6 +16,13 @@
 #include "safe99_common/defines.h"
 #include "safe99_soft_renderer/i_soft_renderer.h"
 #include "safe99_file_system/i_file_system.h"
+#include "safe99_generic/util/timer.h"
+#include "bitmap_font.h"
+#include "frame_capture.h"
+#include "minimap.h"
+#include "palette_board.h"
+#include "sprite_atlas.h"
+#include "text_cache.h"
 
 #define SPRITE_TILE_WIDTH 16
 #define SPRITE_TILE_HEIGHT 16
@@ -26,6 +33,22 @@
 
 #define INFO_HEIGHT 48
 
+// 정수배 확대 (스프라이트, 정보 영역, 마우스 좌표 모두 scale배)
+// 환경 변수 GAME_SCALE_ENV가 없으면 모니터 높이로 정함 (1080p 1배, 4K 2배)
+#define GAME_SCALE_ENV "MINESWEEPER_SCALE"
+#define GAME_NUM_MAX_SCALE 4
+
+#define BACKGROUND_ARGB 0xffc6c6c6
+
+// 기본 테마는 실행 파일에 포함된 스프라이트 (embedded_sprites.h)
+// 환경 변수 SPRITE_DIRECTORY_ENV가 있으면 그 디렉터리의 DDS 파일로 대체
+#define SPRITE_DIRECTORY_ENV "MINESWEEPER_SPRITE_DIR"
+// 경로 구분자는 Windows와 Linux 모두 받아들이는 /
+#define SPRITE_DEFAULT_DIRECTORY "../../sprite"
+#define SPRITE_TILES_FILENAME "tiles.dds"
+#define SPRITE_NUMBERS_FILENAME "numbers.dds"
+#define SPRITE_FACES_FILENAME "faces.dds"
+
 typedef enum tile
 {
     TILE_BLIND,
@@ -48,19 +71,28 @@ typedef enum tile
 
 typedef struct game
 {
+#if defined(_WIN32)
     // DLL 핸들
     HINSTANCE h_renderer_dll;
     HINSTANCE h_file_system_dll;
+#endif // _WIN32
 
     // DLL 인스턴스
     i_soft_renderer_t* p_renderer;
     i_file_system_t* p_file_system;
 
     // 프레임
-    timer_t frame_timer;
+    safe99_timer_t frame_timer;
     float update_ticks_per_frame;
     int fps;
 
+    // 확대 배율 (1 ~ GAME_NUM_MAX_SCALE)
+    int scale;
+
+    // 디버그
+    bool b_latency_overlay;
+    bool b_profiler_overlay;
+
     // 지뢰찾기
     bool b_running;
     int rows;
@@ -71,6 +103,12 @@ typedef struct game
     bool* pa_mines;
     tile_t* pa_tiles;
 
+    // pa_mines, pa_tiles가 바뀔 때마다 증가
+    uint32_t board_version;
+
+    // 지뢰 배치 난수 상태 (next_board_random())
+    uint64_t random_state;
+
     // 가운데 얼굴 위치
     int face_x;
     int face_y;
@@ -79,23 +117,50 @@ typedef struct game
     bool b_right_mouse_pressed;
 
     // 게임 타이머
-    timer_t game_timer;
+    safe99_timer_t game_timer;
     int game_time;
 
     // 텍스쳐
     i_texture_t* p_tiles_texture;
     i_texture_t* p_numbers_texture;
     i_texture_t* p_faces_texture;
+
+    // 그리기는 텍스쳐 대신 아틀라스만 사용 (scale > 1이면 로드 시점에 확대해 둔 아틀라스)
+    sprite_atlas_t sprite_atlas;
+
+    // 보드 타일을 팔레트 인덱스로 그림 (F6, 타일이 16색 이하일 때만)
+    palette_board_t palette_board;
+    bool b_palette_board_available;
+    bool b_palette_board;
+
+    // 보드 미니맵 (F7), 타일은 set_board_tile()로만 바꿔야 미니맵이 따라감
+    minimap_t minimap;
+    bool b_minimap;
+
+    // 오버레이 텍스트 (GDI draw_text 대신 scale배 비트맵 폰트 + 문자열 캐시)
+    bitmap_font_t font;
+    text_cache_t text_cache;
+
+    // 녹화 (F8 델타, Shift + F8 원본), 녹화 중에는 p_renderer가 원래 렌더러를 감싼 캡처 렌더러
+    frame_capture_t frame_capture;
+    i_soft_renderer_t* p_window_renderer;
 } game_t;
 
-game_t* gp_game;
+// game_draw.c
+extern game_t* gp_game;
 
 START_EXTERN_C
 
-bool init_game(const int rows, const int cols, const int num_mines);
+// 창 생성 전에 호출, 스프라이트를 워커에서 로드하기 시작함
+bool begin_load_game_assets(void);
+
+bool init_game(const int rows, const int cols, const int num_mines, const int scale);
 void shutdown_game(void);
 void tick_game(void);
 
+// game_draw.c
+void draw_game(void);
+
 FORCEINLINE bool is_running_game(void)
 {
     return gp_game->b_running;
@@ -0,0 +1,258 @@
+﻿//***************************************************************************
+// 
+// 파일: game_draw.c
+// 
+// 설명: 게임 그리기
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// Win32 API (창, 입력 메시지, DLL 로드)를 쓰지 않으므로 Linux에서도 빌드됨
+// 창이 있는 게임 (game.c)과 헤드리스 렌더러를 쓰는 벤치마크가 같은 draw_game()을 사용
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "game.h"
+
+// 전역 변수
+game_t* gp_game;
+
+// 전역 함수
+static void draw_latency_overlay(void);
+static void draw_sprite(const atlas_sprite_t* p_sprite, const int x, const int y);
+
+// 배경색 BACKGROUND_ARGB (매 프레임 argb_to_color()로 변환하지 않도록 상수로 둠)
+static const color_t s_background_color = { { { 198.0f / 255.0f, 198.0f / 255.0f, 198.0f / 255.0f, 1.0f } } };
+
+void draw_game(void)
+{
+    const int WINDOW_WIDTH = (int)gp_game->p_renderer->vtbl->get_width(gp_game->p_renderer);
+
+    // 아틀라스가 이미 확대되어 있으므로 배치만 scale배
+    const int SCALE = gp_game->scale;
+    const int TILE_WIDTH = SPRITE_TILE_WIDTH * SCALE;
+    const int TILE_HEIGHT = SPRITE_TILE_HEIGHT * SCALE;
+    const int NUMBER_WIDTH = SPRITE_NUMBER_WIDTH * SCALE;
+    const int FACE_WIDTH = SPRITE_FACE_WIDTH * SCALE;
+    const int FACE_HEIGHT = SPRITE_FACE_HEIGHT * SCALE;
+    const int INFO_AREA_HEIGHT = INFO_HEIGHT * SCALE;
+    const int DIGIT_Y = (INFO_HEIGHT / 2 - SPRITE_NUMBER_HEIGHT / 2) * SCALE;
+
+    const int NUM_MINES_DIGIT0_X = NUMBER_WIDTH * 2;
+    const int NUM_MINES_DIGIT0_Y = DIGIT_Y;
+    const int NUM_MINES_DIGIT1_X = NUMBER_WIDTH * 1;
+    const int NUM_MINES_DIGIT1_Y = DIGIT_Y;
+    const int NUM_MINES_DIGIT2_X = NUMBER_WIDTH * 0;
+    const int NUM_MINES_DIGIT2_Y = DIGIT_Y;
+
+    const int TIMER_DIGIT0_X = WINDOW_WIDTH - NUMBER_WIDTH * 1;
+    const int TIMER_DIGIT0_Y = DIGIT_Y;
+    const int TIMER_DIGIT1_X = WINDOW_WIDTH - NUMBER_WIDTH * 2;
+    const int TIMER_DIGIT1_Y = DIGIT_Y;
+    const int TIMER_DIGIT2_X = WINDOW_WIDTH - NUMBER_WIDTH * 3;
+    const int TIMER_DIGIT2_Y = DIGIT_Y;
+
+    const int START_TILE_X = 0;
+    const int START_TILE_Y = INFO_AREA_HEIGHT;
+
+    const int mouse_x = get_mouse_x();
+    const int mouse_y = get_mouse_y();
+
+    int face_index = 0;
+
+    PROFILE_BEGIN("draw");
+
+    text_cache_begin_frame(&gp_game->text_cache);
+
+    gp_game->p_renderer->vtbl->clear(gp_game->p_renderer, s_background_color);
+
+    const sprite_atlas_t* p_atlas = &gp_game->sprite_atlas;
+
+    // 지뢰 개수 그리기
+    {
+        const int digit0_index = (gp_game->num_mines <= 0) ? 0 : gp_game->num_mines % 10;
+        const int digit1_index = (gp_game->num_mines <= 0) ? 0 : gp_game->num_mines / 10 % 10;
+        const int digit2_index = (gp_game->num_mines <= 0) ? 0 : gp_game->num_mines / 100 % 10;
+
+        draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_DIGIT + digit0_index), NUM_MINES_DIGIT0_X, NUM_MINES_DIGIT0_Y);
+        draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_DIGIT + digit1_index), NUM_MINES_DIGIT1_X, NUM_MINES_DIGIT1_Y);
+        draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_DIGIT + digit2_index), NUM_MINES_DIGIT2_X, NUM_MINES_DIGIT2_Y);
+    }
+
+    // 타이머 그리기
+    {
+        const int digit0_index = gp_game->game_time % 10;
+        const int digit1_index = gp_game->game_time / 10 % 10;
+        const int digit2_index = gp_game->game_time / 100 % 10;
+
+        draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_DIGIT + digit0_index), TIMER_DIGIT0_X, TIMER_DIGIT0_Y);
+        draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_DIGIT + digit1_index), TIMER_DIGIT1_X, TIMER_DIGIT1_Y);
+        draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_DIGIT + digit2_index), TIMER_DIGIT2_X, TIMER_DIGIT2_Y);
+    }
+
+    // 타일 그리기
+    // 윈도우 좌표 -> 타일 좌표 변환
+    const int tile_x = mouse_x / TILE_WIDTH;
+    const int tile_y = (mouse_y - INFO_AREA_HEIGHT) / TILE_HEIGHT;
+
+    const bool b_tile_pressed = get_left_mouse_state() == MOUSE_STATE_DOWN
+                                && tile_x >= 0 && tile_x < gp_game->cols && tile_y >= 0 && tile_y < gp_game->rows;
+    if (b_tile_pressed)
+    {
+        face_index = 2;
+    }
+
+    const bool b_won = !gp_game->b_running && gp_game->num_tiles == gp_game->num_max_mines;
+
+    // 팔레트 보드는 화면에 보이는 타일이 지난 프레임과 같으면 타일 루프를 건너뜀
+    // 보이는 타일은 board_version, 누른 타일 (누른 타일은 게임 중에만 열린 모양), 승리 여부로 정해짐
+    bool b_draw_tiles = true;
+    if (gp_game->b_palette_board)
+    {
+        const uint64_t pressed_index = (b_tile_pressed && gp_game->b_running) ? (uint64_t)(tile_y * gp_game->cols + tile_x) + 1 : 0;
+        const uint64_t state = (uint64_t)gp_game->board_version | pressed_index << 32 | (uint64_t)b_won << 63;
+        b_draw_tiles = palette_board_begin_update(&gp_game->palette_board, state);
+    }
+
+    for (int y = 0; y < gp_game->rows && b_draw_tiles; ++y)
+    {
+        for (int x = 0; x < gp_game->cols; ++x)
+        {
+            tile_t tile = gp_game->pa_tiles[y * gp_game->cols + x];
+            if (b_tile_pressed && gp_game->b_running && tile_x == x && tile_y == y && tile == TILE_BLIND)
+            {
+                tile = TILE_OPEN;
+            }
+
+            if (b_won && tile == TILE_BLIND)
+            {
+                tile = TILE_FLAG;
+            }
+
+            ASSERT(tile >= TILE_BLIND && tile <= TILE_8, "Invalid tile");
+            if (gp_game->b_palette_board)
+            {
+                palette_board_set_tile(&gp_game->palette_board, x, y, tile);
+                continue;
+            }
+
+            draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_TILE + tile),
+                        START_TILE_X + x * TILE_WIDTH, START_TILE_Y + y * TILE_HEIGHT);
+        }
+    }
+
+    // 바뀐 타일만 ARGB로 확장한 뒤 보드 전체를 한 번에 그림
+    // 위에서 clear()로 프레임 버퍼 전체를 지웠으므로 바뀐 구간만 블릿하면 나머지 보드가 배경색으로 남음
+    if (gp_game->b_palette_board)
+    {
+        palette_board_t* p_board = &gp_game->palette_board;
+        palette_board_resolve(p_board);
+
+        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, START_TILE_X, START_TILE_Y,
+                                                0, 0, p_board->width, p_board->height,
+                                                p_board->pa_pixels, p_board->width, p_board->height);
+    }
+
+    // 얼굴 그리기
+    {
+        if (get_left_mouse_state() == MOUSE_STATE_DOWN
+            && mouse_x >= gp_game->face_x && mouse_x <= gp_game->face_x + FACE_WIDTH
+            && mouse_y >= gp_game->face_y && mouse_y <= gp_game->face_y + FACE_HEIGHT)
+        {
+            face_index = 1;
+        }
+
+        if (!gp_game->b_running)
+        {
+            face_index = (gp_game->num_tiles == gp_game->num_max_mines) ? 3 : 4;
+        }
+
+        draw_sprite(sprite_atlas_get(p_atlas, SPRITE_ID_FACE + face_index), gp_game->face_x, gp_game->face_y);
+    }
+
+    // 미니맵은 바뀐 타일만 갱신되어 있으므로 그리기만 함
+    if (gp_game->b_minimap)
+    {
+        const minimap_t* p_minimap = &gp_game->minimap;
+        gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer,
+                                                WINDOW_WIDTH - p_minimap->width - 4, INFO_AREA_HEIGHT + 4,
+                                                0, 0, p_minimap->width, p_minimap->height,
+                                                p_minimap->pa_pixels, p_minimap->width, p_minimap->height);
+    }
+
+    if (gp_game->b_latency_overlay)
+    {
+        draw_latency_overlay();
+    }
+
+    if (gp_game->b_profiler_overlay)
+    {
+        profiler_draw_overlay(gp_game->p_renderer, 4, INFO_AREA_HEIGHT + gp_game->font.glyph_height * 3 + 8, 64);
+    }
+
+    PROFILE_END();
+
+    PROFILE_BEGIN("on_draw");
+    gp_game->p_renderer->vtbl->on_draw(gp_game->p_renderer);
+    PROFILE_END();
+
+    latency_end_frame();
+}
+
+static void draw_latency_overlay(void)
+{
+    latency_stats_t stats;
+    latency_get_stats(&stats);
+
+    // p50 등은 프레임마다 바뀌지만 fps 줄은 1초에 한 번 바뀌므로 대부분 캐시 적중
+    char text[TEXT_CACHE_MAX_LENGTH];
+    const int x = 4;
+    int y = INFO_HEIGHT * gp_game->scale + 4;
+
+    int length = snprintf(text, sizeof(text), "fps %d", gp_game->fps);
+    if (length > 0)
+    {
+        length = MIN(length, (int)sizeof(text) - 1);
+        draw_sprite(text_cache_get_sprite(&gp_game->text_cache, text, (size_t)length, 0xffff0000), x, y);
+        y += gp_game->font.glyph_height;
+    }
+
+    length = snprintf(text, sizeof(text),
+                      "input->present p50 %.2fms p99 %.2fms max %.2fms (n=%zu)",
+                      stats.p50, stats.p99, stats.max, stats.num_samples);
+    if (length > 0)
+    {
+        length = MIN(length, (int)sizeof(text) - 1);
+        draw_sprite(text_cache_get_sprite(&gp_game->text_cache, text, (size_t)length, 0xffff0000), x, y);
+        y += gp_game->font.glyph_height;
+    }
+
+    if (gp_game->frame_capture.b_started)
+    {
+        frame_capture_stats_t capture_stats;
+        frame_capture_get_stats(&gp_game->frame_capture, &capture_stats);
+
+        const double dropped_percent = (capture_stats.num_frames > 0)
+            ? 100.0 * (double)capture_stats.num_dropped_frames / (double)capture_stats.num_frames : 0.0;
+
+        length = snprintf(text, sizeof(text),
+                          "capture avg %.3fms max %.3fms dropped %zu/%zu (%.1f%%)",
+                          capture_stats.average_capture_ms, capture_stats.max_capture_ms,
+                          capture_stats.num_dropped_frames, capture_stats.num_frames, dropped_percent);
+        if (length > 0)
+        {
+            length = MIN(length, (int)sizeof(text) - 1);
+            draw_sprite(text_cache_get_sprite(&gp_game->text_cache, text, (size_t)length, 0xffff0000), x, y);
+        }
+    }
+}
+
+// 스프라이트가 연속 블록이므로 원점 (0, 0), pitch == width로 그림
+static void draw_sprite(const atlas_sprite_t* p_sprite, const int x, const int y)
+{
+    gp_game->p_renderer->vtbl->draw_bitmap(gp_game->p_renderer, x, y,
+                                            0, 0, p_sprite->width, p_sprite->height,
+                                            p_sprite->p_pixels, p_sprite->width, p_sprite->height);
+}
\ No newline at end of file
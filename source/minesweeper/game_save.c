@@ -0,0 +1,396 @@
+﻿//***************************************************************************
+// 
+// 파일: game_save.c
+// 
+// 설명: 게임 상태 바이너리 저장/불러오기
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "game_save.h"
+#include "board.h"
+#include "mapped_file.h"
+#include "safe99_generic/util/hash_function.h"
+
+// 구역 시작은 8바이트 정렬
+#define SECTION_ALIGN(size) (((size) + 7) & ~(uint64_t)7)
+
+// rows x cols가 int 범위를 넘지 않도록
+#define GAME_SAVE_NUM_MAX_TILES (1 << 30)
+
+static bool replace_file(const char* src_filename, const char* dst_filename);
+static bool open_game_save(mapped_file_t* p_file, const char* filename, const game_save_header_t** pp_out_header);
+static uint64_t get_header_hash(const game_save_header_t* p_header);
+static uint64_t hash_section(const char* p_section, const size_t size, uint64_t seed);
+
+static void pack_mines(const bool* p_mines, const size_t num_tiles, uint8_t* p_out_bits);
+static void unpack_mines(const uint8_t* p_bits, const size_t num_tiles, bool* p_out_mines);
+static void pack_tiles(const tile_t* p_tiles, const size_t num_tiles, uint8_t* p_out_nibbles);
+static void unpack_tiles(const uint8_t* p_nibbles, const size_t num_tiles, tile_t* p_out_tiles);
+
+bool save_game(const char* filename)
+{
+    ASSERT(filename != NULL, "filename == NULL");
+    ASSERT(sizeof(tile_t) == sizeof(int32_t), "tile_t size");
+
+    const size_t num_tiles = (size_t)gp_game->rows * gp_game->cols;
+
+    game_save_header_t header;
+    memset(&header, 0, sizeof(game_save_header_t));
+
+    header.magic = GAME_SAVE_MAGIC;
+    header.version = GAME_SAVE_VERSION;
+    header.header_size = sizeof(game_save_header_t);
+    header.flags = gp_game->b_running ? GAME_SAVE_FLAG_RUNNING : 0;
+    header.rows = gp_game->rows;
+    header.cols = gp_game->cols;
+    header.num_max_mines = gp_game->num_max_mines;
+    header.num_mines = gp_game->num_mines;
+    header.num_tiles = gp_game->num_tiles;
+    header.game_time = gp_game->game_time;
+    header.random_state = gp_game->random_state;
+    header.mines_offset = SECTION_ALIGN(sizeof(game_save_header_t));
+    header.mines_size = (num_tiles + 7) / 8;
+    header.tiles_offset = header.mines_offset + SECTION_ALIGN(header.mines_size);
+    header.tiles_size = (num_tiles + 1) / 2;
+
+    // 보드 전체를 담는 버퍼 대신 청크 하나를 재사용 (캐시에 남아 있는 버퍼에 묶고 해시하고 씀)
+    uint8_t* pa_chunk = (uint8_t*)malloc(GAME_SAVE_CHUNK_SIZE);
+    if (pa_chunk == NULL)
+    {
+        ASSERT(false, "Failed to malloc save chunk");
+        return false;
+    }
+
+    // 임시 파일에 다 쓴 뒤 원래 파일을 바꿈 (쓰다가 실패하거나 종료돼도 이전 저장은 그대로 남음)
+    char temp_filename[MAX_PATH];
+    if (snprintf(temp_filename, sizeof(temp_filename), "%s.tmp", filename) >= (int)sizeof(temp_filename))
+    {
+        free(pa_chunk);
+        return false;
+    }
+
+    FILE* p_file = fopen(temp_filename, "wb");
+    if (p_file == NULL)
+    {
+        free(pa_chunk);
+        return false;
+    }
+
+    static const uint8_t s_zeros[8] = { 0, };
+    uint64_t checksum = get_header_hash(&header);
+    bool b_saved = true;
+
+    // 체크섬을 모르므로 헤더 자리만 먼저 씀
+    b_saved = b_saved && (fwrite(&header, sizeof(game_save_header_t), 1, p_file) == 1);
+    b_saved = b_saved && (fwrite(s_zeros, 1, (size_t)(header.mines_offset - sizeof(game_save_header_t)), p_file) == header.mines_offset - sizeof(game_save_header_t));
+
+    const size_t num_tiles_per_mine_chunk = GAME_SAVE_CHUNK_SIZE * 8;
+    for (size_t first = 0; first < num_tiles && b_saved; first += num_tiles_per_mine_chunk)
+    {
+        const size_t count = MIN(num_tiles_per_mine_chunk, num_tiles - first);
+        const size_t size = (count + 7) / 8;
+
+        pack_mines(gp_game->pa_mines + first, count, pa_chunk);
+        checksum = hash64_wyhash_seed((const char*)pa_chunk, size, checksum);
+        b_saved = (fwrite(pa_chunk, 1, size, p_file) == size);
+    }
+
+    const size_t num_padding_bytes = (size_t)(header.tiles_offset - header.mines_offset - header.mines_size);
+    b_saved = b_saved && (fwrite(s_zeros, 1, num_padding_bytes, p_file) == num_padding_bytes);
+
+    const size_t num_tiles_per_tile_chunk = GAME_SAVE_CHUNK_SIZE * 2;
+    for (size_t first = 0; first < num_tiles && b_saved; first += num_tiles_per_tile_chunk)
+    {
+        const size_t count = MIN(num_tiles_per_tile_chunk, num_tiles - first);
+        const size_t size = (count + 1) / 2;
+
+        pack_tiles(gp_game->pa_tiles + first, count, pa_chunk);
+        checksum = hash64_wyhash_seed((const char*)pa_chunk, size, checksum);
+        b_saved = (fwrite(pa_chunk, 1, size, p_file) == size);
+    }
+
+    header.checksum = checksum;
+    b_saved = b_saved && (fseek(p_file, 0, SEEK_SET) == 0);
+    b_saved = b_saved && (fwrite(&header, sizeof(game_save_header_t), 1, p_file) == 1);
+    b_saved = b_saved && (fflush(p_file) == 0);
+    b_saved = (fclose(p_file) == 0) && b_saved;
+    b_saved = b_saved && replace_file(temp_filename, filename);
+
+    if (!b_saved)
+    {
+        remove(temp_filename);
+    }
+
+    free(pa_chunk);
+    return b_saved;
+}
+
+bool load_game(const char* filename)
+{
+    ASSERT(filename != NULL, "filename == NULL");
+
+    mapped_file_t file;
+    const game_save_header_t* p_header;
+    if (!open_game_save(&file, filename, &p_header))
+    {
+        return false;
+    }
+
+    if (p_header->rows != gp_game->rows || p_header->cols != gp_game->cols)
+    {
+        goto failed_load;
+    }
+
+    // 게임 상태를 바꾸기 전에 전체를 검사
+    uint64_t checksum = get_header_hash(p_header);
+    checksum = hash_section(file.p_data + p_header->mines_offset, (size_t)p_header->mines_size, checksum);
+    checksum = hash_section(file.p_data + p_header->tiles_offset, (size_t)p_header->tiles_size, checksum);
+    if (checksum != p_header->checksum)
+    {
+        goto failed_load;
+    }
+
+    const size_t num_tiles = (size_t)gp_game->rows * gp_game->cols;
+    unpack_mines((const uint8_t*)file.p_data + p_header->mines_offset, num_tiles, gp_game->pa_mines);
+    unpack_tiles((const uint8_t*)file.p_data + p_header->tiles_offset, num_tiles, gp_game->pa_tiles);
+
+    gp_game->b_running = (p_header->flags & GAME_SAVE_FLAG_RUNNING) != 0;
+    gp_game->num_max_mines = p_header->num_max_mines;
+    gp_game->num_mines = p_header->num_mines;
+    gp_game->num_tiles = p_header->num_tiles;
+    gp_game->game_time = p_header->game_time;
+    gp_game->random_state = p_header->random_state;
+
+    // 타일을 set_board_tile()로 하나씩 바꾸지 않았으므로 미니맵은 한 번에 다시 만듦
+    minimap_rebuild(&gp_game->minimap, (const int*)gp_game->pa_tiles);
+    ++gp_game->board_version;
+
+    mapped_file_close(&file);
+    return true;
+
+failed_load:
+    mapped_file_close(&file);
+    return false;
+}
+
+bool peek_game_save(const char* filename, int* p_out_rows, int* p_out_cols, int* p_out_num_max_mines)
+{
+    ASSERT(filename != NULL, "filename == NULL");
+    ASSERT(p_out_rows != NULL, "p_out_rows == NULL");
+    ASSERT(p_out_cols != NULL, "p_out_cols == NULL");
+    ASSERT(p_out_num_max_mines != NULL, "p_out_num_max_mines == NULL");
+
+    mapped_file_t file;
+    const game_save_header_t* p_header;
+    if (!open_game_save(&file, filename, &p_header))
+    {
+        return false;
+    }
+
+    *p_out_rows = p_header->rows;
+    *p_out_cols = p_header->cols;
+    *p_out_num_max_mines = p_header->num_max_mines;
+
+    mapped_file_close(&file);
+    return true;
+}
+
+// 원래 파일이 있으면 덮어씀
+static bool replace_file(const char* src_filename, const char* dst_filename)
+{
+#if defined(_WIN32)
+    return MoveFileExA(src_filename, dst_filename, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != FALSE;
+#else
+    return rename(src_filename, dst_filename) == 0;
+#endif // _WIN32
+}
+
+// 헤더 값과 구역 범위만 검사 (체크섬은 불러올 때)
+static bool open_game_save(mapped_file_t* p_file, const char* filename, const game_save_header_t** pp_out_header)
+{
+    if (!mapped_file_open(p_file, filename))
+    {
+        return false;
+    }
+
+    if (p_file->size < sizeof(game_save_header_t))
+    {
+        goto failed_open;
+    }
+
+    // 매핑 시작 주소는 페이지 정렬이므로 헤더를 그대로 읽음
+    const game_save_header_t* p_header = (const game_save_header_t*)p_file->p_data;
+    if (p_header->magic != GAME_SAVE_MAGIC
+        || p_header->version != GAME_SAVE_VERSION
+        || p_header->header_size != sizeof(game_save_header_t))
+    {
+        goto failed_open;
+    }
+
+    if (p_header->rows <= 0 || p_header->cols <= 0
+        || (int64_t)p_header->rows * p_header->cols > GAME_SAVE_NUM_MAX_TILES
+        || p_header->num_max_mines <= 0 || p_header->num_max_mines >= p_header->rows * p_header->cols)
+    {
+        goto failed_open;
+    }
+
+    // num_mines는 지뢰 수 - 깃발 수 (깃발이 더 많으면 음수), num_tiles는 아직 열지 않은 타일 수
+    const int32_t num_board_tiles = p_header->rows * p_header->cols;
+    if (p_header->game_time < 0
+        || p_header->num_mines > p_header->num_max_mines
+        || p_header->num_mines < p_header->num_max_mines - num_board_tiles
+        || p_header->num_tiles < p_header->num_max_mines
+        || p_header->num_tiles > num_board_tiles)
+    {
+        goto failed_open;
+    }
+
+    const uint64_t num_tiles = (uint64_t)p_header->rows * p_header->cols;
+    if (p_header->mines_size != (num_tiles + 7) / 8
+        || p_header->tiles_size != (num_tiles + 1) / 2
+        || p_header->mines_offset != SECTION_ALIGN(sizeof(game_save_header_t))
+        || p_header->tiles_offset != p_header->mines_offset + SECTION_ALIGN(p_header->mines_size)
+        || p_header->tiles_offset + p_header->tiles_size > p_file->size)
+    {
+        goto failed_open;
+    }
+
+    *pp_out_header = p_header;
+    return true;
+
+failed_open:
+    mapped_file_close(p_file);
+    return false;
+}
+
+static uint64_t get_header_hash(const game_save_header_t* p_header)
+{
+    return hash64_wyhash((const char*)p_header, offsetof(game_save_header_t, checksum));
+}
+
+// save_game()이 청크마다 해시한 것과 같은 순서로 연결
+static uint64_t hash_section(const char* p_section, const size_t size, uint64_t seed)
+{
+    for (size_t offset = 0; offset < size; offset += GAME_SAVE_CHUNK_SIZE)
+    {
+        seed = hash64_wyhash_seed(p_section + offset, MIN(GAME_SAVE_CHUNK_SIZE, size - offset), seed);
+    }
+
+    return seed;
+}
+
+// bool은 0 또는 1이므로 7번 비트로 올려서 16개씩 movemask
+static void pack_mines(const bool* p_mines, const size_t num_tiles, uint8_t* p_out_bits)
+{
+    size_t i = 0;
+    for (; i + 16 <= num_tiles; i += 16)
+    {
+        const __m128i mines = _mm_loadu_si128((const __m128i*)(p_mines + i));
+        const int bits = _mm_movemask_epi8(_mm_slli_epi16(mines, 7));
+
+        p_out_bits[i / 8] = (uint8_t)bits;
+        p_out_bits[i / 8 + 1] = (uint8_t)(bits >> 8);
+    }
+
+    if (i < num_tiles)
+    {
+        memset(p_out_bits + i / 8, 0, (num_tiles + 7) / 8 - i / 8);
+    }
+
+    for (; i < num_tiles; ++i)
+    {
+        p_out_bits[i / 8] |= (uint8_t)(p_mines[i] << (i % 8));
+    }
+}
+
+// 2바이트를 16레인에 펼친 뒤 레인마다 자기 비트만 검사
+static void unpack_mines(const uint8_t* p_bits, const size_t num_tiles, bool* p_out_mines)
+{
+    const __m128i bit_masks = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i ones = _mm_set1_epi8(1);
+
+    size_t i = 0;
+    for (; i + 16 <= num_tiles; i += 16)
+    {
+        const int bits = p_bits[i / 8] | (p_bits[i / 8 + 1] << 8);
+
+        // SSE2만으로 펼침: [b0 b1] -> [b0 b0 b1 b1] -> [b0 x4 b1 x4] -> [b0 x8 b1 x8]
+        __m128i spread_bits = _mm_cvtsi32_si128(bits);
+        spread_bits = _mm_unpacklo_epi8(spread_bits, spread_bits);
+        spread_bits = _mm_unpacklo_epi16(spread_bits, spread_bits);
+        spread_bits = _mm_unpacklo_epi32(spread_bits, spread_bits);
+
+        const __m128i mines = _mm_cmpeq_epi8(_mm_and_si128(spread_bits, bit_masks), bit_masks);
+
+        _mm_storeu_si128((__m128i*)(p_out_mines + i), _mm_and_si128(mines, ones));
+    }
+
+    for (; i < num_tiles; ++i)
+    {
+        p_out_mines[i] = ((p_bits[i / 8] >> (i % 8)) & 1) != 0;
+    }
+}
+
+// 16개씩 바이트로 줄인 뒤 16비트 레인마다 (홀수 << 4) | 짝수
+static void pack_tiles(const tile_t* p_tiles, const size_t num_tiles, uint8_t* p_out_nibbles)
+{
+    const __m128i low_mask = _mm_set1_epi16(0x000f);
+    const __m128i high_mask = _mm_set1_epi16(0x00f0);
+
+    size_t i = 0;
+    for (; i + 16 <= num_tiles; i += 16)
+    {
+        const __m128i tiles0 = _mm_loadu_si128((const __m128i*)(p_tiles + i + 0));
+        const __m128i tiles1 = _mm_loadu_si128((const __m128i*)(p_tiles + i + 4));
+        const __m128i tiles2 = _mm_loadu_si128((const __m128i*)(p_tiles + i + 8));
+        const __m128i tiles3 = _mm_loadu_si128((const __m128i*)(p_tiles + i + 12));
+        const __m128i tiles = _mm_packus_epi16(_mm_packs_epi32(tiles0, tiles1), _mm_packs_epi32(tiles2, tiles3));
+
+        const __m128i pairs = _mm_or_si128(_mm_and_si128(tiles, low_mask), _mm_and_si128(_mm_srli_epi16(tiles, 4), high_mask));
+        _mm_storel_epi64((__m128i*)(p_out_nibbles + i / 2), _mm_packus_epi16(pairs, pairs));
+    }
+
+    for (; i < num_tiles; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            p_out_nibbles[i / 2] = (uint8_t)p_tiles[i];
+        }
+        else
+        {
+            p_out_nibbles[i / 2] |= (uint8_t)(p_tiles[i] << 4);
+        }
+    }
+}
+
+static void unpack_tiles(const uint8_t* p_nibbles, const size_t num_tiles, tile_t* p_out_tiles)
+{
+    const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= num_tiles; i += 16)
+    {
+        const __m128i nibbles = _mm_loadl_epi64((const __m128i*)(p_nibbles + i / 2));
+        const __m128i low = _mm_and_si128(nibbles, nibble_mask);
+        const __m128i high = _mm_and_si128(_mm_srli_epi16(nibbles, 4), nibble_mask);
+        const __m128i tiles = _mm_unpacklo_epi8(low, high);
+
+        const __m128i tiles_low = _mm_unpacklo_epi8(tiles, zero);
+        const __m128i tiles_high = _mm_unpackhi_epi8(tiles, zero);
+        _mm_storeu_si128((__m128i*)(p_out_tiles + i + 0), _mm_unpacklo_epi16(tiles_low, zero));
+        _mm_storeu_si128((__m128i*)(p_out_tiles + i + 4), _mm_unpackhi_epi16(tiles_low, zero));
+        _mm_storeu_si128((__m128i*)(p_out_tiles + i + 8), _mm_unpacklo_epi16(tiles_high, zero));
+        _mm_storeu_si128((__m128i*)(p_out_tiles + i + 12), _mm_unpackhi_epi16(tiles_high, zero));
+    }
+
+    for (; i < num_tiles; ++i)
+    {
+        p_out_tiles[i] = (tile_t)((p_nibbles[i / 2] >> (4 * (i % 2))) & 0x0f);
+    }
+}
\ No newline at end of file
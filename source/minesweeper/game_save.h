@@ -0,0 +1,77 @@
+﻿//***************************************************************************
+// 
+// 파일: game_save.h
+// 
+// 설명: 게임 상태 바이너리 저장/불러오기
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// gp_game의 보드를 대상으로 동작 (F9 저장, Shift + F9 불러오기)
+// 파일 형식 (리틀 엔디언, 메모리 맵으로 읽으므로 구역은 8바이트 정렬)
+// - 헤더: game_save_header_t
+// - 지뢰: 타일마다 1비트 (인덱스 i는 i / 8 바이트의 i % 8 비트)
+// - 타일: 타일마다 4비트 (짝수 인덱스가 하위 니블), tile_t는 16개라 그대로 들어감
+// 4096 x 4096 보드는 bool + tile_t 배열 80MB 대신 약 10MB
+// checksum은 checksum 앞의 헤더 해시에서 시작해서 지뢰, 타일 구역을 GAME_SAVE_CHUNK_SIZE씩
+// 이전 해시를 시드로 hash64_wyhash_seed (구역 사이 정렬 바이트는 제외)
+// 
+//***************************************************************************
+
+#ifndef GAME_SAVE_H
+#define GAME_SAVE_H
+
+#include "safe99_common/defines.h"
+
+#define GAME_SAVE_FILENAME "minesweeper.sav"
+
+// "MSSV"
+#define GAME_SAVE_MAGIC 0x5653534d
+#define GAME_SAVE_VERSION 1
+
+#define GAME_SAVE_FLAG_RUNNING 0x1
+
+// 저장할 때 묶는 단위이자 체크섬 단위, 바꾸면 버전도 올려야 함
+#define GAME_SAVE_CHUNK_SIZE (256 * 1024)
+
+typedef struct game_save_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t flags;
+
+    int32_t rows;
+    int32_t cols;
+    int32_t num_max_mines;
+    int32_t num_mines;
+    int32_t num_tiles;
+    int32_t game_time;
+
+    uint64_t random_state;
+
+    // 파일 시작부터의 바이트 오프셋
+    uint64_t mines_offset;
+    uint64_t mines_size;
+    uint64_t tiles_offset;
+    uint64_t tiles_size;
+
+    uint64_t checksum;
+} game_save_header_t;
+
+START_EXTERN_C
+
+// filename.tmp에 쓴 뒤 filename을 바꿈, 실패하면 이전 저장 파일을 그대로 둠
+bool save_game(const char* filename);
+
+// 창 크기가 보드 크기로 정해지므로 현재 게임과 rows, cols가 같아야 함
+// 실패하면 (파일 없음, 버전/크기 불일치, 헤더 값 범위 오류, 체크섬 오류) 현재 게임을 그대로 둠
+bool load_game(const char* filename);
+
+// 헤더만 검사해서 보드 크기를 읽음 (시작할 때 창 크기를 정하는 용도)
+bool peek_game_save(const char* filename, int* p_out_rows, int* p_out_cols, int* p_out_num_max_mines);
+
+END_EXTERN_C
+
+#endif // GAME_SAVE_H
\ No newline at end of file
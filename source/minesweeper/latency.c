@@ -0,0 +1,231 @@
+﻿//***************************************************************************
+// 
+// 파일: latency.c
+// 
+// 설명: 입력 -> 화면 출력 지연 시간 측정
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "latency.h"
+
+static int compare_float(const void* p_a, const void* p_b);
+
+static uint64_t s_frequency;
+
+// 화면 출력 대기 중인 이벤트
+static latency_event_t s_pending_events[LATENCY_NUM_MAX_PENDING_EVENTS];
+static size_t s_num_pending_events;
+static size_t s_num_dropped_events;
+
+// 완료된 이벤트 (링 버퍼)
+static latency_event_t s_samples[LATENCY_NUM_MAX_SAMPLES];
+static size_t s_sample_index;
+static size_t s_num_samples;
+
+// 통계는 샘플이 추가됐을 때만 다시 계산
+static latency_stats_t s_stats;
+static bool s_b_stats_dirty;
+
+void latency_init(void)
+{
+    s_frequency = get_perf_frequency();
+
+    s_num_pending_events = 0;
+    s_num_dropped_events = 0;
+    s_sample_index = 0;
+    s_num_samples = 0;
+
+    memset(&s_stats, 0, sizeof(latency_stats_t));
+    s_b_stats_dirty = false;
+}
+
+void latency_begin_input(const uint32_t message)
+{
+    const uint64_t counter = get_perf_counter();
+
+    if (s_num_pending_events >= LATENCY_NUM_MAX_PENDING_EVENTS)
+    {
+        ++s_num_dropped_events;
+        return;
+    }
+
+    latency_event_t* p_event = &s_pending_events[s_num_pending_events++];
+    memset(p_event, 0, sizeof(latency_event_t));
+    p_event->message = message;
+    p_event->counters[LATENCY_STAGE_INPUT] = counter;
+}
+
+void latency_mark(const latency_stage_t stage)
+{
+    ASSERT(stage > LATENCY_STAGE_INPUT && stage < LATENCY_NUM_STAGES, "invalid stage");
+
+    if (s_num_pending_events == 0)
+    {
+        return;
+    }
+
+    const uint64_t counter = get_perf_counter();
+
+    for (size_t i = 0; i < s_num_pending_events; ++i)
+    {
+        latency_event_t* p_event = &s_pending_events[i];
+
+        // open_tile()은 update() 안에서만 호출되므로 update()를 거친 이벤트만 기록
+        if (stage == LATENCY_STAGE_OPEN_TILE && p_event->counters[LATENCY_STAGE_UPDATE] == 0)
+        {
+            continue;
+        }
+
+        if (p_event->counters[stage] == 0)
+        {
+            p_event->counters[stage] = counter;
+        }
+    }
+}
+
+void latency_end_frame(void)
+{
+    if (s_num_pending_events == 0)
+    {
+        return;
+    }
+
+    const uint64_t counter = get_perf_counter();
+
+    // update()를 거친 이벤트만 완료 처리, 나머지는 다음 프레임으로 넘김
+    size_t num_remain_events = 0;
+    for (size_t i = 0; i < s_num_pending_events; ++i)
+    {
+        latency_event_t* p_event = &s_pending_events[i];
+        if (p_event->counters[LATENCY_STAGE_UPDATE] == 0)
+        {
+            s_pending_events[num_remain_events++] = *p_event;
+            continue;
+        }
+
+        p_event->counters[LATENCY_STAGE_PRESENT] = counter;
+
+        s_samples[s_sample_index] = *p_event;
+        s_sample_index = (s_sample_index + 1) % LATENCY_NUM_MAX_SAMPLES;
+        s_num_samples = MIN(s_num_samples + 1, LATENCY_NUM_MAX_SAMPLES);
+
+        s_b_stats_dirty = true;
+    }
+
+    s_num_pending_events = num_remain_events;
+}
+
+void latency_get_stats(latency_stats_t* p_out_stats)
+{
+    ASSERT(p_out_stats != NULL, "p_out_stats == NULL");
+
+    if (s_b_stats_dirty)
+    {
+        static float s_elapsed_times[LATENCY_NUM_MAX_SAMPLES];
+
+        const float to_ms = 1000.0f / (float)s_frequency;
+        for (size_t i = 0; i < s_num_samples; ++i)
+        {
+            const latency_event_t* p_event = &s_samples[i];
+            s_elapsed_times[i] = (float)(p_event->counters[LATENCY_STAGE_PRESENT] - p_event->counters[LATENCY_STAGE_INPUT]) * to_ms;
+        }
+
+        qsort(s_elapsed_times, s_num_samples, sizeof(float), compare_float);
+
+        s_stats.num_samples = s_num_samples;
+        s_stats.p50 = s_elapsed_times[(s_num_samples - 1) * 50 / 100];
+        s_stats.p99 = s_elapsed_times[(s_num_samples - 1) * 99 / 100];
+        s_stats.max = s_elapsed_times[s_num_samples - 1];
+
+        s_b_stats_dirty = false;
+    }
+
+    *p_out_stats = s_stats;
+}
+
+bool latency_dump_csv(const char* filename)
+{
+    ASSERT(filename != NULL, "filename == NULL");
+
+    FILE* p_file = fopen(filename, "w");
+    if (p_file == NULL)
+    {
+        ASSERT(false, "Failed to open csv");
+        return false;
+    }
+
+    fprintf(p_file, "message,input_to_update_ms,update_to_open_tile_ms,input_to_present_ms\n");
+
+    const float to_ms = 1000.0f / (float)s_frequency;
+
+    // 오래된 샘플부터 출력
+    const size_t start_index = (s_num_samples < LATENCY_NUM_MAX_SAMPLES) ? 0 : s_sample_index;
+    for (size_t i = 0; i < s_num_samples; ++i)
+    {
+        const latency_event_t* p_event = &s_samples[(start_index + i) % LATENCY_NUM_MAX_SAMPLES];
+        const uint64_t input = p_event->counters[LATENCY_STAGE_INPUT];
+        const uint64_t update = p_event->counters[LATENCY_STAGE_UPDATE];
+        const uint64_t open_tile = p_event->counters[LATENCY_STAGE_OPEN_TILE];
+        const uint64_t present = p_event->counters[LATENCY_STAGE_PRESENT];
+
+        // 입력 메시지는 wnd_proc (Win32)에서만 기록됨
+        const char* p_message = "unknown";
+#if defined(_WIN32)
+        switch (p_event->message)
+        {
+        case WM_LBUTTONDOWN:
+            p_message = "lbutton_down";
+            break;
+        case WM_LBUTTONUP:
+            p_message = "lbutton_up";
+            break;
+        case WM_RBUTTONDOWN:
+            p_message = "rbutton_down";
+            break;
+        case WM_RBUTTONUP:
+            p_message = "rbutton_up";
+            break;
+        case WM_KEYDOWN:
+            p_message = "key_down";
+            break;
+        case WM_KEYUP:
+            p_message = "key_up";
+            break;
+        default:
+            break;
+        }
+#endif // _WIN32
+
+        // open_tile()을 거치지 않은 이벤트는 빈 칸
+        if (open_tile != 0)
+        {
+            fprintf(p_file, "%s,%f,%f,%f\n", p_message,
+                    (float)(update - input) * to_ms,
+                    (float)(open_tile - update) * to_ms,
+                    (float)(present - input) * to_ms);
+        }
+        else
+        {
+            fprintf(p_file, "%s,%f,,%f\n", p_message,
+                    (float)(update - input) * to_ms,
+                    (float)(present - input) * to_ms);
+        }
+    }
+
+    fprintf(p_file, "# dropped,%zu\n", s_num_dropped_events);
+
+    fclose(p_file);
+    return true;
+}
+
+static int compare_float(const void* p_a, const void* p_b)
+{
+    const float a = *(const float*)p_a;
+    const float b = *(const float*)p_b;
+    return (a > b) - (a < b);
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+﻿//***************************************************************************
+// 
+// 파일: latency.h
+// 
+// 설명: 입력 -> 화면 출력 지연 시간 측정
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// wnd_proc에서 입력 이벤트에 get_perf_counter() 시간을 기록하고
+// update() -> open_tile() -> on_draw() 순서로 단계별 시간을 기록함
+// 
+//***************************************************************************
+
+#ifndef LATENCY_H
+#define LATENCY_H
+
+#include "safe99_common/defines.h"
+
+#define LATENCY_NUM_MAX_PENDING_EVENTS 16
+#define LATENCY_NUM_MAX_SAMPLES 1024
+
+typedef enum latency_stage
+{
+    LATENCY_STAGE_INPUT,
+    LATENCY_STAGE_UPDATE,
+    LATENCY_STAGE_OPEN_TILE,
+    LATENCY_STAGE_PRESENT,
+    LATENCY_NUM_STAGES
+} latency_stage_t;
+
+typedef struct latency_event
+{
+    uint32_t message;
+
+    // 단계별 카운터, 0이면 해당 단계를 거치지 않음
+    uint64_t counters[LATENCY_NUM_STAGES];
+} latency_event_t;
+
+typedef struct latency_stats
+{
+    size_t num_samples;
+
+    // 입력 -> 화면 출력 (ms)
+    float p50;
+    float p99;
+    float max;
+} latency_stats_t;
+
+void latency_init(void);
+
+// wnd_proc에서 호출
+void latency_begin_input(const uint32_t message);
+
+// 대기 중인 이벤트 중 stage를 아직 거치지 않은 이벤트에 현재 시간 기록
+void latency_mark(const latency_stage_t stage);
+
+// on_draw() 직후 호출, update()를 거친 이벤트를 샘플로 기록
+void latency_end_frame(void);
+
+void latency_get_stats(latency_stats_t* p_out_stats);
+bool latency_dump_csv(const char* filename);
+
+#endif // LATENCY_H
\ No newline at end of file
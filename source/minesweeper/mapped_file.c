@@ -0,0 +1,116 @@
+﻿//***************************************************************************
+// 
+// 파일: mapped_file.c
+// 
+// 설명: 읽기 전용 메모리 맵 파일
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "mapped_file.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+bool mapped_file_open(mapped_file_t* p_file, const char* filename)
+{
+    ASSERT(p_file != NULL, "p_file == NULL");
+    ASSERT(filename != NULL, "filename == NULL");
+
+    memset(p_file, 0, sizeof(mapped_file_t));
+
+#if defined(_WIN32)
+    p_file->h_file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (p_file->h_file == INVALID_HANDLE_VALUE)
+    {
+        p_file->h_file = NULL;
+        goto failed_open;
+    }
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(p_file->h_file, &file_size) || file_size.QuadPart == 0)
+    {
+        goto failed_open;
+    }
+    p_file->size = (size_t)file_size.QuadPart;
+
+    p_file->h_mapping = CreateFileMappingA(p_file->h_file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (p_file->h_mapping == NULL)
+    {
+        goto failed_open;
+    }
+
+    p_file->p_data = (const char*)MapViewOfFile(p_file->h_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (p_file->p_data == NULL)
+    {
+        goto failed_open;
+    }
+#else
+    const int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        goto failed_open;
+    }
+
+    // 매핑은 파일 디스크립터를 닫아도 유지됨
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0)
+    {
+        close(fd);
+        goto failed_open;
+    }
+    p_file->size = (size_t)file_stat.st_size;
+
+    void* p_data = mmap(NULL, p_file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p_data == MAP_FAILED)
+    {
+        goto failed_open;
+    }
+    p_file->p_data = (const char*)p_data;
+#endif // _WIN32
+
+    return true;
+
+failed_open:
+    mapped_file_close(p_file);
+    return false;
+}
+
+void mapped_file_close(mapped_file_t* p_file)
+{
+    ASSERT(p_file != NULL, "p_file == NULL");
+
+#if defined(_WIN32)
+    if (p_file->p_data != NULL)
+    {
+        UnmapViewOfFile(p_file->p_data);
+    }
+
+    if (p_file->h_mapping != NULL)
+    {
+        CloseHandle(p_file->h_mapping);
+    }
+
+    if (p_file->h_file != NULL)
+    {
+        CloseHandle(p_file->h_file);
+    }
+#else
+    if (p_file->p_data != NULL)
+    {
+        munmap((void*)p_file->p_data, p_file->size);
+    }
+#endif // _WIN32
+
+    memset(p_file, 0, sizeof(mapped_file_t));
+}
\ No newline at end of file
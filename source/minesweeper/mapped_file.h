@@ -0,0 +1,36 @@
+﻿//***************************************************************************
+// 
+// 파일: mapped_file.h
+// 
+// 설명: 읽기 전용 메모리 맵 파일
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// Windows는 CreateFileMapping/MapViewOfFile, 그 외는 mmap 사용
+// 파일 내용을 읽어 들이지 않고 페이지 폴트 시점에 OS가 페이지 캐시에서 직접 매핑함
+// 
+//***************************************************************************
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include "safe99_common/defines.h"
+
+typedef struct mapped_file
+{
+    const char* p_data;
+    size_t size;
+
+#if defined(_WIN32)
+    void* h_file;
+    void* h_mapping;
+#endif // _WIN32
+} mapped_file_t;
+
+// 빈 파일은 매핑할 수 없으므로 실패
+bool mapped_file_open(mapped_file_t* p_file, const char* filename);
+void mapped_file_close(mapped_file_t* p_file);
+
+#endif // MAPPED_FILE_H
\ No newline at end of file
@@ -0,0 +1,336 @@
+﻿//***************************************************************************
+// 
+// 파일: minimap.c
+// 
+// 설명: 큰 보드용 축소 미니맵
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "game.h"
+#include "minimap.h"
+
+// tile_t -> minimap_priority_t (pshufb 테이블로도 쓰므로 16바이트)
+ALIGN16 static const uint8_t s_tile_priorities[16] =
+{
+    MINIMAP_PRIORITY_BLIND,         // TILE_BLIND
+    MINIMAP_PRIORITY_OPEN,          // TILE_OPEN
+    MINIMAP_PRIORITY_FLAG,          // TILE_FLAG
+    MINIMAP_PRIORITY_BLIND,         // TILE_UNKNOWN
+    MINIMAP_PRIORITY_BLIND,         // TILE_OPEN_UNKNOWN
+    MINIMAP_PRIORITY_MINE,          // TILE_MINE
+    MINIMAP_PRIORITY_GAMEOVER_MINE, // TILE_GAMEOVER_MINE
+    MINIMAP_PRIORITY_MINE,          // TILE_FLAG_MINE
+    MINIMAP_PRIORITY_OPEN,          // TILE_1
+    MINIMAP_PRIORITY_OPEN,          // TILE_2
+    MINIMAP_PRIORITY_OPEN,          // TILE_3
+    MINIMAP_PRIORITY_OPEN,          // TILE_4
+    MINIMAP_PRIORITY_OPEN,          // TILE_5
+    MINIMAP_PRIORITY_OPEN,          // TILE_6
+    MINIMAP_PRIORITY_OPEN,          // TILE_7
+    MINIMAP_PRIORITY_OPEN           // TILE_8
+};
+
+static const uint32_t s_priority_colors[MINIMAP_NUM_PRIORITIES] =
+{
+    0xffe0e0e0, // 열림
+    0xff808080, // 가려짐
+    0xffff0000, // 깃발
+    0xff000000, // 지뢰
+    0xffff00ff  // 밟은 지뢰
+};
+
+// 열별 바이트 카운터가 넘치지 않는 최대 행 수
+#define MINIMAP_MAX_STRIP_ROWS 255
+
+static int get_block_num_tiles(const minimap_t* p_minimap, const int pixel_x, const int pixel_y);
+static void update_pixel(minimap_t* p_minimap, const size_t pixel_index);
+static void add_row_counts(minimap_t* p_minimap, const int pixel_y);
+static void finish_row(minimap_t* p_minimap, const int pixel_y);
+static TARGET_SSSE3 void rebuild_ssse3(minimap_t* p_minimap, const int* p_tiles);
+
+bool minimap_init(minimap_t* p_minimap, const int rows, const int cols)
+{
+    ASSERT(p_minimap != NULL, "p_minimap == NULL");
+    ASSERT(rows > 0, "rows == 0");
+    ASSERT(cols > 0, "cols == 0");
+    ASSERT(sizeof(tile_t) == sizeof(int), "sizeof(tile_t) != sizeof(int)");
+
+    memset(p_minimap, 0, sizeof(minimap_t));
+
+    const int num_max_tiles = MAX(rows, cols);
+
+    p_minimap->rows = rows;
+    p_minimap->cols = cols;
+    p_minimap->block_size = (num_max_tiles + MINIMAP_MAX_SIZE - 1) / MINIMAP_MAX_SIZE;
+    p_minimap->width = (cols + p_minimap->block_size - 1) / p_minimap->block_size;
+    p_minimap->height = (rows + p_minimap->block_size - 1) / p_minimap->block_size;
+
+    const size_t num_pixels = (size_t)p_minimap->width * p_minimap->height;
+
+    p_minimap->pa_counts = (uint32_t*)malloc(sizeof(uint32_t) * MINIMAP_NUM_PRIORITIES * num_pixels);
+    p_minimap->pa_pixels = (uint32_t*)malloc(sizeof(uint32_t) * num_pixels);
+    p_minimap->pa_row_counts = (uint8_t*)malloc((size_t)(MINIMAP_NUM_PRIORITIES - 1) * cols);
+    if (p_minimap->pa_counts == NULL || p_minimap->pa_pixels == NULL || p_minimap->pa_row_counts == NULL)
+    {
+        ASSERT(false, "Failed to malloc minimap");
+        goto failed_init;
+    }
+
+    return true;
+
+failed_init:
+    minimap_release(p_minimap);
+    return false;
+}
+
+void minimap_release(minimap_t* p_minimap)
+{
+    ASSERT(p_minimap != NULL, "p_minimap == NULL");
+
+    SAFE_FREE(p_minimap->pa_row_counts);
+    SAFE_FREE(p_minimap->pa_pixels);
+    SAFE_FREE(p_minimap->pa_counts);
+
+    memset(p_minimap, 0, sizeof(minimap_t));
+}
+
+void minimap_clear(minimap_t* p_minimap, const int tile)
+{
+    ASSERT(p_minimap != NULL, "p_minimap == NULL");
+    ASSERT(tile >= TILE_BLIND && tile <= TILE_8, "Invalid tile");
+
+    const size_t num_pixels = (size_t)p_minimap->width * p_minimap->height;
+    const uint8_t priority = s_tile_priorities[tile];
+
+    memset(p_minimap->pa_counts, 0, sizeof(uint32_t) * MINIMAP_NUM_PRIORITIES * num_pixels);
+
+    for (int pixel_y = 0; pixel_y < p_minimap->height; ++pixel_y)
+    {
+        for (int pixel_x = 0; pixel_x < p_minimap->width; ++pixel_x)
+        {
+            const size_t pixel_index = (size_t)pixel_y * p_minimap->width + pixel_x;
+            p_minimap->pa_counts[pixel_index * MINIMAP_NUM_PRIORITIES + priority] = (uint32_t)get_block_num_tiles(p_minimap, pixel_x, pixel_y);
+            p_minimap->pa_pixels[pixel_index] = s_priority_colors[priority];
+        }
+    }
+}
+
+void minimap_rebuild(minimap_t* p_minimap, const int* p_tiles)
+{
+    // palette_board와 같은 SSSE3 확인 (처음 호출할 때 한 번만)
+    static int s_ssse3_supported = -1;
+    if (s_ssse3_supported < 0)
+    {
+        s_ssse3_supported = palette_is_ssse3_supported() ? 1 : 0;
+    }
+
+    if (s_ssse3_supported)
+    {
+        rebuild_ssse3(p_minimap, p_tiles);
+    }
+    else
+    {
+        minimap_rebuild_scalar(p_minimap, p_tiles);
+    }
+}
+
+void minimap_rebuild_scalar(minimap_t* p_minimap, const int* p_tiles)
+{
+    ASSERT(p_minimap != NULL, "p_minimap == NULL");
+    ASSERT(p_tiles != NULL, "p_tiles == NULL");
+
+    const size_t num_pixels = (size_t)p_minimap->width * p_minimap->height;
+    memset(p_minimap->pa_counts, 0, sizeof(uint32_t) * MINIMAP_NUM_PRIORITIES * num_pixels);
+
+    for (int y = 0; y < p_minimap->rows; ++y)
+    {
+        const int* p_row = p_tiles + (size_t)y * p_minimap->cols;
+        uint32_t* p_row_counts = p_minimap->pa_counts + (size_t)(y / p_minimap->block_size) * p_minimap->width * MINIMAP_NUM_PRIORITIES;
+
+        for (int x = 0; x < p_minimap->cols; ++x)
+        {
+            ASSERT(p_row[x] >= TILE_BLIND && p_row[x] <= TILE_8, "Invalid tile");
+            ++p_row_counts[(size_t)(x / p_minimap->block_size) * MINIMAP_NUM_PRIORITIES + s_tile_priorities[p_row[x]]];
+        }
+    }
+
+    for (size_t i = 0; i < num_pixels; ++i)
+    {
+        update_pixel(p_minimap, i);
+    }
+}
+
+void minimap_update_tile(minimap_t* p_minimap, const int* p_tiles, const int x, const int y, const int old_tile)
+{
+    ASSERT(p_minimap != NULL, "p_minimap == NULL");
+    ASSERT(p_tiles != NULL, "p_tiles == NULL");
+    ASSERT(x >= 0 && x < p_minimap->cols, "invalid x");
+    ASSERT(y >= 0 && y < p_minimap->rows, "invalid y");
+    ASSERT(old_tile >= TILE_BLIND && old_tile <= TILE_8, "Invalid tile");
+
+    const int pixel_x = x / p_minimap->block_size;
+    const int pixel_y = y / p_minimap->block_size;
+    const size_t pixel_index = (size_t)pixel_y * p_minimap->width + pixel_x;
+
+    uint32_t* p_counts = p_minimap->pa_counts + pixel_index * MINIMAP_NUM_PRIORITIES;
+    ASSERT(p_counts[s_tile_priorities[old_tile]] > 0, "old_tile is not counted");
+
+    --p_counts[s_tile_priorities[old_tile]];
+    ++p_counts[s_tile_priorities[p_tiles[(size_t)y * p_minimap->cols + x]]];
+
+    update_pixel(p_minimap, pixel_index);
+}
+
+static int get_block_num_tiles(const minimap_t* p_minimap, const int pixel_x, const int pixel_y)
+{
+    const int start_x = pixel_x * p_minimap->block_size;
+    const int start_y = pixel_y * p_minimap->block_size;
+    const int end_x = MIN(start_x + p_minimap->block_size, p_minimap->cols);
+    const int end_y = MIN(start_y + p_minimap->block_size, p_minimap->rows);
+
+    return (end_x - start_x) * (end_y - start_y);
+}
+
+// 0이 아닌 가장 높은 우선순위의 색
+static void update_pixel(minimap_t* p_minimap, const size_t pixel_index)
+{
+    const uint32_t* p_counts = p_minimap->pa_counts + pixel_index * MINIMAP_NUM_PRIORITIES;
+
+    int priority = MINIMAP_NUM_PRIORITIES - 1;
+    while (priority > 0 && p_counts[priority] == 0)
+    {
+        --priority;
+    }
+
+    p_minimap->pa_pixels[pixel_index] = s_priority_colors[priority];
+}
+
+// pa_row_counts (스트립의 열별 타일 수) -> 픽셀 행 카운터
+static void add_row_counts(minimap_t* p_minimap, const int pixel_y)
+{
+    uint32_t* p_counts = p_minimap->pa_counts + (size_t)pixel_y * p_minimap->width * MINIMAP_NUM_PRIORITIES;
+
+    for (int pixel_x = 0; pixel_x < p_minimap->width; ++pixel_x)
+    {
+        const int start_x = pixel_x * p_minimap->block_size;
+        const int end_x = MIN(start_x + p_minimap->block_size, p_minimap->cols);
+
+        for (int priority = 1; priority < MINIMAP_NUM_PRIORITIES; ++priority)
+        {
+            const uint8_t* p_row_counts = p_minimap->pa_row_counts + (size_t)(priority - 1) * p_minimap->cols;
+
+            uint32_t count = 0;
+            for (int x = start_x; x < end_x; ++x)
+            {
+                count += p_row_counts[x];
+            }
+
+            p_counts[(size_t)pixel_x * MINIMAP_NUM_PRIORITIES + priority] += count;
+        }
+    }
+}
+
+// 우선순위 0은 블록 타일 수에서 나머지를 빼서 구한 뒤 픽셀 행 갱신
+static void finish_row(minimap_t* p_minimap, const int pixel_y)
+{
+    for (int pixel_x = 0; pixel_x < p_minimap->width; ++pixel_x)
+    {
+        const size_t pixel_index = (size_t)pixel_y * p_minimap->width + pixel_x;
+        uint32_t* p_counts = p_minimap->pa_counts + pixel_index * MINIMAP_NUM_PRIORITIES;
+
+        uint32_t num_tiles = (uint32_t)get_block_num_tiles(p_minimap, pixel_x, pixel_y);
+        for (int priority = 1; priority < MINIMAP_NUM_PRIORITIES; ++priority)
+        {
+            num_tiles -= p_counts[priority];
+        }
+        p_counts[0] = num_tiles;
+
+        update_pixel(p_minimap, pixel_index);
+    }
+}
+
+// 타일 16개 (int 16개)를 바이트로 줄인 뒤 pshufb로 우선순위 변환
+static TARGET_SSSE3 void rebuild_ssse3(minimap_t* p_minimap, const int* p_tiles)
+{
+    ASSERT(p_minimap != NULL, "p_minimap == NULL");
+    ASSERT(p_tiles != NULL, "p_tiles == NULL");
+
+    const __m128i priority_lut = _mm_load_si128((const __m128i*)s_tile_priorities);
+    const __m128i flag_priority = _mm_set1_epi8(MINIMAP_PRIORITY_FLAG);
+    const __m128i blind_priority = _mm_set1_epi8(MINIMAP_PRIORITY_BLIND);
+    const __m128i mine_priority = _mm_set1_epi8(MINIMAP_PRIORITY_MINE);
+    const __m128i gameover_mine_priority = _mm_set1_epi8(MINIMAP_PRIORITY_GAMEOVER_MINE);
+
+    const int cols = p_minimap->cols;
+    const int num_vector_cols = cols & ~15;
+
+    uint8_t* p_blind_counts = p_minimap->pa_row_counts + (size_t)(MINIMAP_PRIORITY_BLIND - 1) * cols;
+    uint8_t* p_flag_counts = p_minimap->pa_row_counts + (size_t)(MINIMAP_PRIORITY_FLAG - 1) * cols;
+    uint8_t* p_mine_counts = p_minimap->pa_row_counts + (size_t)(MINIMAP_PRIORITY_MINE - 1) * cols;
+    uint8_t* p_gameover_mine_counts = p_minimap->pa_row_counts + (size_t)(MINIMAP_PRIORITY_GAMEOVER_MINE - 1) * cols;
+
+    const size_t num_pixels = (size_t)p_minimap->width * p_minimap->height;
+    memset(p_minimap->pa_counts, 0, sizeof(uint32_t) * MINIMAP_NUM_PRIORITIES * num_pixels);
+
+    for (int pixel_y = 0; pixel_y < p_minimap->height; ++pixel_y)
+    {
+        const int start_y = pixel_y * p_minimap->block_size;
+        const int end_y = MIN(start_y + p_minimap->block_size, p_minimap->rows);
+
+        for (int strip_y = start_y; strip_y < end_y; strip_y += MINIMAP_MAX_STRIP_ROWS)
+        {
+            const int strip_end_y = MIN(strip_y + MINIMAP_MAX_STRIP_ROWS, end_y);
+
+            memset(p_minimap->pa_row_counts, 0, (size_t)(MINIMAP_NUM_PRIORITIES - 1) * cols);
+
+            for (int y = strip_y; y < strip_end_y; ++y)
+            {
+                const int* p_row = p_tiles + (size_t)y * cols;
+
+                int x = 0;
+                for (; x < num_vector_cols; x += 16)
+                {
+                    const __m128i tiles0 = _mm_loadu_si128((const __m128i*)(p_row + x + 0));
+                    const __m128i tiles1 = _mm_loadu_si128((const __m128i*)(p_row + x + 4));
+                    const __m128i tiles2 = _mm_loadu_si128((const __m128i*)(p_row + x + 8));
+                    const __m128i tiles3 = _mm_loadu_si128((const __m128i*)(p_row + x + 12));
+
+                    // 타일 값은 0 ~ 15이므로 포화 없이 바이트가 됨
+                    const __m128i tiles = _mm_packus_epi16(_mm_packs_epi32(tiles0, tiles1), _mm_packs_epi32(tiles2, tiles3));
+                    const __m128i priorities = _mm_shuffle_epi8(priority_lut, tiles);
+
+                    // 같으면 0xff (-1)이므로 빼면 1 증가
+                    __m128i* p_counts = (__m128i*)(p_blind_counts + x);
+                    _mm_storeu_si128(p_counts, _mm_sub_epi8(_mm_loadu_si128(p_counts), _mm_cmpeq_epi8(priorities, blind_priority)));
+
+                    p_counts = (__m128i*)(p_flag_counts + x);
+                    _mm_storeu_si128(p_counts, _mm_sub_epi8(_mm_loadu_si128(p_counts), _mm_cmpeq_epi8(priorities, flag_priority)));
+
+                    p_counts = (__m128i*)(p_mine_counts + x);
+                    _mm_storeu_si128(p_counts, _mm_sub_epi8(_mm_loadu_si128(p_counts), _mm_cmpeq_epi8(priorities, mine_priority)));
+
+                    p_counts = (__m128i*)(p_gameover_mine_counts + x);
+                    _mm_storeu_si128(p_counts, _mm_sub_epi8(_mm_loadu_si128(p_counts), _mm_cmpeq_epi8(priorities, gameover_mine_priority)));
+                }
+
+                for (; x < cols; ++x)
+                {
+                    const uint8_t priority = s_tile_priorities[p_row[x]];
+                    if (priority != MINIMAP_PRIORITY_OPEN)
+                    {
+                        ++p_minimap->pa_row_counts[(size_t)(priority - 1) * cols + x];
+                    }
+                }
+            }
+
+            add_row_counts(p_minimap, pixel_y);
+        }
+
+        finish_row(p_minimap, pixel_y);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+﻿//***************************************************************************
+// 
+// 파일: minimap.h
+// 
+// 설명: 큰 보드용 축소 미니맵
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 보드를 block_size x block_size 타일 블록으로 나눠 블록마다 픽셀 하나
+// 픽셀 색은 블록 안 타일 중 가장 높은 우선순위 (열림 < 가려짐 < 깃발 < 지뢰 < 밟은 지뢰)
+// 픽셀마다 우선순위별 타일 수를 세어 두고 색은 0이 아닌 가장 높은 우선순위
+// - minimap_update_tile(): 이전 우선순위 감소, 새 우선순위 증가 (블록을 다시 읽지 않음)
+// - minimap_rebuild(): 보드 전체, 16타일씩 바이트로 줄이고 SSSE3 pshufb로 우선순위 변환 후
+//   우선순위마다 cmpeq로 열별 바이트 카운터에 더함 (255행마다 픽셀 카운터로 옮김)
+//   보드 전체를 읽으므로 메모리 대역폭이 한계 (4096 x 4096은 tile_t 64MB)
+// - minimap_clear(): 새 게임처럼 모든 타일이 같을 때, 보드를 읽지 않고 카운터와 픽셀만 채움
+// 프레임마다 보드를 다시 읽지 않으므로 비용은 바뀐 타일 수에 비례
+// 
+//***************************************************************************
+
+#ifndef MINIMAP_H
+#define MINIMAP_H
+
+#include "safe99_common/defines.h"
+
+// 미니맵 한 변의 최대 픽셀 수
+#define MINIMAP_MAX_SIZE 256
+
+typedef enum minimap_priority
+{
+    MINIMAP_PRIORITY_OPEN,
+    MINIMAP_PRIORITY_BLIND,
+    MINIMAP_PRIORITY_FLAG,
+    MINIMAP_PRIORITY_MINE,
+    MINIMAP_PRIORITY_GAMEOVER_MINE,
+    MINIMAP_NUM_PRIORITIES
+} minimap_priority_t;
+
+typedef struct minimap
+{
+    int rows;
+    int cols;
+
+    // 픽셀 하나가 덮는 타일 수 (한 변)
+    int block_size;
+
+    int width;
+    int height;
+
+    // 픽셀마다 MINIMAP_NUM_PRIORITIES개의 타일 수 ([pixel_index * MINIMAP_NUM_PRIORITIES + priority])
+    uint32_t* pa_counts;
+    uint32_t* pa_pixels;
+
+    // rebuild()에서 열마다 우선순위 1 ~ 4의 타일 수 ([(priority - 1) * cols + x], 0은 블록 타일 수에서 뺌)
+    uint8_t* pa_row_counts;
+} minimap_t;
+
+START_EXTERN_C
+
+bool minimap_init(minimap_t* p_minimap, const int rows, const int cols);
+void minimap_release(minimap_t* p_minimap);
+
+// 모든 타일이 tile일 때 (새 게임)
+void minimap_clear(minimap_t* p_minimap, const int tile);
+
+// p_tiles는 rows * cols개의 tile_t (game.h가 이 헤더를 포함하므로 int로 받음, tile_t와 크기 같음)
+void minimap_rebuild(minimap_t* p_minimap, const int* p_tiles);
+
+// SSSE3 경로와 비교하기 위한 스칼라 경로
+void minimap_rebuild_scalar(minimap_t* p_minimap, const int* p_tiles);
+
+// p_tiles[y * cols + x]는 이미 새 타일, old_tile은 바뀌기 전 타일
+void minimap_update_tile(minimap_t* p_minimap, const int* p_tiles, const int x, const int y, const int old_tile);
+
+END_EXTERN_C
+
+#endif // MINIMAP_H
\ No newline at end of file
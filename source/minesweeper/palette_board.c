@@ -0,0 +1,200 @@
+﻿//***************************************************************************
+// 
+// 파일: palette_board.c
+// 
+// 설명: 팔레트 인덱스로 그리는 보드 타일 레이어
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "game.h"
+#include "palette_board.h"
+
+static int find_or_add_color(uint32_t* p_colors, size_t* p_num_colors, const uint32_t color);
+
+bool palette_board_init(palette_board_t* p_board, const sprite_atlas_t* p_atlas,
+                        const int rows, const int cols, const uint32_t background_argb)
+{
+    ASSERT(p_board != NULL, "p_board == NULL");
+    ASSERT(p_atlas != NULL, "p_atlas == NULL");
+    ASSERT(rows > 0, "rows == 0");
+    ASSERT(cols > 0, "cols == 0");
+
+    memset(p_board, 0, sizeof(palette_board_t));
+
+    // 확대 아틀라스도 받을 수 있도록 타일 크기는 아틀라스에서 가져옴
+    const atlas_sprite_t* p_first_tile = sprite_atlas_get(p_atlas, SPRITE_ID_TILE);
+
+    p_board->tile_width = p_first_tile->width;
+    p_board->tile_height = p_first_tile->height;
+    p_board->rows = rows;
+    p_board->cols = cols;
+    p_board->width = (size_t)cols * p_board->tile_width;
+    p_board->height = (size_t)rows * p_board->tile_height;
+
+    const size_t num_tile_pixels = (size_t)p_board->tile_width * p_board->tile_height;
+    const size_t num_board_pixels = p_board->width * p_board->height;
+
+    p_board->pa_tile_indices = (uint8_t*)malloc(num_tile_pixels * SPRITE_ATLAS_NUM_TILES);
+    p_board->pa_indices = (uint8_t*)malloc(num_board_pixels);
+    p_board->pa_pixels = (uint32_t*)malloc(sizeof(uint32_t) * num_board_pixels);
+    p_board->pa_drawn_tiles = (uint8_t*)malloc((size_t)rows * cols);
+    p_board->pa_dirty_lefts = (int*)malloc(sizeof(int) * rows);
+    p_board->pa_dirty_rights = (int*)malloc(sizeof(int) * rows);
+    if (p_board->pa_tile_indices == NULL || p_board->pa_indices == NULL || p_board->pa_pixels == NULL
+        || p_board->pa_drawn_tiles == NULL || p_board->pa_dirty_lefts == NULL || p_board->pa_dirty_rights == NULL)
+    {
+        ASSERT(false, "Failed to malloc palette board");
+        goto failed_init;
+    }
+
+    // 타일 스프라이트 -> 팔레트 인덱스
+    uint32_t colors[PALETTE_NUM_MAX_COLORS];
+    size_t num_colors = 0;
+
+    for (int tile = 0; tile < SPRITE_ATLAS_NUM_TILES; ++tile)
+    {
+        const atlas_sprite_t* p_sprite = sprite_atlas_get(p_atlas, SPRITE_ID_TILE + tile);
+        ASSERT(p_sprite->width == p_board->tile_width && p_sprite->height == p_board->tile_height, "Invalid tile size");
+
+        uint8_t* p_tile_indices = p_board->pa_tile_indices + tile * num_tile_pixels;
+        for (size_t i = 0; i < num_tile_pixels; ++i)
+        {
+            const uint32_t color = (p_sprite->p_pixels[i] >> 24 == 0) ? background_argb : p_sprite->p_pixels[i];
+            const int index = find_or_add_color(colors, &num_colors, color);
+            if (index < 0)
+            {
+                // 16색을 넘는 테마는 기존 ARGB 경로 사용
+                goto failed_init;
+            }
+
+            p_tile_indices[i] = (uint8_t)index;
+        }
+    }
+
+    palette_set_colors(&p_board->palette, colors, num_colors);
+
+    memset(p_board->pa_indices, 0, num_board_pixels);
+    for (int y = 0; y < rows; ++y)
+    {
+        p_board->pa_dirty_lefts[y] = cols;
+        p_board->pa_dirty_rights[y] = 0;
+    }
+
+    // 처음에는 모든 타일을 씀
+    palette_board_invalidate(p_board);
+
+    return true;
+
+failed_init:
+    palette_board_release(p_board);
+    return false;
+}
+
+void palette_board_release(palette_board_t* p_board)
+{
+    ASSERT(p_board != NULL, "p_board == NULL");
+
+    SAFE_FREE(p_board->pa_dirty_rights);
+    SAFE_FREE(p_board->pa_dirty_lefts);
+    SAFE_FREE(p_board->pa_drawn_tiles);
+    SAFE_FREE(p_board->pa_pixels);
+    SAFE_FREE(p_board->pa_indices);
+    SAFE_FREE(p_board->pa_tile_indices);
+
+    memset(p_board, 0, sizeof(palette_board_t));
+}
+
+void palette_board_invalidate(palette_board_t* p_board)
+{
+    ASSERT(p_board != NULL, "p_board == NULL");
+
+    memset(p_board->pa_drawn_tiles, PALETTE_BOARD_NO_TILE, (size_t)p_board->rows * p_board->cols);
+    p_board->b_drawn_state_valid = false;
+}
+
+void palette_board_set_tile(palette_board_t* p_board, const int x, const int y, const int tile)
+{
+    ASSERT(p_board != NULL, "p_board == NULL");
+    ASSERT(x >= 0 && x < p_board->cols, "invalid x");
+    ASSERT(y >= 0 && y < p_board->rows, "invalid y");
+    ASSERT(tile >= 0 && tile < SPRITE_ATLAS_NUM_TILES, "invalid tile");
+
+    uint8_t* p_drawn_tile = &p_board->pa_drawn_tiles[y * p_board->cols + x];
+    if (*p_drawn_tile == (uint8_t)tile)
+    {
+        return;
+    }
+    *p_drawn_tile = (uint8_t)tile;
+
+    const size_t tile_width = (size_t)p_board->tile_width;
+    const uint8_t* p_src = p_board->pa_tile_indices + (size_t)tile * tile_width * p_board->tile_height;
+    uint8_t* p_dst = p_board->pa_indices + (size_t)y * p_board->tile_height * p_board->width + (size_t)x * tile_width;
+
+    for (int i = 0; i < p_board->tile_height; ++i)
+    {
+        memcpy(p_dst, p_src, tile_width);
+        p_src += tile_width;
+        p_dst += p_board->width;
+    }
+
+    p_board->pa_dirty_lefts[y] = MIN(p_board->pa_dirty_lefts[y], x);
+    p_board->pa_dirty_rights[y] = MAX(p_board->pa_dirty_rights[y], x + 1);
+}
+
+size_t palette_board_resolve(palette_board_t* p_board)
+{
+    ASSERT(p_board != NULL, "p_board == NULL");
+
+    size_t num_expanded_pixels = 0;
+
+    for (int y = 0; y < p_board->rows; ++y)
+    {
+        const int left = p_board->pa_dirty_lefts[y];
+        const int right = p_board->pa_dirty_rights[y];
+        if (left >= right)
+        {
+            continue;
+        }
+
+        const size_t span_x = (size_t)left * p_board->tile_width;
+        const size_t span_width = (size_t)(right - left) * p_board->tile_width;
+
+        for (int i = 0; i < p_board->tile_height; ++i)
+        {
+            const size_t offset = ((size_t)y * p_board->tile_height + i) * p_board->width + span_x;
+            palette_expand(&p_board->palette, p_board->pa_indices + offset, p_board->pa_pixels + offset, span_width);
+        }
+
+        num_expanded_pixels += span_width * p_board->tile_height;
+
+        p_board->pa_dirty_lefts[y] = p_board->cols;
+        p_board->pa_dirty_rights[y] = 0;
+    }
+
+    return num_expanded_pixels;
+}
+
+// 팔레트가 가득 찼으면 -1
+static int find_or_add_color(uint32_t* p_colors, size_t* p_num_colors, const uint32_t color)
+{
+    for (size_t i = 0; i < *p_num_colors; ++i)
+    {
+        if (p_colors[i] == color)
+        {
+            return (int)i;
+        }
+    }
+
+    if (*p_num_colors >= PALETTE_NUM_MAX_COLORS)
+    {
+        return -1;
+    }
+
+    p_colors[*p_num_colors] = color;
+    return (int)(*p_num_colors)++;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+﻿//***************************************************************************
+// 
+// 파일: palette_board.h
+// 
+// 설명: 팔레트 인덱스로 그리는 보드 타일 레이어
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 타일 스프라이트는 16색 이하 픽셀 아트이므로 보드를 픽셀당 1바이트 인덱스 버퍼에 그림
+// - set_tile()은 이전 프레임과 다른 타일만 인덱스 한 장(tile_width x tile_height바이트)을 쓰고 더티 구간에 추가
+// - resolve()는 더티 구간만 ARGB로 확장 (palette_expand, SSSE3 pshufb)
+// - begin_update()에 넘긴 보드 상태가 지난번과 같으면 타일마다 set_tile()을 호출하지 않아도 됨
+// 타일 레이어가 옮기는 바이트가 ARGB 블릿의 1/4이고 바뀌지 않은 타일은 다시 쓰지 않음
+// 프레임 버퍼는 렌더러 DLL이 매 프레임 지우므로 확장된 보드는 draw_bitmap 한 번으로 그림
+// 
+//***************************************************************************
+
+#ifndef PALETTE_BOARD_H
+#define PALETTE_BOARD_H
+
+#include "safe99_common/defines.h"
+#include "safe99_soft_renderer/palette_expand.h"
+#include "sprite_atlas.h"
+
+// 아직 쓰지 않은 타일
+#define PALETTE_BOARD_NO_TILE 0xff
+
+typedef struct palette_board
+{
+    palette_t palette;
+
+    // 타일 스프라이트 인덱스 (타일마다 tile_width * tile_height바이트)
+    uint8_t* pa_tile_indices;
+    int tile_width;
+    int tile_height;
+
+    int rows;
+    int cols;
+    size_t width;
+    size_t height;
+
+    uint8_t* pa_indices;
+    uint32_t* pa_pixels;
+
+    // 마지막으로 쓴 타일 (rows * cols)
+    uint8_t* pa_drawn_tiles;
+
+    // 타일 행마다 더티 타일 열 구간 [left, right), 비어 있으면 left >= right
+    int* pa_dirty_lefts;
+    int* pa_dirty_rights;
+
+    // 마지막으로 begin_update()에 넘긴 보드 상태, invalidate()하면 무효
+    uint64_t drawn_state;
+    bool b_drawn_state_valid;
+} palette_board_t;
+
+START_EXTERN_C
+
+// 타일 스프라이트 색이 PALETTE_NUM_MAX_COLORS보다 많으면 false
+// 투명 픽셀은 background_argb로 채움
+bool palette_board_init(palette_board_t* p_board, const sprite_atlas_t* p_atlas,
+                        const int rows, const int cols, const uint32_t background_argb);
+void palette_board_release(palette_board_t* p_board);
+
+// 모든 타일을 다음 set_tile()에서 다시 쓰도록 함
+void palette_board_invalidate(palette_board_t* p_board);
+
+// state는 타일이 바뀌면 함께 바뀌는 값 (호출한 쪽이 정함)
+// 지난번과 같으면 false이고 타일 루프를 건너뜀, true면 이번에 모든 타일을 set_tile()해야 함
+FORCEINLINE bool palette_board_begin_update(palette_board_t* p_board, const uint64_t state)
+{
+    ASSERT(p_board != NULL, "p_board == NULL");
+
+    if (p_board->b_drawn_state_valid && p_board->drawn_state == state)
+    {
+        return false;
+    }
+
+    p_board->drawn_state = state;
+    p_board->b_drawn_state_valid = true;
+    return true;
+}
+
+// tile은 tile_t 값
+void palette_board_set_tile(palette_board_t* p_board, const int x, const int y, const int tile);
+
+// 더티 구간을 ARGB로 확장하고 확장한 픽셀 수 반환
+size_t palette_board_resolve(palette_board_t* p_board);
+
+END_EXTERN_C
+
+#endif // PALETTE_BOARD_H
\ No newline at end of file
@@ -0,0 +1,263 @@
+﻿//***************************************************************************
+// 
+// 파일: platform.h
+// 
+// 설명: 스레드, 락, 이벤트, 고해상도 카운터 (Win32 / POSIX)
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 게임 창, 입력, DLL 로드 외의 코드 (보드, 그리기, 저장, 캡처, 에셋 로더)가
+// Windows.h 없이도 빌드되도록 Win32 API를 이 헤더로만 사용
+// Windows는 CRITICAL_SECTION/CONDITION_VARIABLE/이벤트, 그 외는 pthread 사용
+// 
+//***************************************************************************
+
+#ifndef PLATFORM_H
+#define PLATFORM_H
+
+#include "safe99_common/defines.h"
+
+#if defined(_WIN32)
+#include <Windows.h>
+
+typedef HANDLE thread_t;
+typedef CRITICAL_SECTION lock_t;
+typedef CONDITION_VARIABLE cond_t;
+
+// 자동 리셋 이벤트
+typedef HANDLE event_t;
+
+typedef DWORD (WINAPI* thread_func_t)(void* p_param);
+#define THREAD_FUNC(name) DWORD WINAPI name(void* p_param)
+#define THREAD_RETURN 0
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+typedef pthread_t thread_t;
+typedef pthread_mutex_t lock_t;
+typedef pthread_cond_t cond_t;
+
+// 자동 리셋 이벤트 (깨어난 대기자가 신호를 소비)
+typedef struct event
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    bool b_signaled;
+} event_t;
+
+typedef void* (*thread_func_t)(void* p_param);
+#define THREAD_FUNC(name) void* name(void* p_param)
+#define THREAD_RETURN NULL
+
+#ifndef MAX_PATH
+#define MAX_PATH 260
+#endif // MAX_PATH
+#endif // _WIN32
+
+// 스레드
+
+FORCEINLINE bool create_thread(thread_t* p_out_thread, thread_func_t func, void* p_param)
+{
+#if defined(_WIN32)
+    *p_out_thread = CreateThread(NULL, 0, func, p_param, 0, NULL);
+    return *p_out_thread != NULL;
+#else
+    return pthread_create(p_out_thread, NULL, func, p_param) == 0;
+#endif // _WIN32
+}
+
+FORCEINLINE void join_thread(thread_t thread)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+#else
+    pthread_join(thread, NULL);
+#endif // _WIN32
+}
+
+FORCEINLINE size_t get_num_processors(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    return (size_t)system_info.dwNumberOfProcessors;
+#else
+    const long num_processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return (num_processors > 0) ? (size_t)num_processors : 1;
+#endif // _WIN32
+}
+
+// 락, 조건 변수
+
+FORCEINLINE void init_lock(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    InitializeCriticalSection(p_lock);
+#else
+    pthread_mutex_init(p_lock, NULL);
+#endif // _WIN32
+}
+
+FORCEINLINE void delete_lock(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    DeleteCriticalSection(p_lock);
+#else
+    pthread_mutex_destroy(p_lock);
+#endif // _WIN32
+}
+
+FORCEINLINE void enter_lock(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    EnterCriticalSection(p_lock);
+#else
+    pthread_mutex_lock(p_lock);
+#endif // _WIN32
+}
+
+FORCEINLINE void leave_lock(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    LeaveCriticalSection(p_lock);
+#else
+    pthread_mutex_unlock(p_lock);
+#endif // _WIN32
+}
+
+FORCEINLINE void init_cond(cond_t* p_cond)
+{
+#if defined(_WIN32)
+    InitializeConditionVariable(p_cond);
+#else
+    pthread_cond_init(p_cond, NULL);
+#endif // _WIN32
+}
+
+// CONDITION_VARIABLE은 해제할 것이 없음
+FORCEINLINE void delete_cond(cond_t* p_cond)
+{
+#if !defined(_WIN32)
+    pthread_cond_destroy(p_cond);
+#endif // _WIN32
+}
+
+// p_lock을 잡은 상태에서 호출, 깨어나면 다시 잡은 상태
+FORCEINLINE void wait_cond(cond_t* p_cond, lock_t* p_lock)
+{
+#if defined(_WIN32)
+    SleepConditionVariableCS(p_cond, p_lock, INFINITE);
+#else
+    pthread_cond_wait(p_cond, p_lock);
+#endif // _WIN32
+}
+
+FORCEINLINE void wake_cond(cond_t* p_cond)
+{
+#if defined(_WIN32)
+    WakeConditionVariable(p_cond);
+#else
+    pthread_cond_signal(p_cond);
+#endif // _WIN32
+}
+
+FORCEINLINE void wake_all_cond(cond_t* p_cond)
+{
+#if defined(_WIN32)
+    WakeAllConditionVariable(p_cond);
+#else
+    pthread_cond_broadcast(p_cond);
+#endif // _WIN32
+}
+
+// 이벤트
+
+FORCEINLINE bool init_event(event_t* p_event)
+{
+#if defined(_WIN32)
+    *p_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    return *p_event != NULL;
+#else
+    p_event->b_signaled = false;
+    if (pthread_mutex_init(&p_event->lock, NULL) != 0)
+    {
+        return false;
+    }
+    if (pthread_cond_init(&p_event->cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&p_event->lock);
+        return false;
+    }
+    return true;
+#endif // _WIN32
+}
+
+FORCEINLINE void delete_event(event_t* p_event)
+{
+#if defined(_WIN32)
+    CloseHandle(*p_event);
+#else
+    pthread_cond_destroy(&p_event->cond);
+    pthread_mutex_destroy(&p_event->lock);
+#endif // _WIN32
+}
+
+FORCEINLINE void set_event(event_t* p_event)
+{
+#if defined(_WIN32)
+    SetEvent(*p_event);
+#else
+    pthread_mutex_lock(&p_event->lock);
+    p_event->b_signaled = true;
+    pthread_cond_signal(&p_event->cond);
+    pthread_mutex_unlock(&p_event->lock);
+#endif // _WIN32
+}
+
+FORCEINLINE void wait_event(event_t* p_event)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(*p_event, INFINITE);
+#else
+    pthread_mutex_lock(&p_event->lock);
+    while (!p_event->b_signaled)
+    {
+        pthread_cond_wait(&p_event->cond, &p_event->lock);
+    }
+    p_event->b_signaled = false;
+    pthread_mutex_unlock(&p_event->lock);
+#endif // _WIN32
+}
+
+// 고해상도 카운터 (Windows는 QueryPerformanceCounter 틱, 그 외는 ns)
+
+FORCEINLINE uint64_t get_perf_counter(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)counter.QuadPart;
+#else
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000ull + (uint64_t)now.tv_nsec;
+#endif // _WIN32
+}
+
+FORCEINLINE uint64_t get_perf_frequency(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)frequency.QuadPart;
+#else
+    return 1000000000ull;
+#endif // _WIN32
+}
+
+#endif // PLATFORM_H
\ No newline at end of file
@@ -12,11 +12,13 @@
 
 #include "precompiled.h"
 #include "game.h"
+#include "game_save.h"
 
 HINSTANCE g_hinstance;
 HWND g_hwnd;
 
 HRESULT init_window(const int width, const int height);
+static int get_game_scale(const int monitor_height);
 LRESULT CALLBACK wnd_proc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
 
 int main(void)
@@ -33,47 +35,77 @@ int main(void)
     const int monitor_width = info.rcMonitor.right - info.rcMonitor.left;
     const int monitor_height = info.rcMonitor.bottom - info.rcMonitor.top;
 
-    const int num_max_rows = (monitor_height - INFO_HEIGHT * 3) / SPRITE_TILE_HEIGHT;
-    const int num_max_cols = monitor_width / SPRITE_TILE_WIDTH;
+    const int scale = get_game_scale(monitor_height);
+    printf("scale x%d\n", scale);
 
-    printf("rows(9 ~ %d)\n> ", num_max_rows);
-    scanf("%d", &rows);
-    printf("\n");
+    const int num_max_rows = (monitor_height - INFO_HEIGHT * scale * 3) / (SPRITE_TILE_HEIGHT * scale);
+    const int num_max_cols = monitor_width / (SPRITE_TILE_WIDTH * scale);
 
-    if (rows < 9 || rows > num_max_rows)
+    // 저장 파일이 있고 화면에 들어가는 크기면 이어서 할지 물음 (창 크기는 저장된 보드 크기)
+    bool b_load_save = false;
+    if (peek_game_save(GAME_SAVE_FILENAME, &rows, &cols, &num_mines)
+        && rows >= 9 && rows <= num_max_rows
+        && cols >= 9 && cols <= num_max_cols)
     {
-        MessageBox(NULL, L"Out of rows", L"rows", MB_OK | MB_ICONERROR);
-        return 0;
-    }
+        printf("continue saved game %d x %d, %d mines? (y/n)\n> ", rows, cols, num_mines);
+        char answer = 'n';
+        scanf(" %c", &answer);
+        printf("\n");
 
-    printf("cols(9 ~ %d)\n> ", num_max_cols);
-    scanf("%d", &cols);
-    printf("\n");
+        b_load_save = (answer == 'y' || answer == 'Y');
+    }
 
-    if (cols < 9 || cols > num_max_cols)
+    if (!b_load_save)
     {
-        MessageBox(NULL, L"Out of cols", L"cols", MB_OK | MB_ICONERROR);
-        return 0;
+        printf("rows(9 ~ %d)\n> ", num_max_rows);
+        scanf("%d", &rows);
+        printf("\n");
+
+        if (rows < 9 || rows > num_max_rows)
+        {
+            MessageBox(NULL, L"Out of rows", L"rows", MB_OK | MB_ICONERROR);
+            return 0;
+        }
+
+        printf("cols(9 ~ %d)\n> ", num_max_cols);
+        scanf("%d", &cols);
+        printf("\n");
+
+        if (cols < 9 || cols > num_max_cols)
+        {
+            MessageBox(NULL, L"Out of cols", L"cols", MB_OK | MB_ICONERROR);
+            return 0;
+        }
+
+        printf("num of mines(1 ~ %d)\n> ", rows * cols);
+        scanf("%d", &num_mines);
+        printf("\n");
+
+        if (num_mines < 1 || num_mines >= rows * cols)
+        {
+            MessageBox(NULL, L"Out of mines", L"num of mines", MB_OK | MB_ICONERROR);
+            return 0;
+        }
     }
 
-    printf("num of mines(1 ~ %d)\n> ", rows * cols);
-    scanf("%d", &num_mines);
-    printf("\n");
+    const int window_width = cols * SPRITE_TILE_WIDTH * scale;
+    const int window_height = (rows * SPRITE_TILE_HEIGHT + INFO_HEIGHT) * scale;
 
-    if (num_mines < 1 || num_mines >= rows * cols)
+    // 창 생성, DLL 초기화와 동시에 워커에서 스프라이트 로드
+    startup_begin();
+    if (!begin_load_game_assets())
     {
-        MessageBox(NULL, L"Out of mines", L"num of mines", MB_OK | MB_ICONERROR);
+        ASSERT(false, "Failed to load assets");
         return 0;
     }
-
-    const int window_width = cols * SPRITE_TILE_WIDTH;
-    const int window_height = rows * SPRITE_TILE_HEIGHT + INFO_HEIGHT;
+    startup_mark(STARTUP_PHASE_ASSET_SUBMIT);
 
     if (FAILED(init_window(window_width, window_height)))
     {
         ASSERT(false, "Failed to init window");
         return 0;
     }
+    startup_mark(STARTUP_PHASE_WINDOW);
 
     gp_game = (game_t*)malloc(sizeof(game_t));
     if (gp_game == NULL)
@@ -82,12 +114,18 @@ int main(void)
         return 0;
     }
 
-    if (!init_game(rows, cols, num_mines))
+    if (!init_game(rows, cols, num_mines, scale))
     {
         ASSERT(false, "Failed to init app");
         return 0;
     }
 
+    // 불러오지 못하면 새 게임으로 시작
+    if (b_load_save && !load_game(GAME_SAVE_FILENAME))
+    {
+        MessageBox(NULL, L"Failed to load saved game", L"load", MB_OK | MB_ICONWARNING);
+    }
+
     // Main message loop
     MSG msg = { 0 };
     while (msg.message != WM_QUIT)
@@ -103,12 +141,44 @@ int main(void)
         }
     }
 
+    // 진행 중인 게임은 창을 닫아도 이어서 할 수 있도록 저장
+    // 끝났거나 다시 시작한 게임이면 이전에 저장한 게임을 다음 실행에서 묻지 않도록 지움
+    if (is_running_game())
+    {
+        save_game(GAME_SAVE_FILENAME);
+    }
+    else
+    {
+        remove(GAME_SAVE_FILENAME);
+    }
+
     shutdown_game();
     SAFE_FREE(gp_game);
 
     return (int)msg.wParam;
 }
 
+// GAME_SCALE_ENV가 있으면 그 값, 없으면 1080p 단위 모니터 높이
+// 최소 보드 (9 x 9)가 화면에 들어가지 않는 배율은 줄임
+static int get_game_scale(const int monitor_height)
+{
+    int scale = monitor_height / 1080;
+
+    const char* scale_env = getenv(GAME_SCALE_ENV);
+    if (scale_env != NULL)
+    {
+        scale = atoi(scale_env);
+    }
+
+    scale = MIN(MAX(scale, 1), GAME_NUM_MAX_SCALE);
+    while (scale > 1 && (9 * SPRITE_TILE_HEIGHT + INFO_HEIGHT * 3) * scale > monitor_height)
+    {
+        --scale;
+    }
+
+    return scale;
+}
+
 HRESULT init_window(const int width, const int height)
 {
     // Register class
@@ -168,6 +238,7 @@ LRESULT CALLBACK wnd_proc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     {
         const int x = GET_X_LPARAM(lParam);
         const int y = GET_Y_LPARAM(lParam);
+        latency_begin_input(WM_LBUTTONDOWN);
         on_down_left_mouse();
         break;
     }
@@ -175,6 +246,7 @@ LRESULT CALLBACK wnd_proc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     {
         const int x = GET_X_LPARAM(lParam);
         const int y = GET_Y_LPARAM(lParam);
+        latency_begin_input(WM_LBUTTONUP);
         on_up_left_mouse();
         break;
     }
@@ -182,6 +254,7 @@ LRESULT CALLBACK wnd_proc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     {
         const int x = GET_X_LPARAM(lParam);
         const int y = GET_Y_LPARAM(lParam);
+        latency_begin_input(WM_RBUTTONDOWN);
         on_down_right_mouse();
         break;
     }
@@ -189,6 +262,7 @@ LRESULT CALLBACK wnd_proc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     {
         const int x = GET_X_LPARAM(lParam);
         const int y = GET_Y_LPARAM(lParam);
+        latency_begin_input(WM_RBUTTONUP);
         on_up_right_mouse();
         break;
     }
@@ -201,9 +275,11 @@ LRESULT CALLBACK wnd_proc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
     }
 
     case WM_KEYDOWN:
+        latency_begin_input(WM_KEYDOWN);
         on_key_down((uint8_t)wParam);
         break;
     case WM_KEYUP:
+        latency_begin_input(WM_KEYUP);
         on_key_up((uint8_t)wParam);
         break;
 
@@ -23,10 +23,16 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
+
+// 창, 입력, DLL 로드를 쓰는 파일만 Win32 API를 직접 사용
+// 나머지는 platform.h로만 사용하므로 Linux에서도 빌드됨
+#if defined(_WIN32)
 #include <Windows.h>
 #include <windowsx.h>
 #include <Commdlg.h>
+#endif // _WIN32
 
 #include "safe99_common/defines.h"
 #include "safe99_file_system/i_file_system.h"
@@ -35,6 +41,11 @@
 #include "safe99_math/math.h"
 
 #include "console_util.h"
+#include "debug_console.h"
 #include "key_event.h"
+#include "latency.h"
+#include "platform.h"
+#include "profiler.h"
+#include "startup.h"
 
 #endif // PRECOMPIELD_H
\ No newline at end of file
@@ -0,0 +1,282 @@
+﻿//***************************************************************************
+// 
+// 파일: profiler.c
+// 
+// 설명: 프레임 단위 구간 프로파일러
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "safe99_generic/util/hash_function.h"
+#include "profiler.h"
+
+#if defined(PROFILER_ENABLED)
+
+#define OVERLAY_BAR_WIDTH 2
+#define OVERLAY_MAX_TIME (1.0f / 30.0f)
+#define OVERLAY_BUDGET_TIME (1.0f / 60.0f)
+
+typedef struct profiler_zone
+{
+    const char* name;
+
+    // 프레임 시작 기준 (초)
+    float start_time;
+    float end_time;
+
+    uint32_t depth;
+} profiler_zone_t;
+
+typedef struct profiler_frame
+{
+    // 프로파일러 시작 기준 (초)
+    float start_time;
+    float duration;
+
+    // 누적 구간 번호
+    uint32_t first_zone;
+    uint32_t num_zones;
+} profiler_frame_t;
+
+typedef struct profiler_thread
+{
+    bool b_initialized;
+
+    safe99_timer_t app_timer;
+    safe99_timer_t frame_timer;
+
+    // 구간 링 버퍼, 인덱스는 누적 구간 번호 % PROFILER_NUM_MAX_ZONES
+    profiler_zone_t zones[PROFILER_NUM_MAX_ZONES];
+    uint32_t num_total_zones;
+
+    uint32_t zone_stack[PROFILER_NUM_MAX_DEPTH];
+    uint32_t depth;
+
+    // 스택이 가득 차서 기록하지 않은 begin_zone() 수, end_zone()이 먼저 소비함
+    uint32_t num_overflowed_zones;
+
+    // 프레임 링 버퍼
+    profiler_frame_t frames[PROFILER_NUM_MAX_FRAMES];
+    uint32_t num_total_frames;
+
+    float cur_frame_start_time;
+    uint32_t cur_first_zone;
+} profiler_thread_t;
+
+static void init_thread(void);
+static bool is_valid_zone(const uint32_t zone);
+static color_t get_zone_color(const char* name);
+
+static __declspec(thread) profiler_thread_t s_thread;
+
+void profiler_begin_frame(void)
+{
+    init_thread();
+
+    timer_init(&s_thread.frame_timer);
+    s_thread.cur_frame_start_time = timer_get_time(&s_thread.app_timer);
+    s_thread.cur_first_zone = s_thread.num_total_zones;
+    s_thread.depth = 0;
+    s_thread.num_overflowed_zones = 0;
+}
+
+void profiler_end_frame(void)
+{
+    ASSERT(s_thread.b_initialized, "profiler_begin_frame() not called");
+    ASSERT(s_thread.depth == 0 && s_thread.num_overflowed_zones == 0, "unbalanced zone");
+
+    profiler_frame_t* p_frame = &s_thread.frames[s_thread.num_total_frames % PROFILER_NUM_MAX_FRAMES];
+    p_frame->start_time = s_thread.cur_frame_start_time;
+    p_frame->duration = timer_get_time(&s_thread.frame_timer);
+    p_frame->first_zone = s_thread.cur_first_zone;
+    p_frame->num_zones = s_thread.num_total_zones - s_thread.cur_first_zone;
+
+    ++s_thread.num_total_frames;
+}
+
+void profiler_begin_zone(const char* name)
+{
+    ASSERT(name != NULL, "name == NULL");
+
+    init_thread();
+
+    if (s_thread.depth >= PROFILER_NUM_MAX_DEPTH)
+    {
+        // 짝이 되는 end_zone()이 부모 구간을 닫지 않도록 세어 둠
+        ASSERT(false, "too deep zone");
+        ++s_thread.num_overflowed_zones;
+        return;
+    }
+
+    const uint32_t zone = s_thread.num_total_zones++;
+
+    profiler_zone_t* p_zone = &s_thread.zones[zone % PROFILER_NUM_MAX_ZONES];
+    p_zone->name = name;
+    p_zone->depth = s_thread.depth;
+    p_zone->start_time = timer_get_time(&s_thread.frame_timer);
+    p_zone->end_time = p_zone->start_time;
+
+    s_thread.zone_stack[s_thread.depth++] = zone;
+}
+
+void profiler_end_zone(void)
+{
+    if (s_thread.num_overflowed_zones > 0)
+    {
+        --s_thread.num_overflowed_zones;
+        return;
+    }
+
+    ASSERT(s_thread.depth > 0, "unbalanced zone");
+
+    if (s_thread.depth == 0)
+    {
+        return;
+    }
+
+    const uint32_t zone = s_thread.zone_stack[--s_thread.depth];
+    s_thread.zones[zone % PROFILER_NUM_MAX_ZONES].end_time = timer_get_time(&s_thread.frame_timer);
+}
+
+void profiler_draw_overlay(i_soft_renderer_t* p_renderer, const int x, const int y, const int height)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+
+    const uint32_t num_frames = MIN(s_thread.num_total_frames, PROFILER_NUM_MAX_FRAMES);
+    const float pixels_per_second = (float)height / OVERLAY_MAX_TIME;
+    const int bottom = y + height;
+
+    for (uint32_t i = 0; i < num_frames; ++i)
+    {
+        const profiler_frame_t* p_frame = &s_thread.frames[(s_thread.num_total_frames - num_frames + i) % PROFILER_NUM_MAX_FRAMES];
+        const int bar_x = x + (int)i * OVERLAY_BAR_WIDTH;
+
+        // 프레임 전체 시간
+        const int frame_height = MIN(height, (int)(p_frame->duration * pixels_per_second));
+        for (int w = 0; w < OVERLAY_BAR_WIDTH; ++w)
+        {
+            p_renderer->vtbl->draw_line(p_renderer, bar_x + w, bottom, bar_x + w, bottom - frame_height,
+                                        argb_to_color(0xff404040));
+        }
+
+        // 최상위 구간만 아래부터 쌓음
+        int stacked_height = 0;
+        for (uint32_t j = 0; j < p_frame->num_zones; ++j)
+        {
+            const uint32_t zone = p_frame->first_zone + j;
+            if (!is_valid_zone(zone))
+            {
+                continue;
+            }
+
+            const profiler_zone_t* p_zone = &s_thread.zones[zone % PROFILER_NUM_MAX_ZONES];
+            if (p_zone->depth != 0)
+            {
+                continue;
+            }
+
+            const int zone_height = (int)((p_zone->end_time - p_zone->start_time) * pixels_per_second);
+            const int start_y = bottom - stacked_height;
+            const int end_y = MAX(y, start_y - zone_height);
+            if (zone_height > 0 && start_y > y)
+            {
+                const color_t color = get_zone_color(p_zone->name);
+                for (int w = 0; w < OVERLAY_BAR_WIDTH; ++w)
+                {
+                    p_renderer->vtbl->draw_line(p_renderer, bar_x + w, start_y, bar_x + w, end_y, color);
+                }
+            }
+
+            stacked_height += zone_height;
+        }
+    }
+
+    // 60fps 기준선
+    const int budget_y = bottom - (int)(OVERLAY_BUDGET_TIME * pixels_per_second);
+    p_renderer->vtbl->draw_line(p_renderer, x, budget_y, x + PROFILER_NUM_MAX_FRAMES * OVERLAY_BAR_WIDTH, budget_y,
+                                argb_to_color(0xffffffff));
+}
+
+bool profiler_export_chrome_trace(const char* filename)
+{
+    ASSERT(filename != NULL, "filename == NULL");
+
+    FILE* p_file = fopen(filename, "w");
+    if (p_file == NULL)
+    {
+        ASSERT(false, "Failed to open trace file");
+        return false;
+    }
+
+    const unsigned long thread_id = (unsigned long)GetCurrentThreadId();
+    const uint32_t num_frames = MIN(s_thread.num_total_frames, PROFILER_NUM_MAX_FRAMES);
+    bool b_first = true;
+
+    fprintf(p_file, "{\"traceEvents\":[");
+    for (uint32_t i = 0; i < num_frames; ++i)
+    {
+        const uint32_t frame = s_thread.num_total_frames - num_frames + i;
+        const profiler_frame_t* p_frame = &s_thread.frames[frame % PROFILER_NUM_MAX_FRAMES];
+        const double frame_start_us = (double)p_frame->start_time * 1000000.0;
+
+        fprintf(p_file, "%s\n{\"name\":\"frame %u\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+                b_first ? "" : ",", frame, thread_id, frame_start_us, (double)p_frame->duration * 1000000.0);
+        b_first = false;
+
+        for (uint32_t j = 0; j < p_frame->num_zones; ++j)
+        {
+            const uint32_t zone = p_frame->first_zone + j;
+            if (!is_valid_zone(zone))
+            {
+                continue;
+            }
+
+            const profiler_zone_t* p_zone = &s_thread.zones[zone % PROFILER_NUM_MAX_ZONES];
+            fprintf(p_file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%lu,\"ts\":%.3f,\"dur\":%.3f}",
+                    p_zone->name, thread_id,
+                    frame_start_us + (double)p_zone->start_time * 1000000.0,
+                    (double)(p_zone->end_time - p_zone->start_time) * 1000000.0);
+        }
+    }
+    fprintf(p_file, "\n]}\n");
+
+    fclose(p_file);
+    return true;
+}
+
+static void init_thread(void)
+{
+    if (s_thread.b_initialized)
+    {
+        return;
+    }
+
+    timer_init(&s_thread.app_timer);
+    timer_init(&s_thread.frame_timer);
+    s_thread.b_initialized = true;
+}
+
+static bool is_valid_zone(const uint32_t zone)
+{
+    // 링 버퍼에서 덮어써진 구간
+    return (s_thread.num_total_zones - zone <= PROFILER_NUM_MAX_ZONES);
+}
+
+static color_t get_zone_color(const char* name)
+{
+    static const uint32_t s_palette[] =
+    {
+        0xffe6194b, 0xff3cb44b, 0xffffe119, 0xff4363d8,
+        0xfff58231, 0xff911eb4, 0xff46f0f0, 0xfff032e6
+    };
+
+    // 같은 이름은 같은 색
+    const uint32_t hash = hash32_fnv1a(name, strlen(name));
+    return argb_to_color(s_palette[hash % (sizeof(s_palette) / sizeof(s_palette[0]))]);
+}
+
+#endif // PROFILER_ENABLED
\ No newline at end of file
@@ -0,0 +1,74 @@
+﻿//***************************************************************************
+// 
+// 파일: profiler.h
+// 
+// 설명: 프레임 단위 구간 프로파일러
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// PROFILE_BEGIN/PROFILE_END로 구간을 감싸면 스레드별 고정 크기 링 버퍼에 기록
+// 동적 할당 없음
+// PROFILER_ENABLED가 정의되지 않으면 모든 매크로는 빈 문장으로 컴파일됨
+// (디버그 빌드는 기본 활성화)
+// 
+//***************************************************************************
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "safe99_common/defines.h"
+#include "safe99_soft_renderer/i_soft_renderer.h"
+
+#if !defined(PROFILER_ENABLED) && !defined(NDEBUG)
+#define PROFILER_ENABLED
+#endif // PROFILER_ENABLED
+
+#define PROFILER_NUM_MAX_ZONES 4096
+#define PROFILER_NUM_MAX_FRAMES 128
+#define PROFILER_NUM_MAX_DEPTH 16
+
+#if defined(PROFILER_ENABLED)
+
+#define PROFILE_BEGIN_FRAME() profiler_begin_frame()
+#define PROFILE_END_FRAME() profiler_end_frame()
+#define PROFILE_BEGIN(name) profiler_begin_zone(name)
+#define PROFILE_END() profiler_end_zone()
+
+// name은 문자열 리터럴처럼 수명이 끝나지 않는 문자열이어야 함
+void profiler_begin_frame(void);
+void profiler_end_frame(void);
+void profiler_begin_zone(const char* name);
+void profiler_end_zone(void);
+
+// 최근 프레임을 막대 그래프로 그림 (한 프레임당 막대 하나, 위에서부터 구간별로 쌓음)
+void profiler_draw_overlay(i_soft_renderer_t* p_renderer, const int x, const int y, const int height);
+
+// chrome://tracing 형식
+bool profiler_export_chrome_trace(const char* filename);
+
+#else
+
+#define PROFILE_BEGIN_FRAME() ((void)0)
+#define PROFILE_END_FRAME() ((void)0)
+#define PROFILE_BEGIN(name) ((void)0)
+#define PROFILE_END() ((void)0)
+
+FORCEINLINE void profiler_draw_overlay(i_soft_renderer_t* p_renderer, const int x, const int y, const int height)
+{
+    (void)p_renderer;
+    (void)x;
+    (void)y;
+    (void)height;
+}
+
+FORCEINLINE bool profiler_export_chrome_trace(const char* filename)
+{
+    (void)filename;
+    return false;
+}
+
+#endif // PROFILER_ENABLED
+
+#endif // PROFILER_H
\ No newline at end of file
@@ -0,0 +1,214 @@
+﻿//***************************************************************************
+// 
+// 파일: sprite_atlas.c
+// 
+// 설명: 타일, 숫자, 얼굴 스프라이트를 하나로 묶은 아틀라스
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "game.h"
+#include "sprite_atlas.h"
+#include "safe99_soft_renderer/argb_scale.h"
+
+// 스프라이트 시작 오프셋을 16바이트 단위로 맞춤 (x64 malloc은 16바이트 정렬)
+#define SPRITE_ATLAS_PIXEL_ALIGNMENT 4
+
+typedef struct sprite_sheet
+{
+    const i_texture_t* p_texture;
+    int first_sprite_id;
+    int num_sprites;
+    int num_sprites_per_row;
+    int sprite_width;
+    int sprite_height;
+} sprite_sheet_t;
+
+static size_t get_aligned_num_pixels(const size_t num_pixels);
+
+bool sprite_atlas_build(sprite_atlas_t* p_atlas,
+                        const i_texture_t* p_tiles_texture,
+                        const i_texture_t* p_numbers_texture,
+                        const i_texture_t* p_faces_texture)
+{
+    ASSERT(p_atlas != NULL, "p_atlas == NULL");
+    ASSERT(p_tiles_texture != NULL, "p_tiles_texture == NULL");
+    ASSERT(p_numbers_texture != NULL, "p_numbers_texture == NULL");
+    ASSERT(p_faces_texture != NULL, "p_faces_texture == NULL");
+
+    memset(p_atlas, 0, sizeof(sprite_atlas_t));
+
+    // 타일 시트는 윗줄에 TILE_BLIND ~ TILE_FLAG_MINE, 아랫줄에 TILE_1 ~ TILE_8
+    const sprite_sheet_t sheets[] =
+    {
+        { p_tiles_texture, SPRITE_ID_TILE, SPRITE_ATLAS_NUM_TILES, 8, SPRITE_TILE_WIDTH, SPRITE_TILE_HEIGHT },
+        { p_numbers_texture, SPRITE_ID_DIGIT, SPRITE_ATLAS_NUM_DIGITS, SPRITE_ATLAS_NUM_DIGITS, SPRITE_NUMBER_WIDTH, SPRITE_NUMBER_HEIGHT },
+        { p_faces_texture, SPRITE_ID_FACE, SPRITE_ATLAS_NUM_FACES, SPRITE_ATLAS_NUM_FACES, SPRITE_FACE_WIDTH, SPRITE_FACE_HEIGHT }
+    };
+    const size_t num_sheets = sizeof(sheets) / sizeof(sheets[0]);
+
+    // 크기 검증, 전체 픽셀 수 계산
+    size_t num_pixels = 0;
+    for (size_t i = 0; i < num_sheets; ++i)
+    {
+        const sprite_sheet_t* p_sheet = &sheets[i];
+        const int num_rows = (p_sheet->num_sprites + p_sheet->num_sprites_per_row - 1) / p_sheet->num_sprites_per_row;
+
+        if ((int)p_sheet->p_texture->vtbl->get_width(p_sheet->p_texture) < p_sheet->num_sprites_per_row * p_sheet->sprite_width
+            || (int)p_sheet->p_texture->vtbl->get_height(p_sheet->p_texture) < num_rows * p_sheet->sprite_height)
+        {
+            ASSERT(false, "Sprite sheet too small");
+            return false;
+        }
+
+        num_pixels += get_aligned_num_pixels((size_t)(p_sheet->sprite_width * p_sheet->sprite_height)) * p_sheet->num_sprites;
+    }
+
+    p_atlas->pa_pixels = (uint32_t*)malloc(sizeof(uint32_t) * num_pixels);
+    if (p_atlas->pa_pixels == NULL)
+    {
+        ASSERT(false, "Failed to malloc atlas");
+        return false;
+    }
+    p_atlas->num_pixels = num_pixels;
+
+    uint32_t* p_dst = p_atlas->pa_pixels;
+    for (size_t i = 0; i < num_sheets; ++i)
+    {
+        const sprite_sheet_t* p_sheet = &sheets[i];
+        const uint32_t* p_bitmap = (const uint32_t*)p_sheet->p_texture->vtbl->get_bitmap(p_sheet->p_texture);
+        const size_t bitmap_width = p_sheet->p_texture->vtbl->get_width(p_sheet->p_texture);
+
+        for (int j = 0; j < p_sheet->num_sprites; ++j)
+        {
+            const int src_x = (j % p_sheet->num_sprites_per_row) * p_sheet->sprite_width;
+            const int src_y = (j / p_sheet->num_sprites_per_row) * p_sheet->sprite_height;
+
+            bool b_opaque = true;
+            for (int y = 0; y < p_sheet->sprite_height; ++y)
+            {
+                const uint32_t* p_src = p_bitmap + (size_t)(src_y + y) * bitmap_width + src_x;
+                uint32_t* p_dst_row = p_dst + (size_t)y * p_sheet->sprite_width;
+
+                for (int x = 0; x < p_sheet->sprite_width; ++x)
+                {
+                    // 알파 정규화
+                    const uint32_t alpha = (p_src[x] >> 24 >= 0x80) ? 0xff000000 : 0;
+                    p_dst_row[x] = (p_src[x] & 0x00ffffff) | alpha;
+                    b_opaque &= (alpha != 0);
+                }
+            }
+
+            atlas_sprite_t* p_sprite = &p_atlas->sprites[p_sheet->first_sprite_id + j];
+            p_sprite->p_pixels = p_dst;
+            p_sprite->width = p_sheet->sprite_width;
+            p_sprite->height = p_sheet->sprite_height;
+            p_sprite->b_opaque = b_opaque;
+
+            p_dst += get_aligned_num_pixels((size_t)(p_sheet->sprite_width * p_sheet->sprite_height));
+        }
+    }
+
+    return true;
+}
+
+void sprite_atlas_release(sprite_atlas_t* p_atlas)
+{
+    ASSERT(p_atlas != NULL, "p_atlas == NULL");
+
+    SAFE_FREE(p_atlas->pa_pixels);
+    memset(p_atlas, 0, sizeof(sprite_atlas_t));
+}
+
+bool sprite_atlas_build_scaled(sprite_atlas_t* p_atlas, const sprite_atlas_t* p_src_atlas, const int scale)
+{
+    ASSERT(p_atlas != NULL, "p_atlas == NULL");
+    ASSERT(p_src_atlas != NULL, "p_src_atlas == NULL");
+    ASSERT(p_atlas != p_src_atlas, "p_atlas == p_src_atlas");
+    ASSERT(scale >= 1, "scale < 1");
+
+    memset(p_atlas, 0, sizeof(sprite_atlas_t));
+
+    const size_t scale_squared = (size_t)scale * scale;
+
+    size_t num_pixels = 0;
+    for (int i = 0; i < SPRITE_ID_COUNT; ++i)
+    {
+        const atlas_sprite_t* p_src_sprite = &p_src_atlas->sprites[i];
+        num_pixels += get_aligned_num_pixels((size_t)p_src_sprite->width * p_src_sprite->height * scale_squared);
+    }
+
+    p_atlas->pa_pixels = (uint32_t*)malloc(sizeof(uint32_t) * num_pixels);
+    if (p_atlas->pa_pixels == NULL)
+    {
+        ASSERT(false, "Failed to malloc scaled atlas");
+        return false;
+    }
+    p_atlas->num_pixels = num_pixels;
+
+    uint32_t* p_dst = p_atlas->pa_pixels;
+    for (int i = 0; i < SPRITE_ID_COUNT; ++i)
+    {
+        const atlas_sprite_t* p_src_sprite = &p_src_atlas->sprites[i];
+        scale_argb_nearest(p_src_sprite->p_pixels, (size_t)p_src_sprite->width, (size_t)p_src_sprite->height, p_dst, scale);
+
+        atlas_sprite_t* p_sprite = &p_atlas->sprites[i];
+        p_sprite->p_pixels = p_dst;
+        p_sprite->width = p_src_sprite->width * scale;
+        p_sprite->height = p_src_sprite->height * scale;
+        p_sprite->b_opaque = p_src_sprite->b_opaque;
+
+        p_dst += get_aligned_num_pixels((size_t)p_sprite->width * p_sprite->height);
+    }
+
+    return true;
+}
+
+void sprite_atlas_blit(const atlas_sprite_t* p_sprite,
+                       uint32_t* p_dst, const size_t dst_width, const size_t dst_height,
+                       const int x, const int y)
+{
+    ASSERT(p_sprite != NULL, "p_sprite == NULL");
+    ASSERT(p_dst != NULL, "p_dst == NULL");
+
+    // 클리핑
+    const int start_x = MAX(0, -x);
+    const int start_y = MAX(0, -y);
+    const int end_x = MIN(p_sprite->width, (int)dst_width - x);
+    const int end_y = MIN(p_sprite->height, (int)dst_height - y);
+    if (start_x >= end_x || start_y >= end_y)
+    {
+        return;
+    }
+
+    const size_t row_size = sizeof(uint32_t) * (size_t)(end_x - start_x);
+
+    for (int i = start_y; i < end_y; ++i)
+    {
+        const uint32_t* p_src_row = p_sprite->p_pixels + (size_t)i * p_sprite->width + start_x;
+        uint32_t* p_dst_row = p_dst + (size_t)(y + i) * dst_width + x + start_x;
+
+        if (p_sprite->b_opaque)
+        {
+            memcpy(p_dst_row, p_src_row, row_size);
+            continue;
+        }
+
+        for (int j = 0; j < end_x - start_x; ++j)
+        {
+            if (p_src_row[j] >> 24 != 0)
+            {
+                p_dst_row[j] = p_src_row[j];
+            }
+        }
+    }
+}
+
+static size_t get_aligned_num_pixels(const size_t num_pixels)
+{
+    return (num_pixels + SPRITE_ATLAS_PIXEL_ALIGNMENT - 1) & ~(size_t)(SPRITE_ATLAS_PIXEL_ALIGNMENT - 1);
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+﻿//***************************************************************************
+// 
+// 파일: sprite_atlas.h
+// 
+// 설명: 타일, 숫자, 얼굴 스프라이트를 하나로 묶은 아틀라스
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 로드 시점에 스프라이트 시트 3개를 잘라 버퍼 하나에 스프라이트 단위로 연속 배치
+// - 스프라이트 하나의 픽셀은 pitch == width인 연속 블록
+// - 픽셀은 렌더러 프레임 버퍼와 같은 32비트 0xAARRGGBB
+//   알파는 0x00/0xff로 정규화해서 블릿이 비교 한 번으로 끝나도록 함
+// - 모든 픽셀이 불투명한 스프라이트는 b_opaque, 블릿이 행 단위 memcpy가 됨
+// 그리기 경로는 sprites[]만 읽으므로 프레임마다 텍스쳐 vtbl을 호출하지 않음
+// 확대 모드는 확대한 아틀라스를 따로 만들어 두므로 그리기 경로는 배율과 무관하게 복사만 함
+// 
+//***************************************************************************
+
+#ifndef SPRITE_ATLAS_H
+#define SPRITE_ATLAS_H
+
+#include "safe99_common/defines.h"
+
+#define SPRITE_ATLAS_NUM_TILES 16
+#define SPRITE_ATLAS_NUM_DIGITS 10
+#define SPRITE_ATLAS_NUM_FACES 5
+
+typedef enum sprite_id
+{
+    // tile_t 값 그대로 더함
+    SPRITE_ID_TILE = 0,
+    SPRITE_ID_DIGIT = SPRITE_ID_TILE + SPRITE_ATLAS_NUM_TILES,
+    SPRITE_ID_FACE = SPRITE_ID_DIGIT + SPRITE_ATLAS_NUM_DIGITS,
+    SPRITE_ID_COUNT = SPRITE_ID_FACE + SPRITE_ATLAS_NUM_FACES
+} sprite_id_t;
+
+typedef struct atlas_sprite
+{
+    const uint32_t* p_pixels;
+    int width;
+    int height;
+    bool b_opaque;
+} atlas_sprite_t;
+
+typedef struct sprite_atlas
+{
+    uint32_t* pa_pixels;
+    size_t num_pixels;
+
+    atlas_sprite_t sprites[SPRITE_ID_COUNT];
+} sprite_atlas_t;
+
+START_EXTERN_C
+
+// 텍스쳐는 빌드 후 해제해도 됨
+bool sprite_atlas_build(sprite_atlas_t* p_atlas,
+                        const i_texture_t* p_tiles_texture,
+                        const i_texture_t* p_numbers_texture,
+                        const i_texture_t* p_faces_texture);
+void sprite_atlas_release(sprite_atlas_t* p_atlas);
+
+// p_src_atlas의 모든 스프라이트를 scale배 최근접 확대한 아틀라스 생성 (로드 시점에 한 번)
+bool sprite_atlas_build_scaled(sprite_atlas_t* p_atlas, const sprite_atlas_t* p_src_atlas, const int scale);
+
+// 게임이 직접 소유한 프레임 버퍼에 그릴 때 사용, 범위 밖은 잘라냄
+void sprite_atlas_blit(const atlas_sprite_t* p_sprite,
+                       uint32_t* p_dst, const size_t dst_width, const size_t dst_height,
+                       const int x, const int y);
+
+FORCEINLINE const atlas_sprite_t* sprite_atlas_get(const sprite_atlas_t* p_atlas, const int sprite_id)
+{
+    ASSERT(p_atlas != NULL, "p_atlas == NULL");
+    ASSERT(sprite_id >= 0 && sprite_id < SPRITE_ID_COUNT, "invalid sprite_id");
+
+    return &p_atlas->sprites[sprite_id];
+}
+
+END_EXTERN_C
+
+#endif // SPRITE_ATLAS_H
\ No newline at end of file
@@ -0,0 +1,90 @@
+﻿//***************************************************************************
+// 
+// 파일: startup.c
+// 
+// 설명: 시작 단계별 시간 측정
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "startup.h"
+
+static uint64_t s_frequency;
+static uint64_t s_begin_counter;
+static uint64_t s_last_counter;
+
+// 단계별 시간 (ms)
+static float s_phase_times[STARTUP_NUM_PHASES];
+static float s_time_to_first_frame;
+
+static const char* const s_phase_names[STARTUP_NUM_PHASES] =
+{
+    "asset_submit",
+    "window",
+    "dll_load",
+    "renderer_init",
+    "file_system_init",
+    "game_init",
+    "asset_wait",
+    "first_frame"
+};
+
+void startup_begin(void)
+{
+    s_frequency = get_perf_frequency();
+    s_begin_counter = get_perf_counter();
+    s_last_counter = s_begin_counter;
+
+    memset(s_phase_times, 0, sizeof(s_phase_times));
+    s_time_to_first_frame = 0.0f;
+}
+
+void startup_mark(const startup_phase_t phase)
+{
+    ASSERT(phase >= 0 && phase < STARTUP_NUM_PHASES, "invalid phase");
+
+    if (s_frequency == 0)
+    {
+        return;
+    }
+
+    const uint64_t now = get_perf_counter();
+    s_phase_times[phase] = (float)(now - s_last_counter) * 1000.0f / (float)s_frequency;
+    s_last_counter = now;
+
+    if (phase == STARTUP_PHASE_FIRST_FRAME)
+    {
+        s_time_to_first_frame = (float)(now - s_begin_counter) * 1000.0f / (float)s_frequency;
+    }
+}
+
+float startup_get_phase_time(const startup_phase_t phase)
+{
+    ASSERT(phase >= 0 && phase < STARTUP_NUM_PHASES, "invalid phase");
+    return s_phase_times[phase];
+}
+
+float startup_get_time_to_first_frame(void)
+{
+    return s_time_to_first_frame;
+}
+
+const char* startup_get_phase_name(const startup_phase_t phase)
+{
+    ASSERT(phase >= 0 && phase < STARTUP_NUM_PHASES, "invalid phase");
+    return s_phase_names[phase];
+}
+
+void startup_print(void)
+{
+    printf("startup:");
+    for (int i = 0; i < STARTUP_NUM_PHASES; ++i)
+    {
+        printf(" %s %.2fms", s_phase_names[i], s_phase_times[i]);
+    }
+    printf("\ntime-to-first-frame %.2fms\n", s_time_to_first_frame);
+}
\ No newline at end of file
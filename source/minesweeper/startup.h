@@ -0,0 +1,50 @@
+﻿//***************************************************************************
+// 
+// 파일: startup.h
+// 
+// 설명: 시작 단계별 시간 측정
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// startup_begin() 시점부터 각 단계가 끝난 시간을 get_perf_counter()로 기록
+// 마지막 단계 STARTUP_PHASE_FIRST_FRAME까지의 시간이 time-to-first-frame
+// 에셋 로드는 워커에서 다른 단계와 겹쳐 진행되므로
+// STARTUP_PHASE_ASSET_WAIT은 첫 프레임이 에셋을 기다린 시간만 나타냄
+// 
+//***************************************************************************
+
+#ifndef STARTUP_H
+#define STARTUP_H
+
+#include "safe99_common/defines.h"
+
+typedef enum startup_phase
+{
+    STARTUP_PHASE_ASSET_SUBMIT,
+    STARTUP_PHASE_WINDOW,
+    STARTUP_PHASE_DLL_LOAD,
+    STARTUP_PHASE_RENDERER_INIT,
+    STARTUP_PHASE_FILE_SYSTEM_INIT,
+    STARTUP_PHASE_GAME_INIT,
+    STARTUP_PHASE_ASSET_WAIT,
+    STARTUP_PHASE_FIRST_FRAME,
+    STARTUP_NUM_PHASES
+} startup_phase_t;
+
+void startup_begin(void);
+
+// 직전 단계가 끝난 시점부터 지금까지를 phase의 시간으로 기록
+void startup_mark(const startup_phase_t phase);
+
+// 기록되지 않은 단계는 0
+float startup_get_phase_time(const startup_phase_t phase);
+float startup_get_time_to_first_frame(void);
+
+const char* startup_get_phase_name(const startup_phase_t phase);
+
+// 콘솔에 단계별 시간 출력 (ms)
+void startup_print(void);
+
+#endif // STARTUP_H
\ No newline at end of file
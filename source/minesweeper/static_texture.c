@@ -0,0 +1,80 @@
+﻿//***************************************************************************
+// 
+// 파일: static_texture.c
+// 
+// 설명: 정적 메모리 위의 텍스쳐
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "static_texture.h"
+
+static size_t __stdcall texture_add_ref(i_texture_t* p_this);
+static size_t __stdcall texture_release(i_texture_t* p_this);
+static size_t __stdcall texture_get_ref_count(const i_texture_t* p_this);
+static size_t __stdcall texture_get_width(const i_texture_t* p_this);
+static size_t __stdcall texture_get_height(const i_texture_t* p_this);
+static const char* __stdcall texture_get_bitmap(const i_texture_t* p_this);
+
+static i_texture_vtbl_t s_texture_vtbl =
+{
+    texture_add_ref,
+    texture_release,
+    texture_get_ref_count,
+    texture_get_width,
+    texture_get_height,
+    texture_get_bitmap
+};
+
+void init_static_texture(static_texture_t* p_texture, const size_t width, const size_t height, const uint32_t* p_bitmap)
+{
+    ASSERT(p_texture != NULL, "p_texture == NULL");
+    ASSERT(width > 0, "width == 0");
+    ASSERT(height > 0, "height == 0");
+    ASSERT(p_bitmap != NULL, "p_bitmap == NULL");
+
+    p_texture->base.vtbl = &s_texture_vtbl;
+    p_texture->width = width;
+    p_texture->height = height;
+    p_texture->p_bitmap = p_bitmap;
+}
+
+static size_t __stdcall texture_add_ref(i_texture_t* p_this)
+{
+    (void)p_this;
+    return 1;
+}
+
+static size_t __stdcall texture_release(i_texture_t* p_this)
+{
+    (void)p_this;
+    return 1;
+}
+
+static size_t __stdcall texture_get_ref_count(const i_texture_t* p_this)
+{
+    (void)p_this;
+    return 1;
+}
+
+static size_t __stdcall texture_get_width(const i_texture_t* p_this)
+{
+    const static_texture_t* p_texture = (const static_texture_t*)p_this;
+    return p_texture->width;
+}
+
+static size_t __stdcall texture_get_height(const i_texture_t* p_this)
+{
+    const static_texture_t* p_texture = (const static_texture_t*)p_this;
+    return p_texture->height;
+}
+
+static const char* __stdcall texture_get_bitmap(const i_texture_t* p_this)
+{
+    const static_texture_t* p_texture = (const static_texture_t*)p_this;
+    return (const char*)p_texture->p_bitmap;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+﻿//***************************************************************************
+// 
+// 파일: static_texture.h
+// 
+// 설명: 정적 메모리 위의 텍스쳐
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 비트맵과 텍스쳐 객체 모두 호출자가 소유하므로 할당이 없음
+// 참조 카운트가 없어 add_ref/release는 아무 일도 하지 않음 (SAFE_RELEASE해도 안전)
+// 
+//***************************************************************************
+
+#ifndef STATIC_TEXTURE_H
+#define STATIC_TEXTURE_H
+
+#include "safe99_common/defines.h"
+
+typedef struct static_texture
+{
+    i_texture_t base;
+
+    size_t width;
+    size_t height;
+    const uint32_t* p_bitmap;
+} static_texture_t;
+
+// p_bitmap은 텍스쳐보다 오래 유지되어야 함
+void init_static_texture(static_texture_t* p_texture, const size_t width, const size_t height, const uint32_t* p_bitmap);
+
+#endif // STATIC_TEXTURE_H
\ No newline at end of file
@@ -0,0 +1,149 @@
+﻿//***************************************************************************
+// 
+// 파일: text_cache.c
+// 
+// 설명: 비트맵 폰트로 그린 문자열 캐시
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "text_cache.h"
+
+static text_cache_entry_t* get_free_entry(text_cache_t* p_cache);
+
+bool text_cache_init(text_cache_t* p_cache, const bitmap_font_t* p_font)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+    ASSERT(p_font != NULL, "p_font == NULL");
+
+    memset(p_cache, 0, sizeof(text_cache_t));
+    p_cache->p_font = p_font;
+
+    if (!flat_map_initialize(&p_cache->map, sizeof(uint64_t), sizeof(uint32_t), TEXT_CACHE_NUM_MAX_ENTRIES))
+    {
+        ASSERT(false, "Failed to init text cache map");
+        return false;
+    }
+
+    return true;
+}
+
+void text_cache_release(text_cache_t* p_cache)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+
+    for (size_t i = 0; i < p_cache->num_entries; ++i)
+    {
+        SAFE_FREE(p_cache->entries[i].pa_pixels);
+    }
+
+    flat_map_release(&p_cache->map);
+    memset(p_cache, 0, sizeof(text_cache_t));
+}
+
+const atlas_sprite_t* text_cache_get_sprite(text_cache_t* p_cache, const char* text, size_t length, const uint32_t argb)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+    ASSERT(text != NULL, "text == NULL");
+
+    length = MIN(length, TEXT_CACHE_MAX_LENGTH);
+
+    // 이미 잘 섞인 64비트 해시이므로 키 자체를 flat_map 해시로 사용
+    const uint64_t hash = hash64_wyhash_seed(text, length, argb);
+
+    text_cache_entry_t* p_entry = NULL;
+    bool b_indexed = true;
+
+    const uint32_t* p_index = (const uint32_t*)flat_map_get_value_by_hash_or_null(&p_cache->map, hash, &hash, sizeof(uint64_t));
+    if (p_index != NULL)
+    {
+        p_entry = &p_cache->entries[*p_index];
+        if (p_entry->length == length && p_entry->argb == argb && memcmp(p_entry->text, text, length) == 0)
+        {
+            ++p_cache->num_hits;
+            p_entry->last_used_frame = p_cache->frame;
+            return &p_entry->sprite;
+        }
+
+        // 해시 충돌, 같은 항목에 새 문자열을 그림
+    }
+    else
+    {
+        p_entry = get_free_entry(p_cache);
+
+        const uint32_t index = (uint32_t)(p_entry - p_cache->entries);
+        if (flat_map_insert_by_hash(&p_cache->map, hash, &hash, sizeof(uint64_t), &index, sizeof(uint32_t)) != FLAT_MAP_INSERT_RESULT_SUCCESS)
+        {
+            // 맵을 확장하지 못함, 이번에만 그리고 맵에 없는 항목이므로 가장 먼저 재사용되게 함
+            ASSERT(false, "Failed to insert text cache entry");
+            b_indexed = false;
+        }
+    }
+
+    ++p_cache->num_misses;
+
+    const bitmap_font_t* p_font = p_cache->p_font;
+    const int width = bitmap_font_get_text_width(p_font, length);
+    const size_t num_pixels = (size_t)width * p_font->glyph_height;
+
+    if (num_pixels > p_entry->num_max_pixels)
+    {
+        uint32_t* pa_pixels = (uint32_t*)realloc(p_entry->pa_pixels, sizeof(uint32_t) * num_pixels);
+        if (pa_pixels == NULL)
+        {
+            ASSERT(false, "Failed to realloc text pixels");
+            length = 0;
+        }
+        else
+        {
+            p_entry->pa_pixels = pa_pixels;
+            p_entry->num_max_pixels = num_pixels;
+        }
+    }
+
+    memcpy(p_entry->text, text, length);
+    p_entry->length = length;
+    p_entry->argb = argb;
+    p_entry->hash = hash;
+    p_entry->last_used_frame = b_indexed ? p_cache->frame : p_cache->frame - UINT32_MAX / 2;
+
+    bitmap_font_render(p_font, text, length, argb, p_entry->pa_pixels);
+
+    p_entry->sprite.p_pixels = p_entry->pa_pixels;
+    p_entry->sprite.width = bitmap_font_get_text_width(p_font, length);
+    p_entry->sprite.height = p_font->glyph_height;
+    p_entry->sprite.b_opaque = false;
+
+    return &p_entry->sprite;
+}
+
+// 빈 항목이 없으면 가장 오래 쓰지 않은 항목을 맵에서 빼고 재사용
+static text_cache_entry_t* get_free_entry(text_cache_t* p_cache)
+{
+    if (p_cache->num_entries < TEXT_CACHE_NUM_MAX_ENTRIES)
+    {
+        return &p_cache->entries[p_cache->num_entries++];
+    }
+
+    text_cache_entry_t* p_oldest = &p_cache->entries[0];
+    for (size_t i = 1; i < TEXT_CACHE_NUM_MAX_ENTRIES; ++i)
+    {
+        // 프레임 번호가 한 바퀴 돌아도 차이로 비교
+        if (p_cache->frame - p_cache->entries[i].last_used_frame > p_cache->frame - p_oldest->last_used_frame)
+        {
+            p_oldest = &p_cache->entries[i];
+        }
+    }
+
+    // 맵에 넣지 못한 항목이면 같은 해시의 다른 항목을 지우지 않도록 인덱스 확인
+    const uint32_t* p_index = (const uint32_t*)flat_map_get_value_by_hash_or_null(&p_cache->map, p_oldest->hash, &p_oldest->hash, sizeof(uint64_t));
+    if (p_index != NULL && *p_index == (uint32_t)(p_oldest - p_cache->entries))
+    {
+        flat_map_remove_by_hash(&p_cache->map, p_oldest->hash, &p_oldest->hash, sizeof(uint64_t));
+    }
+    return p_oldest;
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+//***************************************************************************
+//
+// 파일: text_cache.h
+//
+// 설명: 비트맵 폰트로 그린 문자열 캐시
+//
+// 작성자: bumpsgoodman
+//
+// 작성일: 2026/10/19
+//
+// 문자열 + 색을 hash64_wyhash로 해시해서 flat_map에서 찾고
+// 있으면 이전에 그려 둔 비트맵을 스프라이트로 그대로 돌려줌 (매 프레임 같은 라벨은 레이아웃 없음)
+// - 없으면 가장 오래 쓰지 않은 항목을 재사용해서 bitmap_font_render로 다시 그림
+// - 해시가 같아도 문자열과 색을 비교하므로 충돌이 나도 잘못된 비트맵을 쓰지 않음
+// 반환한 atlas_sprite_t는 아틀라스 스프라이트와 같은 draw_bitmap 경로로 그림
+//
+//***************************************************************************
+
+#ifndef TEXT_CACHE_H
+#define TEXT_CACHE_H
+
+#include "safe99_common/defines.h"
+#include "safe99_generic/flat_map.h"
+#include "bitmap_font.h"
+#include "sprite_atlas.h"
+
+#define TEXT_CACHE_NUM_MAX_ENTRIES 64
+
+// 더 긴 문자열은 잘라서 그림
+#define TEXT_CACHE_MAX_LENGTH 128
+
+typedef struct text_cache_entry
+{
+    char text[TEXT_CACHE_MAX_LENGTH];
+    size_t length;
+    uint32_t argb;
+
+    uint64_t hash;
+    uint32_t last_used_frame;
+
+    atlas_sprite_t sprite;
+    uint32_t* pa_pixels;
+    size_t num_max_pixels;
+} text_cache_entry_t;
+
+typedef struct text_cache
+{
+    const bitmap_font_t* p_font;
+
+    // 해시 -> entries 인덱스 (uint32_t)
+    flat_map_t map;
+
+    text_cache_entry_t entries[TEXT_CACHE_NUM_MAX_ENTRIES];
+    size_t num_entries;
+
+    uint32_t frame;
+
+    size_t num_hits;
+    size_t num_misses;
+} text_cache_t;
+
+START_EXTERN_C
+
+// p_font는 캐시보다 오래 살아야 함
+bool text_cache_init(text_cache_t* p_cache, const bitmap_font_t* p_font);
+void text_cache_release(text_cache_t* p_cache);
+
+// 프레임 시작마다 호출 (오래된 항목 판단용)
+FORCEINLINE void text_cache_begin_frame(text_cache_t* p_cache)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+    ++p_cache->frame;
+}
+
+// 한 프레임에 TEXT_CACHE_NUM_MAX_ENTRIES개보다 많은 문자열을 그리면 앞의 스프라이트가 재사용되므로 받은 즉시 그림
+const atlas_sprite_t* text_cache_get_sprite(text_cache_t* p_cache, const char* text, const size_t length, const uint32_t argb);
+
+END_EXTERN_C
+
+#endif // TEXT_CACHE_H
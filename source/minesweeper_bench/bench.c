@@ -0,0 +1,396 @@
+﻿//***************************************************************************
+// 
+// 파일: bench.c
+// 
+// 설명: 마이크로 벤치마크 하네스
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_math/math_misc.h"
+
+#include "bench.h"
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <Psapi.h>
+#else
+#include <sys/resource.h>
+#include <time.h>
+#endif // _WIN32
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+static int compare_double(const void* p_a, const void* p_b);
+static double get_median(double* p_sorted_values, const size_t num_values);
+static int open_cache_miss_counter(void);
+static void close_cache_miss_counter(const int fd);
+static void start_cache_miss_counter(const int fd);
+static uint64_t stop_cache_miss_counter(const int fd);
+
+static const void* volatile s_p_sink;
+
+bool bench_init(bench_t* p_bench, const char* filename_or_null, const size_t num_warmups, const size_t num_repetitions, const char* filter_or_null)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+    ASSERT(num_repetitions > 0, "num_repetitions == 0");
+
+    memset(p_bench, 0, sizeof(bench_t));
+
+    if (filename_or_null != NULL)
+    {
+        p_bench->p_out = fopen(filename_or_null, "w");
+        if (p_bench->p_out == NULL)
+        {
+            ASSERT(false, "Failed to open output");
+            return false;
+        }
+        p_bench->b_close_out = true;
+    }
+    else
+    {
+        p_bench->p_out = stdout;
+        p_bench->b_close_out = false;
+    }
+
+    p_bench->num_warmups = num_warmups;
+    p_bench->num_repetitions = MIN(num_repetitions, BENCH_NUM_MAX_REPETITIONS);
+    p_bench->filter_or_null = filter_or_null;
+    p_bench->num_results = 0;
+    p_bench->perf_fd = open_cache_miss_counter();
+
+#if defined(_M_X64) || defined(__x86_64__)
+    const char* p_arch = "x64";
+#else
+    const char* p_arch = "x86";
+#endif // ARCH
+
+#if defined(_MSC_VER)
+    const char* p_compiler = "msvc";
+#elif defined(__clang__)
+    const char* p_compiler = "clang";
+#elif defined(__GNUC__)
+    const char* p_compiler = "gcc";
+#else
+    const char* p_compiler = "unknown";
+#endif // COMPILER
+
+    fprintf(p_bench->p_out, "{\n");
+    fprintf(p_bench->p_out, "  \"context\": {\"arch\": \"%s\", \"compiler\": \"%s\", \"seed\": %u, \"warmups\": %zu, \"repetitions\": %zu, \"cache_miss_counter\": %s},\n",
+            p_arch, p_compiler, BENCH_SEED, p_bench->num_warmups, p_bench->num_repetitions, (p_bench->perf_fd >= 0) ? "true" : "false");
+    fprintf(p_bench->p_out, "  \"benchmarks\": [");
+
+    return true;
+}
+
+void bench_shutdown(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    if (p_bench->p_out == NULL)
+    {
+        return;
+    }
+
+    fprintf(p_bench->p_out, "\n  ]\n}\n");
+
+    if (p_bench->b_close_out)
+    {
+        fclose(p_bench->p_out);
+    }
+
+    close_cache_miss_counter(p_bench->perf_fd);
+
+    memset(p_bench, 0, sizeof(bench_t));
+}
+
+bool bench_run(bench_t* p_bench, const char* name, const char* params_json,
+               bench_func pf_setup_or_null, bench_func pf_run, void* p_context, const size_t num_ops,
+               bench_result_t* p_out_result_or_null)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+    ASSERT(name != NULL, "name == NULL");
+    ASSERT(params_json != NULL, "params_json == NULL");
+    ASSERT(pf_run != NULL, "pf_run == NULL");
+    ASSERT(num_ops > 0, "num_ops == 0");
+
+    if (p_bench->filter_or_null != NULL && strstr(name, p_bench->filter_or_null) == NULL)
+    {
+        return false;
+    }
+
+    // 내부 반복 횟수 결정
+    size_t num_iterations = 1;
+    if (pf_setup_or_null == NULL)
+    {
+        while (num_iterations < ((size_t)1 << 30))
+        {
+            const uint64_t start = bench_get_counter();
+            for (size_t i = 0; i < num_iterations; ++i)
+            {
+                pf_run(p_context);
+            }
+            const double elapsed_ns = bench_counter_to_ns(bench_get_counter() - start);
+            if (elapsed_ns >= BENCH_MIN_REPETITION_NS)
+            {
+                break;
+            }
+
+            num_iterations *= 2;
+        }
+    }
+
+    // 워밍업
+    for (size_t i = 0; i < p_bench->num_warmups; ++i)
+    {
+        if (pf_setup_or_null != NULL)
+        {
+            pf_setup_or_null(p_context);
+        }
+
+        for (size_t j = 0; j < num_iterations; ++j)
+        {
+            pf_run(p_context);
+        }
+    }
+
+    // 측정
+    // 캐시 미스는 pf_setup을 제외하고 모든 반복에 걸쳐 누적
+    double elapsed_times[BENCH_NUM_MAX_REPETITIONS];
+    uint64_t num_cache_misses = 0;
+    for (size_t i = 0; i < p_bench->num_repetitions; ++i)
+    {
+        if (pf_setup_or_null != NULL)
+        {
+            pf_setup_or_null(p_context);
+        }
+
+        start_cache_miss_counter(p_bench->perf_fd);
+        const uint64_t start = bench_get_counter();
+        for (size_t j = 0; j < num_iterations; ++j)
+        {
+            pf_run(p_context);
+        }
+        elapsed_times[i] = bench_counter_to_ns(bench_get_counter() - start);
+        num_cache_misses += stop_cache_miss_counter(p_bench->perf_fd);
+    }
+
+    // 통계
+    bench_result_t result;
+    const size_t num_repetitions = p_bench->num_repetitions;
+    qsort(elapsed_times, num_repetitions, sizeof(double), compare_double);
+
+    result.num_iterations = num_iterations;
+    result.min_ns = elapsed_times[0];
+    result.max_ns = elapsed_times[num_repetitions - 1];
+    result.median_ns = get_median(elapsed_times, num_repetitions);
+
+    double deviations[BENCH_NUM_MAX_REPETITIONS];
+    for (size_t i = 0; i < num_repetitions; ++i)
+    {
+        const double deviation = elapsed_times[i] - result.median_ns;
+        deviations[i] = (deviation >= 0.0) ? deviation : -deviation;
+    }
+    qsort(deviations, num_repetitions, sizeof(double), compare_double);
+    result.mad_ns = get_median(deviations, num_repetitions);
+
+    result.ns_per_op = result.median_ns / ((double)num_iterations * (double)num_ops);
+    result.cache_misses_per_op = (p_bench->perf_fd >= 0)
+        ? (double)num_cache_misses / ((double)num_repetitions * (double)num_iterations * (double)num_ops)
+        : -1.0;
+    result.peak_rss_bytes = bench_get_peak_rss_bytes();
+
+    fprintf(p_bench->p_out, "%s\n    {\"name\": \"%s\", \"params\": {%s}, \"ops\": %zu, \"iterations\": %zu, "
+            "\"median_ns\": %.1f, \"mad_ns\": %.1f, \"min_ns\": %.1f, \"max_ns\": %.1f, \"ns_per_op\": %.3f",
+            (p_bench->num_results == 0) ? "" : ",",
+            name, params_json, num_ops, num_iterations,
+            result.median_ns, result.mad_ns, result.min_ns, result.max_ns, result.ns_per_op);
+    if (result.cache_misses_per_op >= 0.0)
+    {
+        fprintf(p_bench->p_out, ", \"cache_misses_per_op\": %.4f", result.cache_misses_per_op);
+    }
+    fprintf(p_bench->p_out, ", \"peak_rss_bytes\": %zu}", result.peak_rss_bytes);
+    fflush(p_bench->p_out);
+
+    fprintf(stderr, "%-32s {%s} %.3f ns/op (mad %.1f%%)\n", name, params_json, result.ns_per_op,
+            (result.median_ns > 0.0) ? result.mad_ns / result.median_ns * 100.0 : 0.0);
+
+    ++p_bench->num_results;
+
+    if (p_out_result_or_null != NULL)
+    {
+        *p_out_result_or_null = result;
+    }
+
+    return true;
+}
+
+bool bench_report(bench_t* p_bench, const char* name, const char* params_json, const char* metrics_json)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+    ASSERT(name != NULL, "name == NULL");
+    ASSERT(params_json != NULL, "params_json == NULL");
+    ASSERT(metrics_json != NULL, "metrics_json == NULL");
+
+    if (p_bench->filter_or_null != NULL && strstr(name, p_bench->filter_or_null) == NULL)
+    {
+        return false;
+    }
+
+    fprintf(p_bench->p_out, "%s\n    {\"name\": \"%s\", \"params\": {%s}, \"metrics\": {%s}}",
+            (p_bench->num_results == 0) ? "" : ",", name, params_json, metrics_json);
+    fflush(p_bench->p_out);
+
+    fprintf(stderr, "%-32s {%s} %s\n", name, params_json, metrics_json);
+
+    ++p_bench->num_results;
+
+    return true;
+}
+
+uint64_t bench_get_counter(void)
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (uint64_t)counter.QuadPart;
+#else
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (uint64_t)time.tv_sec * 1000000000ull + (uint64_t)time.tv_nsec;
+#endif // _WIN32
+}
+
+double bench_counter_to_ns(const uint64_t counter)
+{
+#if defined(_WIN32)
+    static double s_ns_per_count;
+    if (s_ns_per_count == 0.0)
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+        s_ns_per_count = 1000000000.0 / (double)frequency.QuadPart;
+    }
+
+    return (double)counter * s_ns_per_count;
+#else
+    return (double)counter;
+#endif // _WIN32
+}
+
+size_t bench_get_peak_rss_bytes(void)
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+
+    return (size_t)counters.PeakWorkingSetSize;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+
+    // Linux는 KB 단위
+    return (size_t)usage.ru_maxrss * 1024;
+#endif // _WIN32
+}
+
+void bench_do_not_optimize(const void* p)
+{
+    s_p_sink = p;
+}
+
+static int compare_double(const void* p_a, const void* p_b)
+{
+    const double a = *(const double*)p_a;
+    const double b = *(const double*)p_b;
+    return (a > b) - (a < b);
+}
+
+static double get_median(double* p_sorted_values, const size_t num_values)
+{
+    if (num_values % 2 == 1)
+    {
+        return p_sorted_values[num_values / 2];
+    }
+
+    return (p_sorted_values[num_values / 2 - 1] + p_sorted_values[num_values / 2]) * 0.5;
+}
+
+static int open_cache_miss_counter(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CACHE_MISSES;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    // 가상 머신이나 perf_event_paranoid 설정에 따라 실패할 수 있음
+    const long fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    return (fd >= 0) ? (int)fd : -1;
+#else
+    return -1;
+#endif // __linux__
+}
+
+static void close_cache_miss_counter(const int fd)
+{
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+#endif // __linux__
+}
+
+static void start_cache_miss_counter(const int fd)
+{
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif // __linux__
+}
+
+static uint64_t stop_cache_miss_counter(const int fd)
+{
+#if defined(__linux__)
+    if (fd >= 0)
+    {
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+        uint64_t count;
+        if (read(fd, &count, sizeof(count)) == (ssize_t)sizeof(count))
+        {
+            return count;
+        }
+    }
+#endif // __linux__
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+﻿//***************************************************************************
+// 
+// 파일: bench.h
+// 
+// 설명: 마이크로 벤치마크 하네스
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 워밍업 후 여러 번 반복 측정하고 중앙값/MAD를 JSON으로 출력
+// 
+//***************************************************************************
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+
+#include "safe99_common/defines.h"
+
+#define BENCH_SEED 20231114u
+
+#define BENCH_DEFAULT_NUM_WARMUPS 3
+#define BENCH_DEFAULT_NUM_REPETITIONS 15
+#define BENCH_NUM_MAX_REPETITIONS 101
+
+// pf_setup이 없는 벤치마크는 한 번의 반복이 최소 이 시간 이상 걸리도록 내부 반복 횟수를 늘림
+#define BENCH_MIN_REPETITION_NS 1000000.0
+
+typedef void (*bench_func)(void* p_context);
+
+typedef struct bench
+{
+    FILE* p_out;
+    bool b_close_out;
+
+    size_t num_warmups;
+    size_t num_repetitions;
+    const char* filter_or_null;
+
+    size_t num_results;
+
+    // 기준을 넘지 못한 검사 수 (0이 아니면 main이 실패 코드를 반환)
+    size_t num_failures;
+
+    // 하드웨어 캐시 미스 카운터 (Linux perf_event), 사용할 수 없으면 -1
+    int perf_fd;
+} bench_t;
+
+typedef struct bench_result
+{
+    size_t num_iterations;  // 반복 한 번당 pf_run 호출 횟수
+    double median_ns;       // 반복 한 번 기준
+    double mad_ns;
+    double min_ns;
+    double max_ns;
+    double ns_per_op;
+
+    // 카운터를 사용할 수 없으면 음수
+    double cache_misses_per_op;
+
+    // 측정 직후 프로세스 최대 상주 메모리
+    size_t peak_rss_bytes;
+} bench_result_t;
+
+START_EXTERN_C
+
+bool bench_init(bench_t* p_bench, const char* filename_or_null, const size_t num_warmups, const size_t num_repetitions, const char* filter_or_null);
+void bench_shutdown(bench_t* p_bench);
+
+// params_json은 JSON 객체 본문 (예: "\"rows\":9,\"cols\":9")
+// pf_setup은 반복마다 측정 밖에서 호출됨 (상태를 되돌려야 하는 벤치마크용)
+// num_ops는 pf_run 한 번이 처리하는 연산 수
+bool bench_run(bench_t* p_bench, const char* name, const char* params_json,
+               bench_func pf_setup_or_null, bench_func pf_run, void* p_context, const size_t num_ops,
+               bench_result_t* p_out_result_or_null);
+
+// 시간 측정이 아닌 결과 (예: 해시 분포 품질)를 같은 JSON에 기록
+// metrics_json은 JSON 객체 본문
+bool bench_report(bench_t* p_bench, const char* name, const char* params_json, const char* metrics_json);
+
+uint64_t bench_get_counter(void);
+double bench_counter_to_ns(const uint64_t counter);
+
+// 프로세스 시작부터 지금까지의 최대 상주 메모리 (알 수 없으면 0)
+size_t bench_get_peak_rss_bytes(void);
+
+// 최적화로 결과가 사라지지 않게 함
+void bench_do_not_optimize(const void* p);
+
+END_EXTERN_C
+
+#endif // BENCH_H
\ No newline at end of file
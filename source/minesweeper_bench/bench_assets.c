@@ -0,0 +1,281 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_assets.c
+// 
+// 설명: 시작 시 텍스쳐 로드 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// init_game()이 로드하는 스프라이트 3개를 로더별로 측정
+// - read_copy: fread로 전체를 읽어 새 버퍼에 복사 (기존 방식과 같은 비용)
+// - file_system_dll: safe99_file_system DLL의 load_a8r8g8b8_dds (Windows만)
+// - mapped: load_mapped_dds_texture
+// - async: asset_loader 워커 생성 + 3개 동시 로드 + 대기 (init_game 시작 시점과 같은 비용)
+// - embedded: 실행 파일에 포함된 스프라이트 (기본 테마, 파일 I/O 없음)
+// 매핑은 페이지 폴트 때 비용이 생기므로 로드 후 모든 픽셀을 한 번씩 읽음
+// 반복 측정이므로 파일은 OS 페이지 캐시에 올라온 상태
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "game.h"
+#include "asset_loader.h"
+#include "dds_texture.h"
+#include "embedded_sprites.h"
+#include "static_texture.h"
+#include "bench_cases.h"
+
+#define NUM_SPRITES 3
+
+// DDS 매직 + 헤더
+#define DDS_FILE_HEADER_SIZE 128
+
+typedef struct asset_context
+{
+    i_file_system_t* p_file_system;
+} asset_context_t;
+
+static uint32_t touch_bitmap(const uint32_t* p_bitmap, const size_t num_pixels);
+
+static void run_read_copy(void* p_context);
+#if defined(_WIN32)
+static void run_file_system_dll(void* p_context);
+#endif // _WIN32
+static void run_mapped(void* p_context);
+static void run_async(void* p_context);
+static void run_embedded(void* p_context);
+
+static const char* const s_sprite_filenames[NUM_SPRITES] =
+{
+    SPRITE_DEFAULT_DIRECTORY "/" SPRITE_TILES_FILENAME,
+    SPRITE_DEFAULT_DIRECTORY "/" SPRITE_NUMBERS_FILENAME,
+    SPRITE_DEFAULT_DIRECTORY "/" SPRITE_FACES_FILENAME
+};
+
+static const embedded_sprite_t* const s_embedded_sprites[NUM_SPRITES] =
+{
+    &g_embedded_tiles_sprite,
+    &g_embedded_numbers_sprite,
+    &g_embedded_faces_sprite
+};
+
+void run_asset_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    asset_context_t context;
+    memset(&context, 0, sizeof(asset_context_t));
+
+    char params[64];
+    snprintf(params, sizeof(params), "\"loader\": \"embedded\"");
+    bench_run(p_bench, "texture_load", params, NULL, run_embedded, &context, NUM_SPRITES, NULL);
+
+    // 여기부터는 파일 로더, 스프라이트가 없는 위치에서 실행하면 건너뜀
+    bool b_zero_copy[NUM_SPRITES];
+    for (size_t i = 0; i < NUM_SPRITES; ++i)
+    {
+        i_texture_t* p_texture;
+        if (!load_mapped_dds_texture(s_sprite_filenames[i], &p_texture))
+        {
+            fprintf(stderr, "Failed to load %s, skipping texture_load\n", s_sprite_filenames[i]);
+            return;
+        }
+
+        b_zero_copy[i] = is_zero_copy_dds_texture(p_texture);
+        SAFE_RELEASE(p_texture);
+    }
+
+    snprintf(params, sizeof(params), "\"loader\": \"read_copy\"");
+    bench_run(p_bench, "texture_load", params, NULL, run_read_copy, &context, NUM_SPRITES, NULL);
+
+#if defined(_WIN32)
+    {
+    #if defined(_WIN64)
+        HINSTANCE h_file_system_dll = LoadLibrary(L"safe99_file_system_x64.dll");
+    #else
+        HINSTANCE h_file_system_dll = LoadLibrary(L"safe99_file_system_x86.dll");
+    #endif // _WIN64
+
+        if (h_file_system_dll != NULL)
+        {
+            create_instance_func pf_create_file_system = (create_instance_func)GetProcAddress(h_file_system_dll, "create_instance");
+            pf_create_file_system(&context.p_file_system);
+            if (context.p_file_system->vtbl->initialize(context.p_file_system))
+            {
+                snprintf(params, sizeof(params), "\"loader\": \"file_system_dll\"");
+                bench_run(p_bench, "texture_load", params, NULL, run_file_system_dll, &context, NUM_SPRITES, NULL);
+            }
+
+            SAFE_RELEASE(context.p_file_system);
+            FreeLibrary(h_file_system_dll);
+        }
+    }
+#endif // _WIN32
+
+    snprintf(params, sizeof(params), "\"loader\": \"mapped\"");
+    bench_run(p_bench, "texture_load", params, NULL, run_mapped, &context, NUM_SPRITES, NULL);
+
+    snprintf(params, sizeof(params), "\"loader\": \"async\"");
+    bench_run(p_bench, "texture_load", params, NULL, run_async, &context, NUM_SPRITES, NULL);
+
+    char metrics[128];
+    snprintf(metrics, sizeof(metrics), "\"tiles\": %s, \"numbers\": %s, \"faces\": %s",
+             b_zero_copy[0] ? "true" : "false",
+             b_zero_copy[1] ? "true" : "false",
+             b_zero_copy[2] ? "true" : "false");
+    bench_report(p_bench, "texture_load_zero_copy", "\"loader\": \"mapped\"", metrics);
+}
+
+static uint32_t touch_bitmap(const uint32_t* p_bitmap, const size_t num_pixels)
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < num_pixels; ++i)
+    {
+        sum += p_bitmap[i];
+    }
+
+    return sum;
+}
+
+static void run_read_copy(void* p_context)
+{
+    (void)p_context;
+
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < NUM_SPRITES; ++i)
+    {
+        FILE* p_file = fopen(s_sprite_filenames[i], "rb");
+        if (p_file == NULL)
+        {
+            continue;
+        }
+
+        fseek(p_file, 0, SEEK_END);
+        const long file_size = ftell(p_file);
+        fseek(p_file, 0, SEEK_SET);
+
+        char* pa_data = (char*)malloc((size_t)file_size);
+        if (pa_data != NULL && fread(pa_data, 1, (size_t)file_size, p_file) == (size_t)file_size)
+        {
+            // 헤더를 제외한 픽셀을 비트맵으로 복사
+            const size_t bitmap_size = (size_t)file_size - DDS_FILE_HEADER_SIZE;
+            uint32_t* pa_bitmap = (uint32_t*)malloc(bitmap_size);
+            if (pa_bitmap != NULL)
+            {
+                memcpy(pa_bitmap, pa_data + DDS_FILE_HEADER_SIZE, bitmap_size);
+                sum += touch_bitmap(pa_bitmap, bitmap_size / sizeof(uint32_t));
+                free(pa_bitmap);
+            }
+        }
+
+        SAFE_FREE(pa_data);
+        fclose(p_file);
+    }
+
+    bench_do_not_optimize(&sum);
+}
+
+#if defined(_WIN32)
+static void run_file_system_dll(void* p_context)
+{
+    asset_context_t* p_asset_context = (asset_context_t*)p_context;
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < NUM_SPRITES; ++i)
+    {
+        i_texture_t* p_texture;
+        if (!p_asset_context->p_file_system->vtbl->load_a8r8g8b8_dds(p_asset_context->p_file_system,
+                                                                     s_sprite_filenames[i],
+                                                                     &p_texture))
+        {
+            continue;
+        }
+
+        sum += touch_bitmap((const uint32_t*)p_texture->vtbl->get_bitmap(p_texture),
+                            p_texture->vtbl->get_width(p_texture) * p_texture->vtbl->get_height(p_texture));
+        SAFE_RELEASE(p_texture);
+    }
+
+    bench_do_not_optimize(&sum);
+}
+#endif // _WIN32
+
+static void run_mapped(void* p_context)
+{
+    (void)p_context;
+
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < NUM_SPRITES; ++i)
+    {
+        i_texture_t* p_texture;
+        if (!load_mapped_dds_texture(s_sprite_filenames[i], &p_texture))
+        {
+            continue;
+        }
+
+        sum += touch_bitmap((const uint32_t*)p_texture->vtbl->get_bitmap(p_texture),
+                            p_texture->vtbl->get_width(p_texture) * p_texture->vtbl->get_height(p_texture));
+        SAFE_RELEASE(p_texture);
+    }
+
+    bench_do_not_optimize(&sum);
+}
+
+static void run_async(void* p_context)
+{
+    (void)p_context;
+
+    uint32_t sum = 0;
+
+    asset_loader_t loader;
+    if (!asset_loader_init(&loader, 0))
+    {
+        return;
+    }
+
+    asset_handle_t handles[NUM_SPRITES];
+    for (size_t i = 0; i < NUM_SPRITES; ++i)
+    {
+        handles[i] = asset_loader_load_texture_async(&loader, s_sprite_filenames[i]);
+    }
+
+    for (size_t i = 0; i < NUM_SPRITES; ++i)
+    {
+        i_texture_t* p_texture;
+        if (!asset_loader_wait_texture(&loader, handles[i], &p_texture))
+        {
+            continue;
+        }
+
+        sum += touch_bitmap((const uint32_t*)p_texture->vtbl->get_bitmap(p_texture),
+                            p_texture->vtbl->get_width(p_texture) * p_texture->vtbl->get_height(p_texture));
+        SAFE_RELEASE(p_texture);
+    }
+
+    asset_loader_shutdown(&loader);
+
+    bench_do_not_optimize(&sum);
+}
+
+static void run_embedded(void* p_context)
+{
+    (void)p_context;
+
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < NUM_SPRITES; ++i)
+    {
+        static_texture_t texture;
+        init_static_texture(&texture, s_embedded_sprites[i]->width, s_embedded_sprites[i]->height, s_embedded_sprites[i]->p_pixels);
+
+        i_texture_t* p_texture = &texture.base;
+        sum += touch_bitmap((const uint32_t*)p_texture->vtbl->get_bitmap(p_texture),
+                            p_texture->vtbl->get_width(p_texture) * p_texture->vtbl->get_height(p_texture));
+    }
+
+    bench_do_not_optimize(&sum);
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_cases.h
+// 
+// 설명: 벤치마크 항목
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#ifndef BENCH_CASES_H
+#define BENCH_CASES_H
+
+#include "bench.h"
+
+START_EXTERN_C
+
+// make_mine, open_tile, count_adjacent_mines, draw_game
+// draw_game은 프레임 해시를 보고하고 frame_dir_or_null이 있으면 PNG로 저장 (골든 이미지)
+// frame_capture는 draw_game을 프레임 간격 없이 연달아 캡처하며 프레임당 캡처 비용과 버린 프레임 비율을 보고
+// (frame_dir_or_null이 있으면 캡처 파일도 저장, 크기 상한을 넘는 RAW 캡처는 저장하지 않음)
+// save_game, load_game은 4096 x 4096 보드까지 저장/불러오기 시간과 파일 크기를 보고
+void run_game_benchmarks(bench_t* p_bench, const char* frame_dir_or_null);
+
+// 스프라이트 로드: fread 복사, 파일 시스템 DLL, 메모리 맵
+void run_asset_benchmarks(bench_t* p_bench);
+
+END_EXTERN_C
+
+#endif // BENCH_CASES_H
\ No newline at end of file
@@ -0,0 +1,916 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_game.c
+// 
+// 설명: 게임 핵심 경로 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 보드 크기 x 지뢰 밀도 조합마다 BENCH_SEED로 같은 보드를 만들어 측정
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "game.h"
+#include "board.h"
+#include "embedded_sprites.h"
+#include "static_texture.h"
+#include "bench_cases.h"
+#include "bench_renderer.h"
+#include "capture_renderer.h"
+#include "game_save.h"
+
+// draw_game은 프레임 버퍼 크기 때문에 이 크기까지만 측정
+#define NUM_MAX_DRAW_ROWS 256
+#define NUM_MAX_DRAW_COLS 256
+
+// 캡처는 bench_run 반복 대신 고정 프레임 수로 측정 (링과 쓰기 스레드가 같은 조건이 되도록)
+#define NUM_CAPTURE_FRAMES 240
+
+// --frames가 있어도 이보다 커질 RAW 캡처는 파일로 남기지 않음
+// RAW는 프레임마다 화면 전체를 씀 (9 x 9는 240프레임에 약 25MB, 256 x 256은 약 15GB)
+// DELTA는 첫 프레임 뒤로 바뀐 블록만 쓰므로 항상 남김
+#define NUM_MAX_CAPTURE_FILE_BYTES (32 * 1024 * 1024)
+
+// --frames가 없을 때 캡처 파일을 버리는 곳
+#if defined(_WIN32)
+#define NULL_DEVICE_FILENAME "NUL"
+#else
+#define NULL_DEVICE_FILENAME "/dev/null"
+#endif // _WIN32
+
+typedef struct board_size
+{
+    int rows;
+    int cols;
+} board_size_t;
+
+typedef struct minimap_context
+{
+    minimap_t minimap;
+    int* pa_tiles;
+    size_t num_tiles;
+
+    // update_tile에서 바꿀 타일 (블록의 최댓값인 타일을 내렸다 올림)
+    int update_x;
+    int update_y;
+} minimap_context_t;
+
+typedef struct game_context
+{
+    int num_mines;
+
+    // open_tile 최선 조건에서 열 타일 (주변 지뢰가 있는 타일)
+    int number_x;
+    int number_y;
+
+    int num_adjacent_mines;
+} game_context_t;
+
+typedef struct text_context
+{
+    bitmap_font_t font;
+    text_cache_t text_cache;
+
+    // 캐시 미스: 캐시 크기보다 많은 문자열을 돌아가며 그림
+    char texts[TEXT_CACHE_NUM_MAX_ENTRIES * 2][32];
+    size_t lengths[TEXT_CACHE_NUM_MAX_ENTRIES * 2];
+    size_t text_index;
+
+    uint32_t* pa_pixels;
+} text_context_t;
+
+static bool init_board(const int rows, const int cols, const int num_mines);
+static void shutdown_board(void);
+static void reset_tiles(void);
+
+static void run_make_mine(void* p_context);
+static void run_open_tile_best(void* p_context);
+static void setup_open_tile_worst(void* p_context);
+static void run_open_tile_worst(void* p_context);
+static void run_count_adjacent_mines(void* p_context);
+static void run_draw_game(void* p_context);
+static void setup_draw_game_palette_dirty(void* p_context);
+static void open_draw_frame_tiles(void);
+static uint64_t report_draw_frame(bench_t* p_bench, const char* name, const char* params, const float density);
+static void report_capture(bench_t* p_bench, const char* params, const float density, const frame_capture_mode_t mode);
+
+static void run_save_benchmarks(bench_t* p_bench);
+static void run_save_game(void* p_context);
+static void run_load_game(void* p_context);
+
+static void run_minimap_benchmarks(bench_t* p_bench);
+static void run_minimap_rebuild(void* p_context);
+static void run_minimap_rebuild_scalar(void* p_context);
+static void run_minimap_clear(void* p_context);
+static void run_minimap_update_tile(void* p_context);
+static void setup_minimap_flood_fill(void* p_context);
+static void run_minimap_flood_fill(void* p_context);
+static void set_minimap_tile(minimap_context_t* p_minimap_context, const int tile);
+
+static void run_text_benchmarks(bench_t* p_bench);
+static void run_text_render(void* p_context);
+static void run_text_cache_hit(void* p_context);
+static void run_text_cache_miss(void* p_context);
+
+static const board_size_t s_board_sizes[] =
+{
+    { 9, 9 },
+    { 16, 16 },
+    { 16, 30 },
+    { 64, 64 },
+    { 256, 256 },
+    { 1024, 1024 }
+};
+
+static const float s_densities[] = { 0.10f, 0.15f, 0.20f };
+
+// 지연 시간 오버레이 한 줄
+static const char s_overlay_text[] = "input->present p50 1.23ms p99 4.56ms max 7.89ms (n=512)";
+
+// 저장 파일은 보드 크기에 비례하므로 4096 x 4096까지
+static const int s_save_board_sizes[] = { 256, 1024, 4096 };
+
+// 미니맵은 화면보다 큰 보드용이므로 4096 x 4096까지
+static const int s_minimap_board_sizes[] = { 256, 1024, 4096 };
+
+// NULL이 아니면 draw_game 프레임을 이 디렉터리에 PNG로 저장
+static const char* s_frame_dir_or_null;
+
+// 기본 테마 스프라이트, ARGB 경로와 팔레트 보드가 같은 아틀라스를 써야 두 프레임을 비교할 수 있음
+static static_texture_t s_embedded_tiles_texture;
+static static_texture_t s_embedded_numbers_texture;
+static static_texture_t s_embedded_faces_texture;
+
+void run_game_benchmarks(bench_t* p_bench, const char* frame_dir_or_null)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    s_frame_dir_or_null = frame_dir_or_null;
+
+    static game_t s_game;
+    gp_game = &s_game;
+
+    latency_init();
+
+    // 팔레트 보드는 16색 이하 타일이 필요하므로 기본 테마 스프라이트를 사용
+    init_static_texture(&s_embedded_tiles_texture, g_embedded_tiles_sprite.width, g_embedded_tiles_sprite.height, g_embedded_tiles_sprite.p_pixels);
+    init_static_texture(&s_embedded_numbers_texture, g_embedded_numbers_sprite.width, g_embedded_numbers_sprite.height, g_embedded_numbers_sprite.p_pixels);
+    init_static_texture(&s_embedded_faces_texture, g_embedded_faces_sprite.width, g_embedded_faces_sprite.height, g_embedded_faces_sprite.p_pixels);
+
+    for (size_t i = 0; i < sizeof(s_board_sizes) / sizeof(s_board_sizes[0]); ++i)
+    {
+        const int rows = s_board_sizes[i].rows;
+        const int cols = s_board_sizes[i].cols;
+
+        for (size_t j = 0; j < sizeof(s_densities) / sizeof(s_densities[0]); ++j)
+        {
+            const int num_mines = MAX(1, (int)(rows * cols * s_densities[j]));
+
+            char params[128];
+            snprintf(params, sizeof(params), "\"rows\": %d, \"cols\": %d, \"density\": %.2f, \"mines\": %d",
+                     rows, cols, s_densities[j], num_mines);
+
+            if (!init_board(rows, cols, num_mines))
+            {
+                ASSERT(false, "Failed to init board");
+                continue;
+            }
+
+            game_context_t context;
+            context.num_mines = num_mines;
+            context.number_x = -1;
+            context.number_y = -1;
+            context.num_adjacent_mines = 0;
+
+            for (int y = 0; y < rows && context.number_x < 0; ++y)
+            {
+                for (int x = 0; x < cols; ++x)
+                {
+                    if (!gp_game->pa_mines[y * cols + x] && count_adjacent_mines(x, y) > 0)
+                    {
+                        context.number_x = x;
+                        context.number_y = y;
+                        break;
+                    }
+                }
+            }
+
+            bench_run(p_bench, "make_mine", params, NULL, run_make_mine, &context, 1, NULL);
+
+            // run_make_mine이 보드를 바꿨으므로 같은 시드로 다시 생성
+            init_board(rows, cols, num_mines);
+
+            if (context.number_x >= 0)
+            {
+                bench_run(p_bench, "open_tile_best", params, NULL, run_open_tile_best, &context, 1, NULL);
+            }
+
+            bench_run(p_bench, "count_adjacent_mines", params, NULL, run_count_adjacent_mines, &context, (size_t)rows * cols, NULL);
+
+            if (rows <= NUM_MAX_DRAW_ROWS && cols <= NUM_MAX_DRAW_COLS)
+            {
+                reset_tiles();
+                bench_run(p_bench, "draw_game", params, NULL, run_draw_game, &context, (size_t)rows * cols, NULL);
+
+                // 팔레트 보드: 바뀐 타일이 없는 프레임 / 모든 타일이 바뀐 프레임
+                if (gp_game->b_palette_board_available)
+                {
+                    gp_game->b_palette_board = true;
+                    bench_run(p_bench, "draw_game_palette", params, NULL, run_draw_game, &context, (size_t)rows * cols, NULL);
+                    bench_run(p_bench, "draw_game_palette_dirty", params, setup_draw_game_palette_dirty, run_draw_game, &context, (size_t)rows * cols, NULL);
+                    gp_game->b_palette_board = false;
+                }
+
+                // 골든 이미지: 일부를 연 보드를 한 번 그려서 해시 보고 (설정하면 PNG 저장)
+                // 두 경로는 같은 아틀라스로 그리므로 프레임이 같아야 함
+                open_draw_frame_tiles();
+                const uint64_t frame_hash = report_draw_frame(p_bench, "draw_game", params, s_densities[j]);
+                if (gp_game->b_palette_board_available)
+                {
+                    gp_game->b_palette_board = true;
+                    const uint64_t palette_frame_hash = report_draw_frame(p_bench, "draw_game_palette", params, s_densities[j]);
+                    gp_game->b_palette_board = false;
+
+                    const bool b_match = (palette_frame_hash == frame_hash);
+                    char metrics[32];
+                    snprintf(metrics, sizeof(metrics), "\"match\": %s", b_match ? "true" : "false");
+                    if (bench_report(p_bench, "draw_game_palette_matches_argb", params, metrics) && !b_match)
+                    {
+                        fprintf(stderr, "draw_game_palette_frame %016llx != draw_game_frame %016llx (%s)\n",
+                                (unsigned long long)palette_frame_hash, (unsigned long long)frame_hash, params);
+                        ++p_bench->num_failures;
+                    }
+                }
+
+                report_capture(p_bench, params, s_densities[j], FRAME_CAPTURE_MODE_RAW);
+                report_capture(p_bench, params, s_densities[j], FRAME_CAPTURE_MODE_DELTA);
+            }
+
+            shutdown_board();
+        }
+
+        // 최악 조건: 구석에 지뢰 하나, 반대편 구석을 열면 보드 전체가 열림
+        {
+            char params[128];
+            snprintf(params, sizeof(params), "\"rows\": %d, \"cols\": %d, \"density\": 0.00, \"mines\": 1", rows, cols);
+
+            if (init_board(rows, cols, 0))
+            {
+                gp_game->pa_mines[rows * cols - 1] = true;
+                gp_game->num_max_mines = 1;
+
+                bench_run(p_bench, "open_tile_worst", params, setup_open_tile_worst, run_open_tile_worst, NULL, (size_t)rows * cols - 1, NULL);
+
+                shutdown_board();
+            }
+        }
+    }
+
+    run_save_benchmarks(p_bench);
+
+    gp_game = NULL;
+
+    run_minimap_benchmarks(p_bench);
+    run_text_benchmarks(p_bench);
+}
+
+static bool init_board(const int rows, const int cols, const int num_mines)
+{
+    shutdown_board();
+
+    gp_game->b_running = true;
+    gp_game->rows = rows;
+    gp_game->cols = cols;
+    gp_game->num_mines = num_mines;
+    gp_game->num_max_mines = num_mines;
+    gp_game->num_tiles = rows * cols;
+    gp_game->scale = 1;
+
+    gp_game->pa_mines = (bool*)malloc(sizeof(bool) * rows * cols);
+    gp_game->pa_tiles = (tile_t*)malloc(sizeof(tile_t) * rows * cols);
+    if (gp_game->pa_mines == NULL || gp_game->pa_tiles == NULL)
+    {
+        ASSERT(false, "Failed to malloc board");
+        goto failed_init;
+    }
+    memset(gp_game->pa_mines, false, sizeof(bool) * rows * cols);
+
+    if (!minimap_init(&gp_game->minimap, rows, cols))
+    {
+        ASSERT(false, "Failed to init minimap");
+        goto failed_init;
+    }
+
+    seed_board_random(BENCH_SEED);
+    make_mine(gp_game->pa_mines, rows, cols, num_mines);
+
+    reset_tiles();
+
+    if (rows <= NUM_MAX_DRAW_ROWS && cols <= NUM_MAX_DRAW_COLS)
+    {
+        const size_t width = (size_t)cols * SPRITE_TILE_WIDTH;
+        const size_t height = (size_t)rows * SPRITE_TILE_HEIGHT + INFO_HEIGHT;
+        if (!create_headless_renderer(width, height, &gp_game->p_renderer))
+        {
+            ASSERT(false, "Failed to create bench renderer");
+            goto failed_init;
+        }
+
+        // 정적 텍스쳐는 release해도 아무 일도 하지 않으므로 shutdown_board()에서 그대로 SAFE_RELEASE
+        gp_game->p_tiles_texture = &s_embedded_tiles_texture.base;
+        gp_game->p_numbers_texture = &s_embedded_numbers_texture.base;
+        gp_game->p_faces_texture = &s_embedded_faces_texture.base;
+
+        if (!sprite_atlas_build(&gp_game->sprite_atlas, gp_game->p_tiles_texture, gp_game->p_numbers_texture, gp_game->p_faces_texture))
+        {
+            ASSERT(false, "Failed to build sprite atlas");
+            goto failed_init;
+        }
+
+        gp_game->b_palette_board_available = palette_board_init(&gp_game->palette_board, &gp_game->sprite_atlas, rows, cols, BACKGROUND_ARGB);
+
+        gp_game->face_x = (int)width / 2 - SPRITE_FACE_WIDTH / 2;
+        gp_game->face_y = INFO_HEIGHT / 2 - SPRITE_FACE_HEIGHT / 2;
+    }
+
+    return true;
+
+failed_init:
+    shutdown_board();
+    return false;
+}
+
+static void shutdown_board(void)
+{
+    minimap_release(&gp_game->minimap);
+    SAFE_FREE(gp_game->pa_tiles);
+    SAFE_FREE(gp_game->pa_mines);
+
+    palette_board_release(&gp_game->palette_board);
+    gp_game->b_palette_board_available = false;
+
+    sprite_atlas_release(&gp_game->sprite_atlas);
+    SAFE_RELEASE(gp_game->p_tiles_texture);
+    SAFE_RELEASE(gp_game->p_numbers_texture);
+    SAFE_RELEASE(gp_game->p_faces_texture);
+    SAFE_RELEASE(gp_game->p_renderer);
+}
+
+static void reset_tiles(void)
+{
+    memset(gp_game->pa_tiles, TILE_BLIND, sizeof(tile_t) * gp_game->rows * gp_game->cols);
+    minimap_clear(&gp_game->minimap, TILE_BLIND);
+
+    gp_game->num_tiles = gp_game->rows * gp_game->cols;
+    gp_game->num_mines = gp_game->num_max_mines;
+
+    // 게임처럼 타일을 바꾸면 board_version을 올려 팔레트 보드가 다시 쓰도록 함
+    ++gp_game->board_version;
+}
+
+static void run_make_mine(void* p_context)
+{
+    const game_context_t* p_game_context = (const game_context_t*)p_context;
+
+    memset(gp_game->pa_mines, false, sizeof(bool) * gp_game->rows * gp_game->cols);
+    make_mine(gp_game->pa_mines, gp_game->rows, gp_game->cols, p_game_context->num_mines);
+    bench_do_not_optimize(gp_game->pa_mines);
+}
+
+static void run_open_tile_best(void* p_context)
+{
+    const game_context_t* p_game_context = (const game_context_t*)p_context;
+
+    open_tile(p_game_context->number_x, p_game_context->number_y);
+
+    // 숫자 타일 하나만 열리므로 그 타일만 되돌림
+    set_board_tile(p_game_context->number_x, p_game_context->number_y, TILE_BLIND);
+    ++gp_game->num_tiles;
+}
+
+static void setup_open_tile_worst(void* p_context)
+{
+    (void)p_context;
+
+    reset_tiles();
+}
+
+static void run_open_tile_worst(void* p_context)
+{
+    (void)p_context;
+
+    open_tile(0, 0);
+    bench_do_not_optimize(gp_game->pa_tiles);
+}
+
+static void run_count_adjacent_mines(void* p_context)
+{
+    game_context_t* p_game_context = (game_context_t*)p_context;
+
+    int count = 0;
+    for (int y = 0; y < gp_game->rows; ++y)
+    {
+        for (int x = 0; x < gp_game->cols; ++x)
+        {
+            count += count_adjacent_mines(x, y);
+        }
+    }
+
+    p_game_context->num_adjacent_mines = count;
+    bench_do_not_optimize(&p_game_context->num_adjacent_mines);
+}
+
+static void run_draw_game(void* p_context)
+{
+    (void)p_context;
+
+    draw_game();
+}
+
+static void setup_draw_game_palette_dirty(void* p_context)
+{
+    (void)p_context;
+
+    palette_board_invalidate(&gp_game->palette_board);
+}
+
+// 첫 번째 빈 칸을 열고 첫 번째 지뢰에 깃발 (숫자, 열린 칸, 깃발이 모두 보이도록)
+static void open_draw_frame_tiles(void)
+{
+    bool b_opened = false;
+    bool b_flagged = false;
+
+    for (int y = 0; y < gp_game->rows && !(b_opened && b_flagged); ++y)
+    {
+        for (int x = 0; x < gp_game->cols && !(b_opened && b_flagged); ++x)
+        {
+            if (gp_game->pa_mines[y * gp_game->cols + x])
+            {
+                if (!b_flagged)
+                {
+                    set_board_tile(x, y, TILE_FLAG);
+                    b_flagged = true;
+                }
+            }
+            else if (!b_opened && count_adjacent_mines(x, y) == 0)
+            {
+                open_tile(x, y);
+                b_opened = true;
+            }
+        }
+    }
+
+    ++gp_game->board_version;
+}
+
+static uint64_t report_draw_frame(bench_t* p_bench, const char* name, const char* params, const float density)
+{
+    draw_game();
+
+    const i_soft_renderer_t* p_renderer = gp_game->p_renderer;
+    bool b_written = false;
+
+    if (s_frame_dir_or_null != NULL)
+    {
+        char filename[260];
+        snprintf(filename, sizeof(filename), "%s/%s_%dx%d_%.2f.png",
+                 s_frame_dir_or_null, name, gp_game->rows, gp_game->cols, density);
+        b_written = headless_renderer_write_png(p_renderer, filename);
+    }
+
+    char frame_name[64];
+    snprintf(frame_name, sizeof(frame_name), "%s_frame", name);
+
+    const uint64_t hash = headless_renderer_hash_frame(p_renderer);
+
+    char metrics[96];
+    snprintf(metrics, sizeof(metrics), "\"hash\": \"%016llx\", \"written\": %s",
+             (unsigned long long)hash, b_written ? "true" : "false");
+    bench_report(p_bench, frame_name, params, metrics);
+
+    return hash;
+}
+
+// 매 프레임 타일 하나를 바꾸며 draw_game을 캡처 렌더러로 그림, 쓰기를 기다리지 않으므로 밀리면 버린 프레임으로 보고
+// 프레임 간격 없이 연달아 그리므로 drop_rate는 60fps 게임의 값이 아니라 쓰기 스레드가 따라오지 못하는 상한 (pacing: back_to_back)
+static void report_capture(bench_t* p_bench, const char* params, const float density, const frame_capture_mode_t mode)
+{
+    const char* mode_name = (mode == FRAME_CAPTURE_MODE_RAW) ? "raw" : "delta";
+
+    i_soft_renderer_t* p_renderer = gp_game->p_renderer;
+    const size_t width = p_renderer->vtbl->get_width(p_renderer);
+    const size_t height = p_renderer->vtbl->get_height(p_renderer);
+
+    // RAW 파일 크기는 프레임 수로 정해짐, 상한을 넘으면 --frames가 있어도 파일 쓰기 비용만 남기고 버림
+    const uint64_t num_raw_bytes = (uint64_t)width * height * sizeof(uint32_t) * NUM_CAPTURE_FRAMES;
+    const bool b_keep_file = (s_frame_dir_or_null != NULL)
+                             && (mode != FRAME_CAPTURE_MODE_RAW || num_raw_bytes <= NUM_MAX_CAPTURE_FILE_BYTES);
+
+    char filename[260];
+    if (b_keep_file)
+    {
+        snprintf(filename, sizeof(filename), "%s/capture_%s_%dx%d_%.2f.bin",
+                 s_frame_dir_or_null, mode_name, gp_game->rows, gp_game->cols, density);
+    }
+    else
+    {
+        snprintf(filename, sizeof(filename), NULL_DEVICE_FILENAME);
+    }
+
+    frame_capture_t capture;
+    if (!frame_capture_start(&capture, filename, width, height, mode))
+    {
+        ASSERT(false, "Failed to start capture");
+        return;
+    }
+
+    i_soft_renderer_t* p_capture_renderer = NULL;
+    if (!create_capture_renderer(p_renderer, &capture, &p_capture_renderer))
+    {
+        ASSERT(false, "Failed to create capture renderer");
+        frame_capture_stop(&capture);
+        return;
+    }
+
+    gp_game->p_renderer = p_capture_renderer;
+
+    const int num_tiles = gp_game->rows * gp_game->cols;
+    for (int i = 0; i < NUM_CAPTURE_FRAMES; ++i)
+    {
+        const int index = i % num_tiles;
+        const int x = index % gp_game->cols;
+        const int y = index / gp_game->cols;
+        set_board_tile(x, y, (gp_game->pa_tiles[index] == TILE_FLAG) ? TILE_BLIND : TILE_FLAG);
+        ++gp_game->board_version;
+
+        draw_game();
+    }
+
+    gp_game->p_renderer = p_renderer;
+    SAFE_RELEASE(p_capture_renderer);
+
+    // 통계는 stop()에서 지워지므로 먼저 읽음, 남은 슬롯은 stop()이 모두 씀
+    frame_capture_stats_t stats;
+    frame_capture_get_stats(&capture, &stats);
+    frame_capture_stop(&capture);
+
+    char capture_params[192];
+    snprintf(capture_params, sizeof(capture_params), "%s, \"mode\": \"%s\", \"pacing\": \"back_to_back\"", params, mode_name);
+
+    char metrics[224];
+    snprintf(metrics, sizeof(metrics),
+             "\"frames\": %zu, \"dropped\": %zu, \"drop_rate\": %.4f, \"avg_capture_ms\": %.4f, \"max_capture_ms\": %.4f, \"written\": %s",
+             stats.num_frames, stats.num_dropped_frames,
+             (stats.num_frames > 0) ? (double)stats.num_dropped_frames / (double)stats.num_frames : 0.0,
+             stats.average_capture_ms, stats.max_capture_ms, b_keep_file ? "true" : "false");
+    bench_report(p_bench, "frame_capture", capture_params, metrics);
+}
+
+// 진행 중인 게임처럼 일부를 열고 깃발을 꽂은 보드를 저장/불러오기
+static void run_save_benchmarks(bench_t* p_bench)
+{
+    // --frames가 있으면 그 디렉터리에 남기고, 없으면 실행 디렉터리에 만든 뒤 지움
+    char filename[260];
+    if (s_frame_dir_or_null != NULL)
+    {
+        snprintf(filename, sizeof(filename), "%s/%s", s_frame_dir_or_null, GAME_SAVE_FILENAME);
+    }
+    else
+    {
+        snprintf(filename, sizeof(filename), "bench_%s", GAME_SAVE_FILENAME);
+    }
+
+    for (size_t i = 0; i < sizeof(s_save_board_sizes) / sizeof(s_save_board_sizes[0]); ++i)
+    {
+        const int size = s_save_board_sizes[i];
+        const int num_mines = (int)((float)size * size * 0.15f);
+
+        if (!init_board(size, size, num_mines))
+        {
+            ASSERT(false, "Failed to init board");
+            continue;
+        }
+
+        for (int y = 0; y < size; ++y)
+        {
+            for (int x = 0; x < size; ++x)
+            {
+                const uint64_t r = next_board_random() % 100;
+                if (r < 30 && !gp_game->pa_mines[y * size + x])
+                {
+                    const int count = count_adjacent_mines(x, y);
+                    set_board_tile(x, y, (count == 0) ? TILE_OPEN : TILE_1 + count - 1);
+                }
+                else if (r < 35)
+                {
+                    set_board_tile(x, y, TILE_FLAG);
+                }
+            }
+        }
+
+        char params[96];
+        snprintf(params, sizeof(params), "\"rows\": %d, \"cols\": %d, \"density\": 0.15", size, size);
+
+        const size_t num_tiles = (size_t)size * size;
+        bench_run(p_bench, "save_game", params, NULL, run_save_game, filename, num_tiles, NULL);
+        bench_run(p_bench, "load_game", params, NULL, run_load_game, filename, num_tiles, NULL);
+
+        // 불러온 보드가 저장한 보드와 같은지 (비교용 사본은 불러오기 전에 만듦)
+        bool* pa_mines = (bool*)malloc(sizeof(bool) * num_tiles);
+        tile_t* pa_tiles = (tile_t*)malloc(sizeof(tile_t) * num_tiles);
+        bool b_same = false;
+        if (pa_mines != NULL && pa_tiles != NULL)
+        {
+            memcpy(pa_mines, gp_game->pa_mines, sizeof(bool) * num_tiles);
+            memcpy(pa_tiles, gp_game->pa_tiles, sizeof(tile_t) * num_tiles);
+
+            b_same = save_game(filename) && load_game(filename)
+                     && memcmp(pa_mines, gp_game->pa_mines, sizeof(bool) * num_tiles) == 0
+                     && memcmp(pa_tiles, gp_game->pa_tiles, sizeof(tile_t) * num_tiles) == 0;
+        }
+        SAFE_FREE(pa_tiles);
+        SAFE_FREE(pa_mines);
+
+        long file_size = 0;
+        FILE* p_file = fopen(filename, "rb");
+        if (p_file != NULL)
+        {
+            fseek(p_file, 0, SEEK_END);
+            file_size = ftell(p_file);
+            fclose(p_file);
+        }
+
+        char metrics[128];
+        snprintf(metrics, sizeof(metrics), "\"file_bytes\": %ld, \"raw_bytes\": %zu, \"round_trip\": %s",
+                 file_size, (sizeof(bool) + sizeof(tile_t)) * num_tiles, b_same ? "true" : "false");
+        bench_report(p_bench, "save_game_size", params, metrics);
+
+        shutdown_board();
+    }
+
+    if (s_frame_dir_or_null == NULL)
+    {
+        remove(filename);
+    }
+}
+
+static void run_save_game(void* p_context)
+{
+    save_game((const char*)p_context);
+}
+
+static void run_load_game(void* p_context)
+{
+    load_game((const char*)p_context);
+}
+
+static void run_minimap_benchmarks(bench_t* p_bench)
+{
+    for (size_t i = 0; i < sizeof(s_minimap_board_sizes) / sizeof(s_minimap_board_sizes[0]); ++i)
+    {
+        const int size = s_minimap_board_sizes[i];
+
+        minimap_context_t context;
+        context.num_tiles = (size_t)size * size;
+        context.pa_tiles = (int*)malloc(sizeof(int) * context.num_tiles);
+        if (context.pa_tiles == NULL || !minimap_init(&context.minimap, size, size))
+        {
+            ASSERT(false, "Failed to init minimap context");
+            SAFE_FREE(context.pa_tiles);
+            continue;
+        }
+
+        // 진행 중인 게임처럼 대부분 가려지고 일부가 열리거나 깃발
+        srand(BENCH_SEED);
+        for (size_t j = 0; j < context.num_tiles; ++j)
+        {
+            const int r = rand() % 100;
+            context.pa_tiles[j] = (r < 60) ? TILE_BLIND : (r < 90) ? TILE_OPEN : (r < 95) ? TILE_1 + rand() % 8 : TILE_FLAG;
+        }
+
+        // 블록의 최댓값인 깃발을 내렸다 올리는 경우
+        context.update_x = size / 2;
+        context.update_y = size / 2;
+        context.pa_tiles[context.update_y * size + context.update_x] = TILE_FLAG;
+
+        char params[64];
+        snprintf(params, sizeof(params), "\"rows\": %d, \"cols\": %d, \"impl\": \"scalar\"", size, size);
+        bench_run(p_bench, "minimap_rebuild", params, NULL, run_minimap_rebuild_scalar, &context, context.num_tiles, NULL);
+        snprintf(params, sizeof(params), "\"rows\": %d, \"cols\": %d, \"impl\": \"auto\"", size, size);
+        bench_run(p_bench, "minimap_rebuild", params, NULL, run_minimap_rebuild, &context, context.num_tiles, NULL);
+
+        // 새 게임 (보드를 읽지 않음)
+        snprintf(params, sizeof(params), "\"rows\": %d, \"cols\": %d, \"impl\": \"clear\"", size, size);
+        bench_run(p_bench, "minimap_rebuild", params, NULL, run_minimap_clear, &context, context.num_tiles, NULL);
+        minimap_rebuild(&context.minimap, context.pa_tiles);
+
+        // 타일 하나 바꿀 때 (깃발 -> 가려짐 -> 깃발)
+        snprintf(params, sizeof(params), "\"rows\": %d, \"cols\": %d", size, size);
+        bench_run(p_bench, "minimap_update_tile", params, NULL, run_minimap_update_tile, &context, 2, NULL);
+
+        // 자동 경로가 스칼라와 같은 미니맵을 만드는지, 갱신 후에도 전체 재구성과 같은지
+        const size_t num_pixels = (size_t)context.minimap.width * context.minimap.height;
+        uint32_t* pa_expected = (uint32_t*)malloc(sizeof(uint32_t) * num_pixels);
+        if (pa_expected != NULL)
+        {
+            size_t num_mismatches = 0;
+
+            set_minimap_tile(&context, TILE_BLIND);
+            minimap_rebuild_scalar(&context.minimap, context.pa_tiles);
+            memcpy(pa_expected, context.minimap.pa_pixels, sizeof(uint32_t) * num_pixels);
+
+            set_minimap_tile(&context, TILE_FLAG);
+            minimap_rebuild(&context.minimap, context.pa_tiles);
+            set_minimap_tile(&context, TILE_BLIND);
+
+            for (size_t j = 0; j < num_pixels; ++j)
+            {
+                if (context.minimap.pa_pixels[j] != pa_expected[j])
+                {
+                    ++num_mismatches;
+                }
+            }
+
+            char metrics[64];
+            snprintf(metrics, sizeof(metrics), "\"mismatches\": %zu, \"width\": %d", num_mismatches, context.minimap.width);
+            bench_report(p_bench, "minimap_check", params, metrics);
+
+            SAFE_FREE(pa_expected);
+        }
+
+        // 빈 보드를 한 번에 여는 경우 (블록의 최댓값인 가려진 타일이 하나씩 열림, 보드를 덮어쓰므로 마지막에)
+        bench_run(p_bench, "minimap_flood_fill", params, setup_minimap_flood_fill, run_minimap_flood_fill, &context, context.num_tiles, NULL);
+
+        minimap_release(&context.minimap);
+        SAFE_FREE(context.pa_tiles);
+    }
+}
+
+static void run_minimap_rebuild(void* p_context)
+{
+    minimap_context_t* p_minimap_context = (minimap_context_t*)p_context;
+
+    minimap_rebuild(&p_minimap_context->minimap, p_minimap_context->pa_tiles);
+    bench_do_not_optimize(p_minimap_context->minimap.pa_pixels);
+}
+
+static void run_minimap_rebuild_scalar(void* p_context)
+{
+    minimap_context_t* p_minimap_context = (minimap_context_t*)p_context;
+
+    minimap_rebuild_scalar(&p_minimap_context->minimap, p_minimap_context->pa_tiles);
+    bench_do_not_optimize(p_minimap_context->minimap.pa_pixels);
+}
+
+static void run_minimap_clear(void* p_context)
+{
+    minimap_context_t* p_minimap_context = (minimap_context_t*)p_context;
+
+    minimap_clear(&p_minimap_context->minimap, TILE_BLIND);
+    bench_do_not_optimize(p_minimap_context->minimap.pa_pixels);
+}
+
+static void run_minimap_update_tile(void* p_context)
+{
+    minimap_context_t* p_minimap_context = (minimap_context_t*)p_context;
+
+    set_minimap_tile(p_minimap_context, TILE_BLIND);
+    set_minimap_tile(p_minimap_context, TILE_FLAG);
+    bench_do_not_optimize(p_minimap_context->minimap.pa_pixels);
+}
+
+static void setup_minimap_flood_fill(void* p_context)
+{
+    minimap_context_t* p_minimap_context = (minimap_context_t*)p_context;
+
+    for (size_t i = 0; i < p_minimap_context->num_tiles; ++i)
+    {
+        p_minimap_context->pa_tiles[i] = TILE_BLIND;
+    }
+    minimap_clear(&p_minimap_context->minimap, TILE_BLIND);
+}
+
+// open_tile()의 플러드 필처럼 타일마다 minimap_update_tile() 호출
+static void run_minimap_flood_fill(void* p_context)
+{
+    minimap_context_t* p_minimap_context = (minimap_context_t*)p_context;
+    const int cols = p_minimap_context->minimap.cols;
+
+    for (size_t i = 0; i < p_minimap_context->num_tiles; ++i)
+    {
+        p_minimap_context->pa_tiles[i] = TILE_OPEN;
+        minimap_update_tile(&p_minimap_context->minimap, p_minimap_context->pa_tiles, (int)(i % cols), (int)(i / cols), TILE_BLIND);
+    }
+    bench_do_not_optimize(p_minimap_context->minimap.pa_pixels);
+}
+
+static void set_minimap_tile(minimap_context_t* p_minimap_context, const int tile)
+{
+    const size_t index = (size_t)p_minimap_context->update_y * p_minimap_context->minimap.cols + p_minimap_context->update_x;
+    const int old_tile = p_minimap_context->pa_tiles[index];
+
+    p_minimap_context->pa_tiles[index] = tile;
+    minimap_update_tile(&p_minimap_context->minimap, p_minimap_context->pa_tiles,
+                        p_minimap_context->update_x, p_minimap_context->update_y, old_tile);
+}
+
+static void run_text_benchmarks(bench_t* p_bench)
+{
+    static text_context_t s_context;
+    text_context_t* p_context = &s_context;
+
+    for (int scale = 1; scale <= GAME_NUM_MAX_SCALE; scale *= 2)
+    {
+        memset(p_context, 0, sizeof(text_context_t));
+        if (!bitmap_font_init(&p_context->font, scale))
+        {
+            ASSERT(false, "Failed to init bitmap font");
+            continue;
+        }
+
+        const size_t num_max_pixels = (size_t)bitmap_font_get_text_width(&p_context->font, TEXT_CACHE_MAX_LENGTH) * p_context->font.glyph_height;
+        p_context->pa_pixels = (uint32_t*)malloc(sizeof(uint32_t) * num_max_pixels);
+        if (p_context->pa_pixels == NULL || !text_cache_init(&p_context->text_cache, &p_context->font))
+        {
+            ASSERT(false, "Failed to init text context");
+            SAFE_FREE(p_context->pa_pixels);
+            bitmap_font_release(&p_context->font);
+            continue;
+        }
+
+        for (size_t i = 0; i < TEXT_CACHE_NUM_MAX_ENTRIES * 2; ++i)
+        {
+            const int length = snprintf(p_context->texts[i], sizeof(p_context->texts[i]), "frame %zu p50 %.2fms", i, (double)i * 0.01);
+            p_context->lengths[i] = (size_t)MAX(length, 0);
+        }
+
+        const size_t length = sizeof(s_overlay_text) - 1;
+
+        char params[64];
+        snprintf(params, sizeof(params), "\"scale\": %d, \"length\": %zu, \"impl\": \"render\"", scale, length);
+        bench_run(p_bench, "text_overlay", params, NULL, run_text_render, p_context, length, NULL);
+        snprintf(params, sizeof(params), "\"scale\": %d, \"length\": %zu, \"impl\": \"cache_hit\"", scale, length);
+        bench_run(p_bench, "text_overlay", params, NULL, run_text_cache_hit, p_context, length, NULL);
+        snprintf(params, sizeof(params), "\"scale\": %d, \"impl\": \"cache_miss\"", scale);
+        bench_run(p_bench, "text_overlay", params, NULL, run_text_cache_miss, p_context, 1, NULL);
+
+        // 캐시한 스프라이트가 직접 그린 것과 같은지
+        size_t num_mismatches = 0;
+        for (size_t i = 0; i < TEXT_CACHE_NUM_MAX_ENTRIES * 2; ++i)
+        {
+            text_cache_begin_frame(&p_context->text_cache);
+            const atlas_sprite_t* p_sprite = text_cache_get_sprite(&p_context->text_cache, p_context->texts[i], p_context->lengths[i], 0xffff0000);
+            bitmap_font_render(&p_context->font, p_context->texts[i], p_context->lengths[i], 0xffff0000, p_context->pa_pixels);
+
+            const size_t num_pixels = (size_t)p_sprite->width * p_sprite->height;
+            if (memcmp(p_sprite->p_pixels, p_context->pa_pixels, sizeof(uint32_t) * num_pixels) != 0)
+            {
+                ++num_mismatches;
+            }
+        }
+
+        char metrics[96];
+        snprintf(metrics, sizeof(metrics), "\"mismatches\": %zu, \"hits\": %zu, \"misses\": %zu",
+                 num_mismatches, p_context->text_cache.num_hits, p_context->text_cache.num_misses);
+        snprintf(params, sizeof(params), "\"scale\": %d", scale);
+        bench_report(p_bench, "text_cache_check", params, metrics);
+
+        text_cache_release(&p_context->text_cache);
+        bitmap_font_release(&p_context->font);
+        SAFE_FREE(p_context->pa_pixels);
+    }
+}
+
+// 캐시 없이 매 프레임 글리프를 복사
+static void run_text_render(void* p_context)
+{
+    text_context_t* p_text_context = (text_context_t*)p_context;
+
+    bitmap_font_render(&p_text_context->font, s_overlay_text, sizeof(s_overlay_text) - 1, 0xffff0000, p_text_context->pa_pixels);
+    bench_do_not_optimize(p_text_context->pa_pixels);
+}
+
+static void run_text_cache_hit(void* p_context)
+{
+    text_context_t* p_text_context = (text_context_t*)p_context;
+
+    text_cache_begin_frame(&p_text_context->text_cache);
+    const atlas_sprite_t* p_sprite = text_cache_get_sprite(&p_text_context->text_cache, s_overlay_text, sizeof(s_overlay_text) - 1, 0xffff0000);
+    bench_do_not_optimize(p_sprite);
+}
+
+static void run_text_cache_miss(void* p_context)
+{
+    text_context_t* p_text_context = (text_context_t*)p_context;
+
+    const size_t index = p_text_context->text_index;
+    p_text_context->text_index = (index + 1) % (TEXT_CACHE_NUM_MAX_ENTRIES * 2);
+
+    text_cache_begin_frame(&p_text_context->text_cache);
+    const atlas_sprite_t* p_sprite = text_cache_get_sprite(&p_text_context->text_cache,
+                                                           p_text_context->texts[index], p_text_context->lengths[index], 0xffff0000);
+    bench_do_not_optimize(p_sprite);
+}
\ No newline at end of file
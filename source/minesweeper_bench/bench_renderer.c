@@ -0,0 +1,121 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_renderer.c
+// 
+// 설명: 벤치마크용 렌더러와 텍스쳐
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "bench_renderer.h"
+
+typedef struct bench_texture
+{
+    i_texture_t base;
+
+    size_t ref_count;
+
+    size_t width;
+    size_t height;
+    uint32_t* pa_bitmap;
+} bench_texture_t;
+
+static size_t __stdcall texture_add_ref(i_texture_t* p_this);
+static size_t __stdcall texture_release(i_texture_t* p_this);
+static size_t __stdcall texture_get_ref_count(const i_texture_t* p_this);
+static size_t __stdcall texture_get_width(const i_texture_t* p_this);
+static size_t __stdcall texture_get_height(const i_texture_t* p_this);
+static const char* __stdcall texture_get_bitmap(const i_texture_t* p_this);
+
+static i_texture_vtbl_t s_texture_vtbl =
+{
+    texture_add_ref,
+    texture_release,
+    texture_get_ref_count,
+    texture_get_width,
+    texture_get_height,
+    texture_get_bitmap
+};
+
+bool create_bench_texture(const size_t width, const size_t height, const uint32_t seed, i_texture_t** pp_out_texture)
+{
+    ASSERT(width > 0, "width == 0");
+    ASSERT(height > 0, "height == 0");
+    ASSERT(pp_out_texture != NULL, "pp_out_texture == NULL");
+
+    bench_texture_t* p_texture = (bench_texture_t*)malloc(sizeof(bench_texture_t));
+    if (p_texture == NULL)
+    {
+        ASSERT(false, "Failed to malloc texture");
+        return false;
+    }
+
+    p_texture->pa_bitmap = (uint32_t*)malloc(sizeof(uint32_t) * width * height);
+    if (p_texture->pa_bitmap == NULL)
+    {
+        ASSERT(false, "Failed to malloc bitmap");
+        free(p_texture);
+        return false;
+    }
+
+    // xorshift32, 알파는 항상 불투명
+    uint32_t state = (seed == 0) ? 1 : seed;
+    for (size_t i = 0; i < width * height; ++i)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        p_texture->pa_bitmap[i] = state | 0xff000000;
+    }
+
+    p_texture->base.vtbl = &s_texture_vtbl;
+    p_texture->ref_count = 1;
+    p_texture->width = width;
+    p_texture->height = height;
+
+    *pp_out_texture = &p_texture->base;
+    return true;
+}
+
+static size_t __stdcall texture_add_ref(i_texture_t* p_this)
+{
+    bench_texture_t* p_texture = (bench_texture_t*)p_this;
+    return ++p_texture->ref_count;
+}
+
+static size_t __stdcall texture_release(i_texture_t* p_this)
+{
+    bench_texture_t* p_texture = (bench_texture_t*)p_this;
+    if (--p_texture->ref_count == 0)
+    {
+        SAFE_FREE(p_texture->pa_bitmap);
+        free(p_texture);
+        return 0;
+    }
+
+    return p_texture->ref_count;
+}
+
+static size_t __stdcall texture_get_ref_count(const i_texture_t* p_this)
+{
+    return ((const bench_texture_t*)p_this)->ref_count;
+}
+
+static size_t __stdcall texture_get_width(const i_texture_t* p_this)
+{
+    return ((const bench_texture_t*)p_this)->width;
+}
+
+static size_t __stdcall texture_get_height(const i_texture_t* p_this)
+{
+    return ((const bench_texture_t*)p_this)->height;
+}
+
+static const char* __stdcall texture_get_bitmap(const i_texture_t* p_this)
+{
+    return (const char*)((const bench_texture_t*)p_this)->pa_bitmap;
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_renderer.h
+// 
+// 설명: 벤치마크용 렌더러와 텍스쳐
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 렌더러는 safe99_soft_renderer/headless_renderer.h, 여기서는 시드로 채운 텍스쳐만 만듦
+// 
+//***************************************************************************
+
+#ifndef BENCH_RENDERER_H
+#define BENCH_RENDERER_H
+
+#include "safe99_common/defines.h"
+#include "safe99_soft_renderer/headless_renderer.h"
+
+START_EXTERN_C
+
+// 픽셀은 seed로 채움
+bool create_bench_texture(const size_t width, const size_t height, const uint32_t seed, i_texture_t** pp_out_texture);
+
+END_EXTERN_C
+
+#endif // BENCH_RENDERER_H
\ No newline at end of file
@@ -0,0 +1,94 @@
+﻿//***************************************************************************
+// 
+// 파일: main.c
+// 
+// 설명: 벤치마크 main 함수
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 사용법: minesweeper_bench [--out file.json] [--warmups n] [--reps n] [--filter name] [--frames dir]
+// 
+// 창, 입력, DLL 로드 (game.c, main.c, console_util.c, debug_console.c, startup.c)를 빼면 Linux에서도 빌드됨
+//   cd source && gcc -O2 -DNDEBUG -I . -I minesweeper -I minesweeper/private
+//       minesweeper/{asset_loader,bitmap_font,board,capture_renderer,dds_texture,embedded_sprites,frame_capture,
+//                    game_draw,game_save,key_event,latency,mapped_file,minimap,palette_board,sprite_atlas,
+//                    static_texture,text_cache}.c
+//       minesweeper_bench/*.c safe99_soft_renderer/headless_renderer.c -lm -lpthread -o minesweeper_bench
+// -DNDEBUG가 없으면 프로파일러가 켜지는데 profiler.c는 safe99_generic DLL (타이머, 해시)이 필요함
+// 스프라이트는 ../../sprite에서 읽으므로 output/bin 같은 두 단계 아래 디렉터리에서 실행
+// 
+//***************************************************************************
+
+#include "precompiled.h"
+#include "bench.h"
+#include "bench_cases.h"
+
+// game.c에서 참조 (Windows만 빌드)
+#if defined(_WIN32)
+HWND g_hwnd;
+#endif // _WIN32
+
+int main(int argc, char** argv)
+{
+    const char* out_filename = NULL;
+    const char* filter = NULL;
+    const char* frame_dir = NULL;
+    size_t num_warmups = BENCH_DEFAULT_NUM_WARMUPS;
+    size_t num_repetitions = BENCH_DEFAULT_NUM_REPETITIONS;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool b_has_value = (i + 1 < argc);
+
+        if (strcmp(argv[i], "--out") == 0 && b_has_value)
+        {
+            out_filename = argv[++i];
+        }
+        else if (strcmp(argv[i], "--warmups") == 0 && b_has_value)
+        {
+            num_warmups = (size_t)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--reps") == 0 && b_has_value)
+        {
+            // MAX는 인자를 두 번 평가하므로 ++i를 밖에서
+            const int num_reps = atoi(argv[++i]);
+            num_repetitions = (size_t)MAX(1, num_reps);
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && b_has_value)
+        {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "--frames") == 0 && b_has_value)
+        {
+            frame_dir = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--out file.json] [--warmups n] [--reps n] [--filter name] [--frames dir]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bench_t bench;
+    if (!bench_init(&bench, out_filename, num_warmups, num_repetitions, filter))
+    {
+        fprintf(stderr, "Failed to open %s\n", out_filename);
+        return 1;
+    }
+
+    run_game_benchmarks(&bench, frame_dir);
+    run_asset_benchmarks(&bench);
+
+    const size_t num_failures = bench.num_failures;
+    bench_shutdown(&bench);
+
+    if (num_failures > 0)
+    {
+        fprintf(stderr, "%zu check(s) failed\n", num_failures);
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
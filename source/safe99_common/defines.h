@@ -13,7 +13,49 @@
 #ifndef DEFINES_H
 #define DEFINES_H
 
+// 컴파일러 호환
+// MSVC 전용 키워드를 GCC/Clang에서 같은 의미로 정의
+#if defined(_MSC_VER)
 #include <intrin.h>
+#else
+#include <x86intrin.h>
+
+#ifndef __stdcall
+#if defined(__i386__)
+#define __stdcall __attribute__((stdcall))
+#else
+#define __stdcall
+#endif // __i386__
+#endif // __stdcall
+
+// x64 System V 호출 규약은 __m128 인자를 이미 XMM 레지스터로 전달
+#ifndef __vectorcall
+#define __vectorcall
+#endif // __vectorcall
+
+#define __debugbreak() __builtin_trap()
+
+// MSVC 인트린직 (safe99_generic 컨테이너, 메모리 풀이 사용)
+// Interlocked 계열은 MSVC처럼 전체 메모리 배리어
+static inline unsigned char _BitScanForward(unsigned long* p_index, const unsigned long mask)
+{
+    if (mask == 0)
+    {
+        return 0;
+    }
+
+    *p_index = (unsigned long)__builtin_ctzl(mask);
+    return 1;
+}
+
+#define _InterlockedIncrement(p_addend) __atomic_add_fetch((p_addend), 1, __ATOMIC_SEQ_CST)
+#define _InterlockedDecrement(p_addend) __atomic_sub_fetch((p_addend), 1, __ATOMIC_SEQ_CST)
+#define _InterlockedExchange(p_target, value) __atomic_exchange_n((p_target), (value), __ATOMIC_SEQ_CST)
+#define _InterlockedExchangePointer(p_target, value) __atomic_exchange_n((p_target), (value), __ATOMIC_SEQ_CST)
+#define _InterlockedCompareExchange(p_destination, exchange, comparand) __sync_val_compare_and_swap((p_destination), (comparand), (exchange))
+#define _InterlockedCompareExchange64(p_destination, exchange, comparand) __sync_val_compare_and_swap((p_destination), (comparand), (exchange))
+#define _InterlockedCompareExchangePointer(p_destination, exchange, comparand) __sync_val_compare_and_swap((p_destination), (comparand), (exchange))
+#endif // _MSC_VER
 
 // 타입 정의
 #include <limits.h>
@@ -63,23 +105,52 @@ typedef void (__stdcall *create_instance_func)(void**);
 #define SUPPORT_SSE
 #endif // SSE
 
+// 실행 시간에 CPU를 확인하고 호출하는 SSSE3/AVX 함수에 붙임
+// MSVC는 /arch 없이도 AVX 인트린직을 쓸 수 있지만 GCC/Clang은 함수 단위로 허용해야 함
+#if defined(_MSC_VER)
+#define TARGET_SSSE3
+#define TARGET_AVX
+#else
+#define TARGET_SSSE3 __attribute__((target("ssse3")))
+#define TARGET_AVX __attribute__((target("avx")))
+#endif // _MSC_VER
+
 // inline
+// C의 GCC/Clang은 static이 없으면 다른 번역 단위에 외부 정의가 필요하므로 static inline
 #define INLINE inline
+#if defined(_MSC_VER)
 #define FORCEINLINE __forceinline
+#elif defined(__cplusplus)
+#define FORCEINLINE inline __attribute__((always_inline))
+#else
+#define FORCEINLINE static inline __attribute__((always_inline))
+#endif // _MSC_VER
 
 // dll exports
+#if defined(_MSC_VER)
 #ifdef SAFE99_DLL_EXPORTS
 #define SAFE99_API __declspec(dllexport)
 #else
 #define SAFE99_API __declspec(dllimport)
 #endif // SAFE99_DLL_EXPORTS
+#else
+#define SAFE99_API __attribute__((visibility("default")))
+#endif // _MSC_VER
 
 #define TO_STR(s) #s
 
 // alignment
+#if defined(_MSC_VER)
 #define ALIGN8 _declspec(align(8))
 #define ALIGN16 _declspec(align(16))
 #define ALIGN32 _declspec(align(32))
+#define ALIGN64 _declspec(align(64))
+#else
+#define ALIGN8 __attribute__((aligned(8)))
+#define ALIGN16 __attribute__((aligned(16)))
+#define ALIGN32 __attribute__((aligned(32)))
+#define ALIGN64 __attribute__((aligned(64)))
+#endif // _MSC_VER
 
 typedef struct rect
 {
@@ -89,12 +160,6 @@ typedef struct rect
     int bottom;
 } rect_t;
 
-typedef struct timer
-{
-    uint64_t frequency;
-    uint64_t prev_counter;
-} timer_t;
-
 ALIGN16 typedef struct color
 {
     union
@@ -0,0 +1,339 @@
+﻿//***************************************************************************
+// 
+// 파일: concurrent_memory_pool.h
+// 
+// 설명: 스레드별 캐시를 앞에 둔 고정 사이즈 메모리 풀
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// chunked_memory_pool_t는 스레드 안전하지 않으므로 공유 보관소(depot)에서만 잠금을 잡고 사용
+// - 스레드마다 concurrent_memory_pool_cache_t 하나를 가짐 (매거진 두 개 분량의 원소 포인터 배열)
+//   할당/해제는 대부분 자기 캐시에서 잠금 없이 끝남
+// - 캐시가 비면 보관소에서 매거진 하나를 통째로 가져오고, 가득 차면 매거진 하나를 통째로 돌려줌
+// - 다른 스레드가 할당한 원소를 해제하면 소유 캐시의 반환 스택에 lock-free로 넣음
+//   소유 스레드는 캐시가 비었을 때 반환 스택을 한 번에 가져감 (push만 CAS를 쓰므로 ABA 없음)
+// 
+// 캐시를 해제하기 전에 그 캐시에서 할당한 원소는 다른 스레드에서 모두 해제되어 있어야 함
+// 
+//***************************************************************************
+
+#ifndef CONCURRENT_MEMORY_POOL_H
+#define CONCURRENT_MEMORY_POOL_H
+
+#include <memory.h>
+
+#include "safe99_common/defines.h"
+#include "chunked_memory_pool.h"
+
+#define CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE 64
+#define CONCURRENT_MEMORY_POOL_CACHE_LINE_SIZE 64
+
+typedef struct concurrent_memory_pool
+{
+    // 아래 멤버는 모두 lock으로 보호
+    volatile long lock;
+    chunked_memory_pool_t backing_pool;
+
+    // CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE개씩 연결된 원소 묶음의 스택
+    void* p_full_magazines;
+    size_t num_full_magazines;
+
+    size_t element_size;
+    size_t element_size_with_header;
+} concurrent_memory_pool_t;
+
+typedef struct concurrent_memory_pool_cache
+{
+    concurrent_memory_pool_t* p_pool;
+
+    void* pa_elements[CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE * 2];
+    size_t num_elements;
+
+    size_t num_refills;
+    size_t num_flushes;
+
+    // 다른 스레드가 쓰는 멤버는 앞뒤로 캐시 라인을 분리 (캐시를 배열로 두어도 다음 캐시와 겹치지 않음)
+    char padding0[CONCURRENT_MEMORY_POOL_CACHE_LINE_SIZE];
+    void* volatile p_returned;
+    char padding1[CONCURRENT_MEMORY_POOL_CACHE_LINE_SIZE - sizeof(void*)];
+} concurrent_memory_pool_cache_t;
+
+// 원소 메모리 구조
+// [소유 캐시 포인터][원소]
+// 해제된 원소는 원소 영역에 연결 포인터를 저장
+// - [0]: 같은 매거진/반환 스택의 다음 원소
+// - [1]: 매거진의 첫 원소만 사용, 보관소의 다음 매거진
+#define CONCURRENT_MEMORY_POOL_HEADER_SIZE sizeof(void*)
+
+START_EXTERN_C
+
+static void __stdcall concurrent_memory_pool_refill(concurrent_memory_pool_cache_t* p_cache);
+static void __stdcall concurrent_memory_pool_flush(concurrent_memory_pool_cache_t* p_cache, const size_t num_elements);
+
+FORCEINLINE void __stdcall concurrent_memory_pool_lock(concurrent_memory_pool_t* p_pool)
+{
+    while (_InterlockedExchange(&p_pool->lock, 1) != 0)
+    {
+        while (p_pool->lock != 0)
+        {
+            _mm_pause();
+        }
+    }
+}
+
+FORCEINLINE void __stdcall concurrent_memory_pool_unlock(concurrent_memory_pool_t* p_pool)
+{
+    _InterlockedExchange(&p_pool->lock, 0);
+}
+
+FORCEINLINE void** __stdcall concurrent_memory_pool_get_links(void* p_element)
+{
+    return (void**)p_element;
+}
+
+FORCEINLINE concurrent_memory_pool_cache_t** __stdcall concurrent_memory_pool_get_owner(void* p_element)
+{
+    return (concurrent_memory_pool_cache_t**)((char*)p_element - CONCURRENT_MEMORY_POOL_HEADER_SIZE);
+}
+
+FORCEINLINE bool __stdcall concurrent_memory_pool_initialize(concurrent_memory_pool_t* p_pool, const size_t element_size, const size_t num_elements_per_chunk)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+    ASSERT(element_size > 0, "element_size == 0");
+    ASSERT(num_elements_per_chunk > 0, "num_elements_per_chunk == 0");
+
+    memset(p_pool, 0, sizeof(concurrent_memory_pool_t));
+
+    // 해제된 원소에 연결 포인터 두 개를 저장할 수 있어야 함
+    const size_t body_size = (element_size > sizeof(void*) * 2) ? element_size : sizeof(void*) * 2;
+
+    p_pool->element_size = element_size;
+    p_pool->element_size_with_header = (CONCURRENT_MEMORY_POOL_HEADER_SIZE + body_size + 7) & ~(size_t)7;
+
+    return chunked_memory_pool_initialize(&p_pool->backing_pool, p_pool->element_size_with_header, num_elements_per_chunk);
+}
+
+// 모든 캐시를 해제한 뒤 호출
+FORCEINLINE void __stdcall concurrent_memory_pool_release(concurrent_memory_pool_t* p_pool)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+
+    chunked_memory_pool_release(&p_pool->backing_pool);
+    memset(p_pool, 0, sizeof(concurrent_memory_pool_t));
+}
+
+FORCEINLINE size_t __stdcall concurrent_memory_pool_get_element_size(const concurrent_memory_pool_t* p_pool)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+    return p_pool->element_size;
+}
+
+// 보관소와 캐시에 남아 있는 원소를 제외한, 백업 풀에서 꺼낸 원소 수
+FORCEINLINE size_t __stdcall concurrent_memory_pool_get_num_backing_elements(concurrent_memory_pool_t* p_pool)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+
+    concurrent_memory_pool_lock(p_pool);
+    const size_t num_elements = chunked_memory_pool_get_num_alloc_elements(&p_pool->backing_pool);
+    concurrent_memory_pool_unlock(p_pool);
+
+    return num_elements;
+}
+
+// 스레드마다 하나씩, 해당 스레드에서만 사용
+FORCEINLINE void __stdcall concurrent_memory_pool_cache_initialize(concurrent_memory_pool_cache_t* p_cache, concurrent_memory_pool_t* p_pool)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+
+    memset(p_cache, 0, sizeof(concurrent_memory_pool_cache_t));
+    p_cache->p_pool = p_pool;
+}
+
+// 남은 원소를 모두 보관소와 백업 풀로 돌려줌
+FORCEINLINE void __stdcall concurrent_memory_pool_cache_release(concurrent_memory_pool_cache_t* p_cache)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+
+    void* p_returned = _InterlockedExchangePointer((void* volatile*)&p_cache->p_returned, NULL);
+    while (p_returned != NULL)
+    {
+        void* p_next = concurrent_memory_pool_get_links(p_returned)[0];
+        if (p_cache->num_elements == CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE * 2)
+        {
+            concurrent_memory_pool_flush(p_cache, CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE);
+        }
+        p_cache->pa_elements[p_cache->num_elements++] = p_returned;
+        p_returned = p_next;
+    }
+
+    while (p_cache->num_elements >= CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE)
+    {
+        concurrent_memory_pool_flush(p_cache, CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE);
+    }
+
+    // 매거진 하나가 안 되는 나머지는 백업 풀로
+    concurrent_memory_pool_t* p_pool = p_cache->p_pool;
+    concurrent_memory_pool_lock(p_pool);
+    for (size_t i = 0; i < p_cache->num_elements; ++i)
+    {
+        chunked_memory_pool_dealloc(&p_pool->backing_pool, (char*)p_cache->pa_elements[i] - CONCURRENT_MEMORY_POOL_HEADER_SIZE);
+    }
+    concurrent_memory_pool_unlock(p_pool);
+
+    memset(p_cache, 0, sizeof(concurrent_memory_pool_cache_t));
+}
+
+FORCEINLINE void* __stdcall concurrent_memory_pool_alloc_or_null(concurrent_memory_pool_cache_t* p_cache)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+    ASSERT(p_cache->p_pool != NULL, "cache not initialized");
+
+    if (p_cache->num_elements == 0)
+    {
+        concurrent_memory_pool_refill(p_cache);
+        if (p_cache->num_elements == 0)
+        {
+            return NULL;
+        }
+    }
+
+    void* p_element = p_cache->pa_elements[--p_cache->num_elements];
+    *concurrent_memory_pool_get_owner(p_element) = p_cache;
+
+    return p_element;
+}
+
+// p_cache는 해제하는 스레드의 캐시
+FORCEINLINE void __stdcall concurrent_memory_pool_dealloc(concurrent_memory_pool_cache_t* p_cache, void* p_element_or_null)
+{
+    ASSERT(p_cache != NULL, "p_cache == NULL");
+
+    if (p_element_or_null == NULL)
+    {
+        return;
+    }
+
+    concurrent_memory_pool_cache_t* p_owner = *concurrent_memory_pool_get_owner(p_element_or_null);
+    ASSERT(p_owner != NULL, "invalid element");
+    ASSERT(p_owner->p_pool == p_cache->p_pool, "mismatch pool");
+
+    if (p_owner != p_cache)
+    {
+        void* p_head;
+        do
+        {
+            p_head = p_owner->p_returned;
+            concurrent_memory_pool_get_links(p_element_or_null)[0] = p_head;
+        } while (_InterlockedCompareExchangePointer((void* volatile*)&p_owner->p_returned, p_element_or_null, p_head) != p_head);
+
+        return;
+    }
+
+    if (p_cache->num_elements == CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE * 2)
+    {
+        concurrent_memory_pool_flush(p_cache, CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE);
+    }
+
+    p_cache->pa_elements[p_cache->num_elements++] = p_element_or_null;
+}
+
+static void __stdcall concurrent_memory_pool_refill(concurrent_memory_pool_cache_t* p_cache)
+{
+    ASSERT(p_cache->num_elements == 0, "cache not empty");
+
+    // 1. 다른 스레드가 돌려준 원소
+    void* p_element = _InterlockedExchangePointer((void* volatile*)&p_cache->p_returned, NULL);
+    while (p_element != NULL && p_cache->num_elements < CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE * 2)
+    {
+        p_cache->pa_elements[p_cache->num_elements++] = p_element;
+        p_element = concurrent_memory_pool_get_links(p_element)[0];
+    }
+
+    if (p_element != NULL)
+    {
+        // 캐시에 다 안 들어간 나머지는 다시 반환 스택에 연결
+        void* p_tail = p_element;
+        while (concurrent_memory_pool_get_links(p_tail)[0] != NULL)
+        {
+            p_tail = concurrent_memory_pool_get_links(p_tail)[0];
+        }
+
+        void* p_head;
+        do
+        {
+            p_head = p_cache->p_returned;
+            concurrent_memory_pool_get_links(p_tail)[0] = p_head;
+        } while (_InterlockedCompareExchangePointer((void* volatile*)&p_cache->p_returned, p_element, p_head) != p_head);
+    }
+
+    if (p_cache->num_elements > 0)
+    {
+        return;
+    }
+
+    ++p_cache->num_refills;
+
+    // 2. 보관소의 매거진
+    concurrent_memory_pool_t* p_pool = p_cache->p_pool;
+    concurrent_memory_pool_lock(p_pool);
+
+    void* p_magazine = p_pool->p_full_magazines;
+    if (p_magazine != NULL)
+    {
+        p_pool->p_full_magazines = concurrent_memory_pool_get_links(p_magazine)[1];
+        --p_pool->num_full_magazines;
+        concurrent_memory_pool_unlock(p_pool);
+
+        while (p_magazine != NULL)
+        {
+            p_cache->pa_elements[p_cache->num_elements++] = p_magazine;
+            p_magazine = concurrent_memory_pool_get_links(p_magazine)[0];
+        }
+
+        return;
+    }
+
+    // 3. 백업 풀
+    for (size_t i = 0; i < CONCURRENT_MEMORY_POOL_MAGAZINE_SIZE; ++i)
+    {
+        char* p_block = (char*)chunked_memory_pool_alloc_or_null(&p_pool->backing_pool);
+        if (p_block == NULL)
+        {
+            break;
+        }
+
+        p_cache->pa_elements[p_cache->num_elements++] = p_block + CONCURRENT_MEMORY_POOL_HEADER_SIZE;
+    }
+
+    concurrent_memory_pool_unlock(p_pool);
+}
+
+// 캐시 위쪽 num_elements개를 매거진 하나로 묶어 보관소에 넣음
+static void __stdcall concurrent_memory_pool_flush(concurrent_memory_pool_cache_t* p_cache, const size_t num_elements)
+{
+    ASSERT(num_elements > 0 && num_elements <= p_cache->num_elements, "invalid num_elements");
+
+    void** pp_elements = p_cache->pa_elements + (p_cache->num_elements - num_elements);
+    for (size_t i = 0; i < num_elements - 1; ++i)
+    {
+        concurrent_memory_pool_get_links(pp_elements[i])[0] = pp_elements[i + 1];
+    }
+    concurrent_memory_pool_get_links(pp_elements[num_elements - 1])[0] = NULL;
+
+    p_cache->num_elements -= num_elements;
+    ++p_cache->num_flushes;
+
+    concurrent_memory_pool_t* p_pool = p_cache->p_pool;
+    concurrent_memory_pool_lock(p_pool);
+    concurrent_memory_pool_get_links(pp_elements[0])[1] = p_pool->p_full_magazines;
+    p_pool->p_full_magazines = pp_elements[0];
+    ++p_pool->num_full_magazines;
+    concurrent_memory_pool_unlock(p_pool);
+}
+
+END_EXTERN_C
+
+#endif // CONCURRENT_MEMORY_POOL_H
\ No newline at end of file
@@ -17,18 +17,33 @@
 
 #include "safe99_common/defines.h"
 
+// element_size * num_max_elements가 이 크기 이하이면 힙 할당 없이 내부 버퍼를 사용
+#define DYNAMIC_VECTOR_INLINE_BUFFER_SIZE 64
+#define DYNAMIC_VECTOR_DEFAULT_GROWTH_FACTOR 2.0f
+
+// 내부 버퍼를 사용 중인 벡터는 pa_elements가 자기 자신을 가리키므로 구조체를 memcpy로 복사하면 안 됨
 typedef struct dynamic_vector
 {
     char* pa_elements;
-
     size_t element_size;
     size_t num_elements;
     size_t num_max_elements;
+
+    float growth_factor;
+
+    uint64_t inline_buffer[DYNAMIC_VECTOR_INLINE_BUFFER_SIZE / sizeof(uint64_t)];
 } dynamic_vector_t;
 
 START_EXTERN_C
 
-static bool __stdcall expand(dynamic_vector_t* p_vector);
+static bool __stdcall expand(dynamic_vector_t* p_vector, const size_t num_min_elements);
+static bool __stdcall resize_buffer(dynamic_vector_t* p_vector, const size_t num_max_elements);
+
+FORCEINLINE bool __stdcall dynamic_vector_is_inline(const dynamic_vector_t* p_vector)
+{
+    ASSERT(p_vector != NULL, "p_vector == NULL");
+    return p_vector->pa_elements == (const char*)p_vector->inline_buffer;
+}
 
 FORCEINLINE bool __stdcall dynamic_vector_initialize(dynamic_vector_t* p_vector, const size_t element_size, const size_t num_max_elements)
 {
@@ -39,6 +54,15 @@ FORCEINLINE bool __stdcall dynamic_vector_initialize(dynamic_vector_t* p_vector,
     p_vector->element_size = element_size;
     p_vector->num_max_elements = num_max_elements;
     p_vector->num_elements = 0;
+    p_vector->growth_factor = DYNAMIC_VECTOR_DEFAULT_GROWTH_FACTOR;
+
+    // 작은 벡터는 내부 버퍼 사용
+    if (element_size * num_max_elements <= DYNAMIC_VECTOR_INLINE_BUFFER_SIZE)
+    {
+        p_vector->pa_elements = (char*)p_vector->inline_buffer;
+        p_vector->num_max_elements = DYNAMIC_VECTOR_INLINE_BUFFER_SIZE / element_size;
+        return true;
+    }
 
     p_vector->pa_elements = (char*)malloc(element_size * num_max_elements);
     if (p_vector->pa_elements == NULL)
@@ -60,7 +84,10 @@ FORCEINLINE void __stdcall dynamic_vector_release(dynamic_vector_t* p_vector)
         return;
     }
 
-    SAFE_FREE(p_vector->pa_elements);
+    if (!dynamic_vector_is_inline(p_vector))
+    {
+        SAFE_FREE(p_vector->pa_elements);
+    }
     memset(p_vector, 0, sizeof(dynamic_vector_t));
 }
 
@@ -70,31 +97,108 @@ FORCEINLINE void __stdcall dynamic_vector_clear(dynamic_vector_t* p_vector)
     p_vector->num_elements = 0;
 }
 
-FORCEINLINE void __stdcall dynamic_vector_push_back(dynamic_vector_t* p_vector, const void* p_element, const size_t element_size)
+// 확장 시 num_max_elements * growth_factor로 늘림 (1.0보다 커야 함)
+FORCEINLINE void __stdcall dynamic_vector_set_growth_factor(dynamic_vector_t* p_vector, const float growth_factor)
+{
+    ASSERT(p_vector != NULL, "p_vector == NULL");
+    ASSERT(growth_factor > 1.0f, "growth_factor <= 1.0f");
+    p_vector->growth_factor = growth_factor;
+}
+
+// num_max_elements 이상을 담을 수 있도록 미리 확보
+FORCEINLINE bool __stdcall dynamic_vector_reserve(dynamic_vector_t* p_vector, const size_t num_max_elements)
+{
+    ASSERT(p_vector != NULL, "p_vector == NULL");
+
+    if (num_max_elements <= p_vector->num_max_elements)
+    {
+        return true;
+    }
+
+    return resize_buffer(p_vector, num_max_elements);
+}
+
+// 남는 공간 반환, 내부 버퍼에 들어가면 내부 버퍼로 되돌림
+FORCEINLINE bool __stdcall dynamic_vector_shrink_to_fit(dynamic_vector_t* p_vector)
+{
+    ASSERT(p_vector != NULL, "p_vector == NULL");
+
+    if (dynamic_vector_is_inline(p_vector))
+    {
+        return true;
+    }
+
+    const size_t num_max_elements = (p_vector->num_elements > 0) ? p_vector->num_elements : 1;
+    if (num_max_elements == p_vector->num_max_elements)
+    {
+        return true;
+    }
+
+    return resize_buffer(p_vector, num_max_elements);
+}
+
+FORCEINLINE bool __stdcall dynamic_vector_push_back(dynamic_vector_t* p_vector, const void* p_element, const size_t element_size)
 {
     ASSERT(p_vector != NULL, "p_vector == NULL");
     ASSERT(p_element != NULL, "p_element == NULL");
     ASSERT(p_vector->element_size == element_size, "mismatch size");
 
-    if (p_vector->num_elements >= p_vector->num_max_elements)
+    if (p_vector->num_elements >= p_vector->num_max_elements
+        && !expand(p_vector, p_vector->num_elements + 1))
     {
-        expand(p_vector);
+        return false;
     }
 
     memcpy(p_vector->pa_elements + p_vector->element_size * p_vector->num_elements, p_element, element_size);
     ++p_vector->num_elements;
+
+    return true;
+}
+
+// 확장은 최대 한 번
+FORCEINLINE bool __stdcall dynamic_vector_push_back_n(dynamic_vector_t* p_vector, const void* p_elements, const size_t element_size, const size_t num_elements)
+{
+    ASSERT(p_vector != NULL, "p_vector == NULL");
+    ASSERT(p_elements != NULL || num_elements == 0, "p_elements == NULL");
+    ASSERT(p_vector->element_size == element_size, "mismatch size");
+
+    if (p_vector->num_elements + num_elements > p_vector->num_max_elements
+        && !expand(p_vector, p_vector->num_elements + num_elements))
+    {
+        return false;
+    }
+
+    memcpy(p_vector->pa_elements + p_vector->element_size * p_vector->num_elements, p_elements, element_size * num_elements);
+    p_vector->num_elements += num_elements;
+
+    return true;
+}
+
+// p_src의 [start_index, start_index + num_elements) 구간을 뒤에 추가
+FORCEINLINE bool __stdcall dynamic_vector_append_range(dynamic_vector_t* p_vector, const dynamic_vector_t* p_src, const size_t start_index, const size_t num_elements)
+{
+    ASSERT(p_vector != NULL, "p_vector == NULL");
+    ASSERT(p_src != NULL, "p_src == NULL");
+    ASSERT(p_vector != p_src, "p_vector == p_src");
+    ASSERT(start_index + num_elements <= p_src->num_elements, "invalid range");
+
+    return dynamic_vector_push_back_n(p_vector, p_src->pa_elements + p_src->element_size * start_index,
+                                      p_src->element_size, num_elements);
 }
 
-FORCEINLINE void __stdcall dynamic_vector_push_back_empty(dynamic_vector_t* p_vector)
+FORCEINLINE bool __stdcall dynamic_vector_push_back_empty(dynamic_vector_t* p_vector)
 {
     ASSERT(p_vector != NULL, "p_vector == NULL");
 
-    if (p_vector->num_elements >= p_vector->num_max_elements)
+    if (p_vector->num_elements >= p_vector->num_max_elements
+        && !expand(p_vector, p_vector->num_elements + 1))
     {
-        expand(p_vector);
+        return false;
     }
 
     ++p_vector->num_elements;
+
+    return true;
 }
 
 FORCEINLINE void __stdcall dynamic_vector_pop_back(dynamic_vector_t* p_vector)
@@ -105,16 +209,17 @@ FORCEINLINE void __stdcall dynamic_vector_pop_back(dynamic_vector_t* p_vector)
     --p_vector->num_elements;
 }
 
-FORCEINLINE void __stdcall dynamic_vector_insert(dynamic_vector_t* p_vector, const void* p_element, const size_t element_size, const size_t index)
+FORCEINLINE bool __stdcall dynamic_vector_insert(dynamic_vector_t* p_vector, const void* p_element, const size_t element_size, const size_t index)
 {
     ASSERT(p_vector != NULL, "p_vector == NULL");
     ASSERT(p_element != NULL, "p_element == NULL");
     ASSERT(p_vector->element_size == element_size, "mismatch size");
     ASSERT(index <= p_vector->num_elements, "invalid index");
 
-    if (p_vector->num_elements >= p_vector->num_max_elements)
+    if (p_vector->num_elements >= p_vector->num_max_elements
+        && !expand(p_vector, p_vector->num_elements + 1))
     {
-        expand(p_vector);
+        return false;
     }
 
     // element 이동
@@ -126,16 +231,19 @@ FORCEINLINE void __stdcall dynamic_vector_insert(dynamic_vector_t* p_vector, con
     memcpy(src, p_element, element_size);
 
     ++p_vector->num_elements;
+
+    return true;
 }
 
-FORCEINLINE void __stdcall dynamic_vector_insert_empty(dynamic_vector_t* p_vector, const size_t index)
+FORCEINLINE bool __stdcall dynamic_vector_insert_empty(dynamic_vector_t* p_vector, const size_t index)
 {
     ASSERT(p_vector != NULL, "p_vector == NULL");
     ASSERT(index <= p_vector->num_elements, "invalid index");
 
-    if (p_vector->num_elements >= p_vector->num_max_elements)
+    if (p_vector->num_elements >= p_vector->num_max_elements
+        && !expand(p_vector, p_vector->num_elements + 1))
     {
-        expand(p_vector);
+        return false;
     }
 
     // element 이동
@@ -146,6 +254,8 @@ FORCEINLINE void __stdcall dynamic_vector_insert_empty(dynamic_vector_t* p_vecto
     memmove(dst, src, element_size * len);
 
     ++p_vector->num_elements;
+
+    return true;
 }
 
 FORCEINLINE void __stdcall dynamic_vector_remove(dynamic_vector_t* p_vector, const size_t index)
@@ -204,22 +314,75 @@ FORCEINLINE char* __stdcall dynamic_vector_get_elements_ptr_or_null(const dynami
     return p_vector->pa_elements;
 }
 
-static bool __stdcall expand(dynamic_vector_t* p_vector)
+static bool __stdcall expand(dynamic_vector_t* p_vector, const size_t num_min_elements)
+{
+    ASSERT(p_vector != NULL, "p_vector == NULL");
+    ASSERT(p_vector->growth_factor > 1.0f, "growth_factor <= 1.0f");
+
+    size_t num_max_elements = (size_t)((float)p_vector->num_max_elements * p_vector->growth_factor);
+    if (num_max_elements <= p_vector->num_max_elements)
+    {
+        num_max_elements = p_vector->num_max_elements + 1;
+    }
+    if (num_max_elements < num_min_elements)
+    {
+        num_max_elements = num_min_elements;
+    }
+
+    return resize_buffer(p_vector, num_max_elements);
+}
+
+static bool __stdcall resize_buffer(dynamic_vector_t* p_vector, const size_t num_max_elements)
 {
     ASSERT(p_vector != NULL, "p_vector == NULL");
+    ASSERT(num_max_elements >= p_vector->num_elements, "num_max_elements < num_elements");
+    ASSERT(num_max_elements > 0, "num_max_elements == 0");
+
+    const size_t element_size = p_vector->element_size;
+
+    // 내부 버퍼로 되돌림
+    if (element_size * num_max_elements <= DYNAMIC_VECTOR_INLINE_BUFFER_SIZE)
+    {
+        if (!dynamic_vector_is_inline(p_vector))
+        {
+            char* pa_old_space = p_vector->pa_elements;
+            memcpy(p_vector->inline_buffer, pa_old_space, element_size * p_vector->num_elements);
+            free(pa_old_space);
+
+            p_vector->pa_elements = (char*)p_vector->inline_buffer;
+        }
+
+        p_vector->num_max_elements = DYNAMIC_VECTOR_INLINE_BUFFER_SIZE / element_size;
+        return true;
+    }
 
-    char* pa_new_space = (char*)malloc(p_vector->element_size * p_vector->num_max_elements * 2);
+    // 내부 버퍼 -> 힙
+    if (dynamic_vector_is_inline(p_vector))
+    {
+        char* pa_new_space = (char*)malloc(element_size * num_max_elements);
+        if (pa_new_space == NULL)
+        {
+            ASSERT(false, "Failed malloc new space");
+            return false;
+        }
+
+        memcpy(pa_new_space, p_vector->inline_buffer, element_size * p_vector->num_elements);
+
+        p_vector->pa_elements = pa_new_space;
+        p_vector->num_max_elements = num_max_elements;
+        return true;
+    }
+
+    // 힙 -> 힙, 뒤에 빈 공간이 있으면 복사 없이 제자리에서 늘어남
+    char* pa_new_space = (char*)realloc(p_vector->pa_elements, element_size * num_max_elements);
     if (pa_new_space == NULL)
     {
-        ASSERT(false, "Failed malloc new space");
+        ASSERT(false, "Failed realloc new space");
         return false;
     }
 
-    memcpy(pa_new_space, p_vector->pa_elements, p_vector->element_size * p_vector->num_max_elements);
-
-    free(p_vector->pa_elements);
     p_vector->pa_elements = pa_new_space;
-    p_vector->num_max_elements *= 2;
+    p_vector->num_max_elements = num_max_elements;
 
     return true;
 }
@@ -0,0 +1,448 @@
+﻿//***************************************************************************
+// 
+// 파일: flat_map.h
+// 
+// 설명: 오픈 어드레싱 해시맵
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// map_t와 달리 버킷 리스트와 메모리 풀 없이 배열 두 개만 사용
+// - 컨트롤 바이트: 슬롯마다 1바이트 (비어 있으면 0x80, 아니면 해시 상위 7비트)
+//   16개씩 SSE2로 한 번에 비교
+// - 슬롯: [해시 8바이트][키][값]을 한 곳에 저장
+// 선형 탐사 + 역방향 이동 삭제를 사용하므로 툼스톤이 없음
+// 해시는 초기화할 때 키 크기에 따라 한 번 선택 (4/8바이트 정수 키는 hash64_u32/hash64_u64, 그 외 hash64_wyhash)
+// 
+//***************************************************************************
+
+#ifndef FLAT_MAP_H
+#define FLAT_MAP_H
+
+#include <memory.h>
+
+#include "safe99_common/defines.h"
+#include "util/hash_function.h"
+
+#define FLAT_MAP_GROUP_SIZE 16
+#define FLAT_MAP_CONTROL_EMPTY ((uint8_t)0x80)
+
+// 원소 수가 용량의 7/8을 넘으면 확장
+#define FLAT_MAP_MAX_LOAD_FACTOR_NUMERATOR 7
+#define FLAT_MAP_MAX_LOAD_FACTOR_DENOMINATOR 8
+
+typedef uint64_t (__stdcall *flat_map_hash_func)(const void* p_key, const size_t key_size, const uint64_t seed);
+
+typedef struct flat_map
+{
+    flat_map_hash_func pf_hash;
+
+    size_t key_size;
+    size_t value_size;
+    size_t slot_size;
+
+    uint64_t seed;
+
+    // 2의 거듭제곱
+    size_t num_max_elements;
+    size_t num_elements;
+
+    // num_max_elements + FLAT_MAP_GROUP_SIZE - 1
+    // 앞쪽 FLAT_MAP_GROUP_SIZE - 1개를 끝에 복사해 두어 경계를 넘는 그룹도 한 번에 읽음
+    uint8_t* pa_controls;
+    char* pa_slots;
+} flat_map_t;
+
+// 중복 키와 확장 실패를 구분하기 위한 삽입 결과
+typedef enum flat_map_insert_result
+{
+    FLAT_MAP_INSERT_RESULT_SUCCESS,
+    FLAT_MAP_INSERT_RESULT_KEY_EXISTS,
+    FLAT_MAP_INSERT_RESULT_FAILED_REHASH
+} flat_map_insert_result_t;
+
+START_EXTERN_C
+
+static bool __stdcall flat_map_rehash(flat_map_t* p_map, const size_t num_max_elements);
+static bool __stdcall flat_map_find_index(const flat_map_t* p_map, const uint64_t hash, const void* p_key, size_t* p_out_index);
+
+FORCEINLINE char* __stdcall flat_map_get_slot(const flat_map_t* p_map, const size_t index)
+{
+    return p_map->pa_slots + p_map->slot_size * index;
+}
+
+FORCEINLINE uint64_t __stdcall flat_map_get_slot_hash(const flat_map_t* p_map, const size_t index)
+{
+    return *(const uint64_t*)flat_map_get_slot(p_map, index);
+}
+
+FORCEINLINE void __stdcall flat_map_set_control(flat_map_t* p_map, const size_t index, const uint8_t control)
+{
+    p_map->pa_controls[index] = control;
+    if (index < FLAT_MAP_GROUP_SIZE - 1)
+    {
+        p_map->pa_controls[p_map->num_max_elements + index] = control;
+    }
+}
+
+// 시작 위치는 해시 하위 비트이므로 상위 7비트를 써야 같은 위치에서 시작하는 키도 걸러짐
+FORCEINLINE uint8_t __stdcall flat_map_hash_to_control(const uint64_t hash)
+{
+    return (uint8_t)(hash >> 57);
+}
+
+static uint64_t __stdcall flat_map_hash_u32(const void* p_key, const size_t key_size, const uint64_t seed)
+{
+    (void)key_size;
+
+    uint32_t key;
+    memcpy(&key, p_key, sizeof(uint32_t));
+    return hash64_u32_seed(key, seed);
+}
+
+static uint64_t __stdcall flat_map_hash_u64(const void* p_key, const size_t key_size, const uint64_t seed)
+{
+    (void)key_size;
+
+    uint64_t key;
+    memcpy(&key, p_key, sizeof(uint64_t));
+    return hash64_u64_seed(key, seed);
+}
+
+static uint64_t __stdcall flat_map_hash_bytes(const void* p_key, const size_t key_size, const uint64_t seed)
+{
+    return hash64_wyhash_seed((const char*)p_key, key_size, seed);
+}
+
+FORCEINLINE uint64_t __stdcall flat_map_hash_key(const flat_map_t* p_map, const void* p_key)
+{
+    return p_map->pf_hash(p_key, p_map->key_size, p_map->seed);
+}
+
+// 외부 입력을 키로 쓰는 경우 실행마다 다른 seed를 사용
+FORCEINLINE bool __stdcall flat_map_initialize_with_seed(flat_map_t* p_map, const size_t key_size, const size_t value_size, const size_t num_max_elements, const uint64_t seed)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+    ASSERT(key_size > 0, "key_size == 0");
+    ASSERT(num_max_elements > 0, "num_max_elements == 0");
+
+    memset(p_map, 0, sizeof(flat_map_t));
+
+    p_map->key_size = key_size;
+    p_map->value_size = value_size;
+    p_map->seed = seed;
+
+    switch (key_size)
+    {
+    case sizeof(uint32_t):
+        p_map->pf_hash = flat_map_hash_u32;
+        break;
+    case sizeof(uint64_t):
+        p_map->pf_hash = flat_map_hash_u64;
+        break;
+    default:
+        p_map->pf_hash = flat_map_hash_bytes;
+        break;
+    }
+
+    // 해시 8바이트 + 키 + 값, 8바이트 정렬
+    p_map->slot_size = (sizeof(uint64_t) + key_size + value_size + 7) & ~(size_t)7;
+
+    // num_max_elements개를 넣어도 확장되지 않는 크기
+    size_t capacity = FLAT_MAP_GROUP_SIZE;
+    while (capacity * FLAT_MAP_MAX_LOAD_FACTOR_NUMERATOR / FLAT_MAP_MAX_LOAD_FACTOR_DENOMINATOR < num_max_elements)
+    {
+        capacity *= 2;
+    }
+
+    return flat_map_rehash(p_map, capacity);
+}
+
+FORCEINLINE bool __stdcall flat_map_initialize(flat_map_t* p_map, const size_t key_size, const size_t value_size, const size_t num_max_elements)
+{
+    return flat_map_initialize_with_seed(p_map, key_size, value_size, num_max_elements, 0);
+}
+
+FORCEINLINE void __stdcall flat_map_release(flat_map_t* p_map)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+
+    SAFE_FREE(p_map->pa_controls);
+    SAFE_FREE(p_map->pa_slots);
+    memset(p_map, 0, sizeof(flat_map_t));
+}
+
+FORCEINLINE void __stdcall flat_map_clear(flat_map_t* p_map)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+
+    memset(p_map->pa_controls, FLAT_MAP_CONTROL_EMPTY, p_map->num_max_elements + FLAT_MAP_GROUP_SIZE - 1);
+    p_map->num_elements = 0;
+}
+
+// 이미 있는 키면 FLAT_MAP_INSERT_RESULT_KEY_EXISTS, 확장할 메모리가 없으면 FLAT_MAP_INSERT_RESULT_FAILED_REHASH
+FORCEINLINE flat_map_insert_result_t __stdcall flat_map_insert_by_hash(flat_map_t* p_map, const uint64_t hash, const void* p_key, const size_t key_size, const void* p_value, const size_t value_size)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+    ASSERT(p_key != NULL, "p_key == NULL");
+    ASSERT(p_map->key_size == key_size, "mismatch key size");
+    ASSERT(p_map->value_size == value_size, "mismatch value size");
+    ASSERT(p_value != NULL || value_size == 0, "p_value == NULL");
+
+    size_t index;
+    if (flat_map_find_index(p_map, hash, p_key, &index))
+    {
+        return FLAT_MAP_INSERT_RESULT_KEY_EXISTS;
+    }
+
+    if ((p_map->num_elements + 1) * FLAT_MAP_MAX_LOAD_FACTOR_DENOMINATOR > p_map->num_max_elements * FLAT_MAP_MAX_LOAD_FACTOR_NUMERATOR)
+    {
+        if (!flat_map_rehash(p_map, p_map->num_max_elements * 2))
+        {
+            return FLAT_MAP_INSERT_RESULT_FAILED_REHASH;
+        }
+
+        flat_map_find_index(p_map, hash, p_key, &index);
+    }
+
+    char* p_slot = flat_map_get_slot(p_map, index);
+    *(uint64_t*)p_slot = hash;
+    memcpy(p_slot + sizeof(uint64_t), p_key, key_size);
+    if (value_size > 0)
+    {
+        memcpy(p_slot + sizeof(uint64_t) + key_size, p_value, value_size);
+    }
+    flat_map_set_control(p_map, index, flat_map_hash_to_control(hash));
+
+    ++p_map->num_elements;
+
+    return FLAT_MAP_INSERT_RESULT_SUCCESS;
+}
+
+FORCEINLINE flat_map_insert_result_t __stdcall flat_map_insert(flat_map_t* p_map, const void* p_key, const size_t key_size, const void* p_value, const size_t value_size)
+{
+    return flat_map_insert_by_hash(p_map, flat_map_hash_key(p_map, p_key), p_key, key_size, p_value, value_size);
+}
+
+FORCEINLINE bool __stdcall flat_map_remove_by_hash(flat_map_t* p_map, const uint64_t hash, const void* p_key, const size_t key_size)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+    ASSERT(p_key != NULL, "p_key == NULL");
+    ASSERT(p_map->key_size == key_size, "mismatch key size");
+    (void)key_size;
+
+    size_t hole;
+    if (!flat_map_find_index(p_map, hash, p_key, &hole))
+    {
+        return false;
+    }
+
+    // 역방향 이동: 뒤따르는 원소 중 hole로 옮겨도 탐사 경로가 끊기지 않는 원소를 당겨 옴
+    const size_t mask = p_map->num_max_elements - 1;
+    size_t index = hole;
+    while (true)
+    {
+        index = (index + 1) & mask;
+
+        const uint8_t control = p_map->pa_controls[index];
+        if (control == FLAT_MAP_CONTROL_EMPTY)
+        {
+            break;
+        }
+
+        // hole이 (home, index] 구간 밖에 있으면 옮길 수 없음
+        const size_t home = (size_t)flat_map_get_slot_hash(p_map, index) & mask;
+        const size_t distance_to_index = (index - home) & mask;
+        const size_t distance_to_hole = (hole - home) & mask;
+        if (distance_to_hole > distance_to_index)
+        {
+            continue;
+        }
+
+        memcpy(flat_map_get_slot(p_map, hole), flat_map_get_slot(p_map, index), p_map->slot_size);
+        flat_map_set_control(p_map, hole, control);
+        hole = index;
+    }
+
+    flat_map_set_control(p_map, hole, FLAT_MAP_CONTROL_EMPTY);
+    --p_map->num_elements;
+
+    return true;
+}
+
+FORCEINLINE bool __stdcall flat_map_remove(flat_map_t* p_map, const void* p_key, const size_t key_size)
+{
+    return flat_map_remove_by_hash(p_map, flat_map_hash_key(p_map, p_key), p_key, key_size);
+}
+
+FORCEINLINE void* __stdcall flat_map_get_value_by_hash_or_null(const flat_map_t* p_map, const uint64_t hash, const void* p_key, const size_t key_size)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+    ASSERT(p_key != NULL, "p_key == NULL");
+    ASSERT(p_map->key_size == key_size, "mismatch key size");
+
+    size_t index;
+    if (!flat_map_find_index(p_map, hash, p_key, &index))
+    {
+        return NULL;
+    }
+
+    return flat_map_get_slot(p_map, index) + sizeof(uint64_t) + key_size;
+}
+
+FORCEINLINE void* __stdcall flat_map_get_value_or_null(const flat_map_t* p_map, const void* p_key, const size_t key_size)
+{
+    return flat_map_get_value_by_hash_or_null(p_map, flat_map_hash_key(p_map, p_key), p_key, key_size);
+}
+
+FORCEINLINE size_t __stdcall flat_map_get_count(const flat_map_t* p_map, const void* p_key, const size_t key_size)
+{
+    return (flat_map_get_value_or_null(p_map, p_key, key_size) != NULL) ? 1 : 0;
+}
+
+FORCEINLINE size_t __stdcall flat_map_get_num_elements(const flat_map_t* p_map)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+    return p_map->num_elements;
+}
+
+FORCEINLINE size_t __stdcall flat_map_get_num_max_elements(const flat_map_t* p_map)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+    return p_map->num_max_elements;
+}
+
+// 순회: 0 ~ num_max_elements - 1 중 flat_map_is_occupied()인 슬롯만 유효
+FORCEINLINE bool __stdcall flat_map_is_occupied(const flat_map_t* p_map, const size_t index)
+{
+    ASSERT(p_map != NULL, "p_map == NULL");
+    ASSERT(index < p_map->num_max_elements, "invalid index");
+    return p_map->pa_controls[index] != FLAT_MAP_CONTROL_EMPTY;
+}
+
+FORCEINLINE void* __stdcall flat_map_get_key_at(const flat_map_t* p_map, const size_t index)
+{
+    ASSERT(flat_map_is_occupied(p_map, index), "empty slot");
+    return flat_map_get_slot(p_map, index) + sizeof(uint64_t);
+}
+
+FORCEINLINE void* __stdcall flat_map_get_value_at(const flat_map_t* p_map, const size_t index)
+{
+    ASSERT(flat_map_is_occupied(p_map, index), "empty slot");
+    return flat_map_get_slot(p_map, index) + sizeof(uint64_t) + p_map->key_size;
+}
+
+// 키를 찾으면 true와 그 위치, 못 찾으면 false와 삽입할 빈 슬롯 위치
+static bool __stdcall flat_map_find_index(const flat_map_t* p_map, const uint64_t hash, const void* p_key, size_t* p_out_index)
+{
+    const size_t mask = p_map->num_max_elements - 1;
+    const __m128i control = _mm_set1_epi8((char)flat_map_hash_to_control(hash));
+    const __m128i empty = _mm_set1_epi8((char)FLAT_MAP_CONTROL_EMPTY);
+
+    size_t position = (size_t)hash & mask;
+    while (true)
+    {
+        const __m128i group = _mm_loadu_si128((const __m128i*)(p_map->pa_controls + position));
+        uint32_t match_mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, control));
+        const uint32_t empty_mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, empty));
+
+        // 선형 탐사이므로 첫 빈 슬롯 뒤는 볼 필요 없음
+        if (empty_mask != 0)
+        {
+            match_mask &= (empty_mask & (0 - empty_mask)) - 1;
+        }
+
+        while (match_mask != 0)
+        {
+            unsigned long bit;
+            _BitScanForward(&bit, match_mask);
+            match_mask &= match_mask - 1;
+
+            const size_t index = (position + bit) & mask;
+            const char* p_slot = flat_map_get_slot(p_map, index);
+            if (*(const uint64_t*)p_slot == hash
+                && memcmp(p_slot + sizeof(uint64_t), p_key, p_map->key_size) == 0)
+            {
+                *p_out_index = index;
+                return true;
+            }
+        }
+
+        if (empty_mask != 0)
+        {
+            unsigned long bit;
+            _BitScanForward(&bit, empty_mask);
+
+            *p_out_index = (position + bit) & mask;
+            return false;
+        }
+
+        position = (position + FLAT_MAP_GROUP_SIZE) & mask;
+    }
+}
+
+static bool __stdcall flat_map_rehash(flat_map_t* p_map, const size_t num_max_elements)
+{
+    ASSERT(num_max_elements >= FLAT_MAP_GROUP_SIZE, "num_max_elements < FLAT_MAP_GROUP_SIZE");
+    ASSERT((num_max_elements & (num_max_elements - 1)) == 0, "num_max_elements is not power of 2");
+
+    uint8_t* pa_new_controls = (uint8_t*)malloc(num_max_elements + FLAT_MAP_GROUP_SIZE - 1);
+    char* pa_new_slots = (char*)malloc(p_map->slot_size * num_max_elements);
+    if (pa_new_controls == NULL || pa_new_slots == NULL)
+    {
+        ASSERT(false, "Failed to malloc new space");
+        free(pa_new_controls);
+        free(pa_new_slots);
+        return false;
+    }
+    memset(pa_new_controls, FLAT_MAP_CONTROL_EMPTY, num_max_elements + FLAT_MAP_GROUP_SIZE - 1);
+
+    flat_map_t old_map = *p_map;
+
+    p_map->num_max_elements = num_max_elements;
+    p_map->pa_controls = pa_new_controls;
+    p_map->pa_slots = pa_new_slots;
+
+    // 저장된 해시로 다시 배치, 키는 모두 다르므로 비교 없이 빈 슬롯만 찾음
+    const size_t mask = num_max_elements - 1;
+    const __m128i empty = _mm_set1_epi8((char)FLAT_MAP_CONTROL_EMPTY);
+    for (size_t i = 0; i < old_map.num_max_elements; ++i)
+    {
+        if (old_map.pa_controls[i] == FLAT_MAP_CONTROL_EMPTY)
+        {
+            continue;
+        }
+
+        const char* p_old_slot = old_map.pa_slots + old_map.slot_size * i;
+        const uint64_t hash = *(const uint64_t*)p_old_slot;
+
+        size_t position = (size_t)hash & mask;
+        while (true)
+        {
+            const __m128i group = _mm_loadu_si128((const __m128i*)(pa_new_controls + position));
+            const uint32_t empty_mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, empty));
+            if (empty_mask != 0)
+            {
+                unsigned long bit;
+                _BitScanForward(&bit, empty_mask);
+                position = (position + bit) & mask;
+                break;
+            }
+
+            position = (position + FLAT_MAP_GROUP_SIZE) & mask;
+        }
+
+        memcpy(flat_map_get_slot(p_map, position), p_old_slot, p_map->slot_size);
+        flat_map_set_control(p_map, position, old_map.pa_controls[i]);
+    }
+
+    free(old_map.pa_controls);
+    free(old_map.pa_slots);
+
+    return true;
+}
+
+END_EXTERN_C
+
+#endif // FLAT_MAP_H
\ No newline at end of file
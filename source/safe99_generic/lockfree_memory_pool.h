@@ -0,0 +1,172 @@
+﻿//***************************************************************************
+// 
+// 파일: lockfree_memory_pool.h
+// 
+// 설명: 여러 스레드가 잠금 없이 공유하는 고정 사이즈 메모리 풀
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// static_memory_pool_t처럼 최대 원소 수를 초기화 때 모두 예약하고 더 늘리지 않음
+// 해제된 원소는 인덱스 기반 Treiber 스택으로 관리
+// - head: [상위 32비트: 태그][하위 32비트: 원소 인덱스]
+//   push/pop마다 태그가 증가하므로 같은 인덱스가 빠졌다 다시 들어와도 CAS가 실패함 (ABA 방지)
+// - 다음 인덱스는 원소 밖의 별도 배열에 저장
+//   다른 스레드가 먼저 꺼내 간 원소의 내용을 덮어써도 pop이 잘못된 포인터를 따라가지 않음
+// 
+//***************************************************************************
+
+#ifndef LOCKFREE_MEMORY_POOL_H
+#define LOCKFREE_MEMORY_POOL_H
+
+#include <memory.h>
+
+#include "safe99_common/defines.h"
+
+#define LOCKFREE_MEMORY_POOL_INVALID_INDEX UINT32_MAX
+#define LOCKFREE_MEMORY_POOL_CACHE_LINE_SIZE 64
+
+// head가 앞 객체와 캐시 라인을 공유하지 않도록 캐시 라인 단위로 정렬
+ALIGN64 typedef struct lockfree_memory_pool
+{
+    volatile int64_t head;
+
+    // 모든 스레드가 CAS하는 head와 읽기 전용 멤버의 캐시 라인을 분리
+    char padding[LOCKFREE_MEMORY_POOL_CACHE_LINE_SIZE - sizeof(int64_t)];
+
+    char* pa_elements;
+    volatile uint32_t* pa_next_indices;
+
+    size_t element_size;
+    size_t element_size_with_padding;
+    size_t num_max_elements;
+} lockfree_memory_pool_t;
+
+START_EXTERN_C
+
+FORCEINLINE int64_t __stdcall lockfree_memory_pool_make_head(const int64_t prev_head, const uint32_t index)
+{
+    const uint64_t tag = ((uint64_t)prev_head >> 32) + 1;
+    return (int64_t)((tag << 32) | index);
+}
+
+FORCEINLINE bool __stdcall lockfree_memory_pool_initialize(lockfree_memory_pool_t* p_pool, const size_t element_size, const size_t num_max_elements)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+    ASSERT(element_size > 0, "element_size == 0");
+    ASSERT(num_max_elements > 0 && num_max_elements < LOCKFREE_MEMORY_POOL_INVALID_INDEX, "invalid num_max_elements");
+
+    memset(p_pool, 0, sizeof(lockfree_memory_pool_t));
+
+    p_pool->element_size = element_size;
+    p_pool->element_size_with_padding = (element_size + 7) & ~(size_t)7;
+    p_pool->num_max_elements = num_max_elements;
+
+    p_pool->pa_elements = (char*)malloc(p_pool->element_size_with_padding * num_max_elements);
+    p_pool->pa_next_indices = (volatile uint32_t*)malloc(sizeof(uint32_t) * num_max_elements);
+    if (p_pool->pa_elements == NULL || p_pool->pa_next_indices == NULL)
+    {
+        ASSERT(false, "Failed to malloc pool");
+        goto failed_init;
+    }
+
+    // 0번부터 순서대로 꺼내지도록 연결
+    for (size_t i = 0; i < num_max_elements - 1; ++i)
+    {
+        p_pool->pa_next_indices[i] = (uint32_t)(i + 1);
+    }
+    p_pool->pa_next_indices[num_max_elements - 1] = LOCKFREE_MEMORY_POOL_INVALID_INDEX;
+    p_pool->head = 0;
+
+    return true;
+
+failed_init:
+    SAFE_FREE(p_pool->pa_elements);
+    free((void*)p_pool->pa_next_indices);
+    memset(p_pool, 0, sizeof(lockfree_memory_pool_t));
+
+    return false;
+}
+
+// 다른 스레드가 사용 중이지 않을 때 호출
+FORCEINLINE void __stdcall lockfree_memory_pool_release(lockfree_memory_pool_t* p_pool)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+
+    SAFE_FREE(p_pool->pa_elements);
+    free((void*)p_pool->pa_next_indices);
+    memset(p_pool, 0, sizeof(lockfree_memory_pool_t));
+}
+
+// 남은 원소가 없으면 NULL
+FORCEINLINE void* __stdcall lockfree_memory_pool_alloc_or_null(lockfree_memory_pool_t* p_pool)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+
+    int64_t head = p_pool->head;
+    for (;;)
+    {
+        const uint32_t index = (uint32_t)head;
+        if (index == LOCKFREE_MEMORY_POOL_INVALID_INDEX)
+        {
+            return NULL;
+        }
+
+        // index가 그 사이에 다른 스레드에 꺼내졌다면 태그가 바뀌어 CAS가 실패하므로 오래된 값이어도 됨
+        const int64_t new_head = lockfree_memory_pool_make_head(head, p_pool->pa_next_indices[index]);
+        const int64_t prev_head = _InterlockedCompareExchange64(&p_pool->head, new_head, head);
+        if (prev_head == head)
+        {
+            return p_pool->pa_elements + p_pool->element_size_with_padding * index;
+        }
+
+        head = prev_head;
+    }
+}
+
+FORCEINLINE void __stdcall lockfree_memory_pool_dealloc(lockfree_memory_pool_t* p_pool, void* p_element_or_null)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+
+    if (p_element_or_null == NULL)
+    {
+        return;
+    }
+
+    const size_t offset = (size_t)((char*)p_element_or_null - p_pool->pa_elements);
+    ASSERT(offset % p_pool->element_size_with_padding == 0, "invalid element");
+    ASSERT(offset / p_pool->element_size_with_padding < p_pool->num_max_elements, "invalid element");
+
+    const uint32_t index = (uint32_t)(offset / p_pool->element_size_with_padding);
+
+    int64_t head = p_pool->head;
+    for (;;)
+    {
+        p_pool->pa_next_indices[index] = (uint32_t)head;
+
+        const int64_t prev_head = _InterlockedCompareExchange64(&p_pool->head, lockfree_memory_pool_make_head(head, index), head);
+        if (prev_head == head)
+        {
+            return;
+        }
+
+        head = prev_head;
+    }
+}
+
+FORCEINLINE size_t __stdcall lockfree_memory_pool_get_element_size(const lockfree_memory_pool_t* p_pool)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+    return p_pool->element_size;
+}
+
+FORCEINLINE size_t __stdcall lockfree_memory_pool_get_num_max_elements(const lockfree_memory_pool_t* p_pool)
+{
+    ASSERT(p_pool != NULL, "p_pool == NULL");
+    return p_pool->num_max_elements;
+}
+
+END_EXTERN_C
+
+#endif // LOCKFREE_MEMORY_POOL_H
\ No newline at end of file
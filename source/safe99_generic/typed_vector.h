@@ -0,0 +1,275 @@
+﻿//***************************************************************************
+// 
+// 파일: typed_vector.h
+// 
+// 설명: 타입이 정해진 벡터를 만드는 매크로
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// dynamic_vector_t, fixed_vector_t와 달리 원소 크기가 컴파일 타임 상수이므로
+// push/get이 memcpy 없이 일반 load/store로 컴파일됨
+// 
+// DECLARE_VECTOR(int32_vector, int32_t);
+// -> int32_vector_t, int32_vector_initialize(), int32_vector_push_back(), ...
+// 
+// DECLARE_FIXED_VECTOR(int32_fixed_vector, int32_t);
+// -> 용량이 고정된 버전 (확장 없음)
+// 
+//***************************************************************************
+
+#ifndef TYPED_VECTOR_H
+#define TYPED_VECTOR_H
+
+#include <memory.h>
+
+#include "safe99_common/defines.h"
+
+#define TYPED_VECTOR_GROWTH_FACTOR 2
+
+#define DECLARE_VECTOR(name, type)                                                                              \
+typedef struct name                                                                                             \
+{                                                                                                               \
+    type* pa_elements;                                                                                          \
+    size_t num_elements;                                                                                        \
+    size_t num_max_elements;                                                                                    \
+} name##_t;                                                                                                     \
+                                                                                                                \
+static bool __stdcall name##_resize_buffer(name##_t* p_vector, const size_t num_max_elements)                   \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(num_max_elements >= p_vector->num_elements, "num_max_elements < num_elements");                      \
+                                                                                                                \
+    type* pa_new_space = (type*)realloc(p_vector->pa_elements, sizeof(type) * num_max_elements);                \
+    if (pa_new_space == NULL)                                                                                   \
+    {                                                                                                           \
+        ASSERT(false, "Failed realloc new space");                                                              \
+        return false;                                                                                           \
+    }                                                                                                           \
+                                                                                                                \
+    p_vector->pa_elements = pa_new_space;                                                                       \
+    p_vector->num_max_elements = num_max_elements;                                                              \
+                                                                                                                \
+    return true;                                                                                                \
+}                                                                                                               \
+                                                                                                                \
+static bool __stdcall name##_expand(name##_t* p_vector, const size_t num_min_elements)                          \
+{                                                                                                               \
+    size_t num_max_elements = p_vector->num_max_elements * TYPED_VECTOR_GROWTH_FACTOR;                          \
+    if (num_max_elements < num_min_elements)                                                                    \
+    {                                                                                                           \
+        num_max_elements = num_min_elements;                                                                    \
+    }                                                                                                           \
+                                                                                                                \
+    return name##_resize_buffer(p_vector, num_max_elements);                                                    \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE bool __stdcall name##_initialize(name##_t* p_vector, const size_t num_max_elements)                 \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(num_max_elements > 0, "num_max_elements == 0");                                                      \
+                                                                                                                \
+    p_vector->num_elements = 0;                                                                                 \
+    p_vector->num_max_elements = num_max_elements;                                                              \
+    p_vector->pa_elements = (type*)malloc(sizeof(type) * num_max_elements);                                     \
+    if (p_vector->pa_elements == NULL)                                                                          \
+    {                                                                                                           \
+        ASSERT(false, "Failed to malloc elements");                                                             \
+        memset(p_vector, 0, sizeof(name##_t));                                                                  \
+        return false;                                                                                           \
+    }                                                                                                           \
+                                                                                                                \
+    return true;                                                                                                \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_release(name##_t* p_vector)                                                   \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+                                                                                                                \
+    SAFE_FREE(p_vector->pa_elements);                                                                           \
+    memset(p_vector, 0, sizeof(name##_t));                                                                      \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_clear(name##_t* p_vector)                                                     \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    p_vector->num_elements = 0;                                                                                 \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE bool __stdcall name##_reserve(name##_t* p_vector, const size_t num_max_elements)                    \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+                                                                                                                \
+    if (num_max_elements <= p_vector->num_max_elements)                                                         \
+    {                                                                                                           \
+        return true;                                                                                            \
+    }                                                                                                           \
+                                                                                                                \
+    return name##_resize_buffer(p_vector, num_max_elements);                                                    \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE bool __stdcall name##_push_back(name##_t* p_vector, const type element)                             \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+                                                                                                                \
+    if (p_vector->num_elements >= p_vector->num_max_elements                                                    \
+        && !name##_expand(p_vector, p_vector->num_elements + 1))                                                \
+    {                                                                                                           \
+        return false;                                                                                           \
+    }                                                                                                           \
+                                                                                                                \
+    p_vector->pa_elements[p_vector->num_elements++] = element;                                                  \
+                                                                                                                \
+    return true;                                                                                                \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE bool __stdcall name##_push_back_n(name##_t* p_vector, const type* p_elements, const size_t num_elements) \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(p_elements != NULL || num_elements == 0, "p_elements == NULL");                                      \
+                                                                                                                \
+    if (p_vector->num_elements + num_elements > p_vector->num_max_elements                                      \
+        && !name##_expand(p_vector, p_vector->num_elements + num_elements))                                     \
+    {                                                                                                           \
+        return false;                                                                                           \
+    }                                                                                                           \
+                                                                                                                \
+    memcpy(p_vector->pa_elements + p_vector->num_elements, p_elements, sizeof(type) * num_elements);            \
+    p_vector->num_elements += num_elements;                                                                     \
+                                                                                                                \
+    return true;                                                                                                \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_pop_back(name##_t* p_vector)                                                  \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(p_vector->num_elements > 0, "empty");                                                                \
+    --p_vector->num_elements;                                                                                   \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE type __stdcall name##_get(const name##_t* p_vector, const size_t index)                             \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(index < p_vector->num_elements, "invalid index");                                                    \
+    return p_vector->pa_elements[index];                                                                        \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_set(name##_t* p_vector, const size_t index, const type element)               \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(index < p_vector->num_elements, "invalid index");                                                    \
+    p_vector->pa_elements[index] = element;                                                                     \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE type* __stdcall name##_get_back_or_null(const name##_t* p_vector)                                   \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    return (p_vector->num_elements > 0) ? &p_vector->pa_elements[p_vector->num_elements - 1] : NULL;            \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE size_t __stdcall name##_get_num_elements(const name##_t* p_vector)                                  \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    return p_vector->num_elements;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE size_t __stdcall name##_get_num_max_elements(const name##_t* p_vector)                              \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    return p_vector->num_max_elements;                                                                          \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE type* __stdcall name##_get_elements_ptr_or_null(const name##_t* p_vector)                           \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    return p_vector->pa_elements;                                                                               \
+}
+
+#define DECLARE_FIXED_VECTOR(name, type)                                                                        \
+typedef struct name                                                                                             \
+{                                                                                                               \
+    type* pa_elements;                                                                                          \
+    size_t num_elements;                                                                                        \
+    size_t num_max_elements;                                                                                    \
+} name##_t;                                                                                                     \
+                                                                                                                \
+FORCEINLINE bool __stdcall name##_initialize(name##_t* p_vector, const size_t num_max_elements)                 \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(num_max_elements > 0, "num_max_elements == 0");                                                      \
+                                                                                                                \
+    p_vector->num_elements = 0;                                                                                 \
+    p_vector->num_max_elements = num_max_elements;                                                              \
+    p_vector->pa_elements = (type*)malloc(sizeof(type) * num_max_elements);                                     \
+    if (p_vector->pa_elements == NULL)                                                                          \
+    {                                                                                                           \
+        ASSERT(false, "Failed to malloc elements");                                                             \
+        memset(p_vector, 0, sizeof(name##_t));                                                                  \
+        return false;                                                                                           \
+    }                                                                                                           \
+                                                                                                                \
+    return true;                                                                                                \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_release(name##_t* p_vector)                                                   \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+                                                                                                                \
+    SAFE_FREE(p_vector->pa_elements);                                                                           \
+    memset(p_vector, 0, sizeof(name##_t));                                                                      \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_clear(name##_t* p_vector)                                                     \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    p_vector->num_elements = 0;                                                                                 \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_push_back(name##_t* p_vector, const type element)                             \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(p_vector->num_elements < p_vector->num_max_elements, "saturate");                                    \
+    p_vector->pa_elements[p_vector->num_elements++] = element;                                                  \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_pop_back(name##_t* p_vector)                                                  \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(p_vector->num_elements > 0, "empty");                                                                \
+    --p_vector->num_elements;                                                                                   \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE type __stdcall name##_get(const name##_t* p_vector, const size_t index)                             \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(index < p_vector->num_elements, "invalid index");                                                    \
+    return p_vector->pa_elements[index];                                                                        \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE void __stdcall name##_set(name##_t* p_vector, const size_t index, const type element)               \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    ASSERT(index < p_vector->num_elements, "invalid index");                                                    \
+    p_vector->pa_elements[index] = element;                                                                     \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE size_t __stdcall name##_get_num_elements(const name##_t* p_vector)                                  \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    return p_vector->num_elements;                                                                              \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE size_t __stdcall name##_get_num_max_elements(const name##_t* p_vector)                              \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    return p_vector->num_max_elements;                                                                          \
+}                                                                                                               \
+                                                                                                                \
+FORCEINLINE type* __stdcall name##_get_elements_ptr_or_null(const name##_t* p_vector)                           \
+{                                                                                                               \
+    ASSERT(p_vector != NULL, "p_vector == NULL");                                                               \
+    return p_vector->pa_elements;                                                                               \
+}
+
+#endif // TYPED_VECTOR_H
\ No newline at end of file
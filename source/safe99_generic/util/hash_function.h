@@ -8,11 +8,18 @@
 // 
 // 작성일: 2023/07/18
 // 
+// hash32_fnv1a/hash64_fnv1a: 한 바이트씩 처리, DLL
+// hash64_wyhash: 8바이트씩 처리하는 wyhash, 긴 키용
+// hash64_u32/hash64_u64: 4/8바이트 정수 키 전용 (곱셈 두 번으로 섞기만 함)
+// *_seed: 시드를 받는 버전 (HashDoS 방지용으로 실행마다 다른 시드 사용)
+// 
 //***************************************************************************
 
 #ifndef HASH_FUNCTION_H
 #define HASH_FUNCTION_H
 
+#include <memory.h>
+
 #include "safe99_common/defines.h"
 
 START_EXTERN_C
@@ -20,6 +27,152 @@ START_EXTERN_C
 SAFE99_API uint32_t __stdcall hash32_fnv1a(const char* bytes, const size_t size);
 SAFE99_API uint64_t __stdcall hash64_fnv1a(const char* bytes, const size_t size);
 
+#define HASH64_SECRET0 0x2d358dccaa6c78a5ull
+#define HASH64_SECRET1 0x8bb84b93962eacc9ull
+#define HASH64_SECRET2 0x4b33a62ed433d4a3ull
+#define HASH64_SECRET3 0x4d5a2da51de1aa47ull
+
+// 64x64 -> 128 곱셈, *p_a = 하위 64비트, *p_b = 상위 64비트
+FORCEINLINE void __stdcall hash64_multiply(uint64_t* p_a, uint64_t* p_b)
+{
+#if defined(_M_X64) || defined(_M_AMD64)
+    const uint64_t b = *p_b;
+    *p_a = _umul128(*p_a, b, p_b);
+#else
+    const uint64_t a_low = (uint32_t)*p_a;
+    const uint64_t a_high = *p_a >> 32;
+    const uint64_t b_low = (uint32_t)*p_b;
+    const uint64_t b_high = *p_b >> 32;
+
+    const uint64_t low_low = a_low * b_low;
+    const uint64_t low_high = a_low * b_high;
+    const uint64_t high_low = a_high * b_low;
+    const uint64_t high_high = a_high * b_high;
+
+    const uint64_t middle = (low_low >> 32) + (uint32_t)low_high + high_low;
+    *p_a = (middle << 32) | (uint32_t)low_low;
+    *p_b = high_high + (low_high >> 32) + (middle >> 32);
+#endif // _M_X64
+}
+
+// 128비트 곱의 상위/하위를 xor
+FORCEINLINE uint64_t __stdcall hash64_mix(uint64_t a, uint64_t b)
+{
+    hash64_multiply(&a, &b);
+    return a ^ b;
+}
+
+FORCEINLINE uint64_t __stdcall hash64_read8(const char* p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(uint64_t));
+    return value;
+}
+
+FORCEINLINE uint64_t __stdcall hash64_read4(const char* p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(uint32_t));
+    return value;
+}
+
+FORCEINLINE uint64_t __stdcall hash64_wyhash_seed(const char* bytes, const size_t size, uint64_t seed)
+{
+    ASSERT(bytes != NULL || size == 0, "bytes == NULL");
+
+    const char* p = bytes;
+    uint64_t a;
+    uint64_t b;
+
+    seed ^= hash64_mix(seed ^ HASH64_SECRET0, HASH64_SECRET1);
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            // 4 ~ 16바이트: 앞뒤에서 겹치게 4바이트씩 네 번 읽음
+            const size_t offset = (size >> 3) << 2;
+            a = (hash64_read4(p) << 32) | hash64_read4(p + offset);
+            b = (hash64_read4(p + size - 4) << 32) | hash64_read4(p + size - 4 - offset);
+        }
+        else if (size > 0)
+        {
+            a = ((uint64_t)(uint8_t)p[0] << 16) | ((uint64_t)(uint8_t)p[size >> 1] << 8) | (uint64_t)(uint8_t)p[size - 1];
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+    }
+    else
+    {
+        size_t remain = size;
+        if (remain >= 48)
+        {
+            // 독립된 세 줄기로 처리
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do
+            {
+                seed = hash64_mix(hash64_read8(p) ^ HASH64_SECRET1, hash64_read8(p + 8) ^ seed);
+                seed1 = hash64_mix(hash64_read8(p + 16) ^ HASH64_SECRET2, hash64_read8(p + 24) ^ seed1);
+                seed2 = hash64_mix(hash64_read8(p + 32) ^ HASH64_SECRET3, hash64_read8(p + 40) ^ seed2);
+                p += 48;
+                remain -= 48;
+            } while (remain >= 48);
+
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remain > 16)
+        {
+            seed = hash64_mix(hash64_read8(p) ^ HASH64_SECRET1, hash64_read8(p + 8) ^ seed);
+            p += 16;
+            remain -= 16;
+        }
+
+        // 마지막 16바이트 (앞 블록과 겹칠 수 있음)
+        a = hash64_read8(p + remain - 16);
+        b = hash64_read8(p + remain - 8);
+    }
+
+    a ^= HASH64_SECRET1;
+    b ^= seed;
+    hash64_multiply(&a, &b);
+
+    return hash64_mix(a ^ HASH64_SECRET0 ^ size, b ^ HASH64_SECRET1);
+}
+
+FORCEINLINE uint64_t __stdcall hash64_wyhash(const char* bytes, const size_t size)
+{
+    return hash64_wyhash_seed(bytes, size, 0);
+}
+
+// 곱셈 한 번으로는 연속된 키의 상위 비트가 고르게 퍼지지 않으므로 시드와 상수를 다시 섞어 한 번 더 곱함
+FORCEINLINE uint64_t __stdcall hash64_u64_seed(const uint64_t key, const uint64_t seed)
+{
+    const uint64_t mixed = hash64_mix(key ^ seed ^ HASH64_SECRET0, HASH64_SECRET1);
+    return hash64_mix(mixed ^ seed ^ HASH64_SECRET2, HASH64_SECRET3);
+}
+
+FORCEINLINE uint64_t __stdcall hash64_u64(const uint64_t key)
+{
+    return hash64_u64_seed(key, 0);
+}
+
+FORCEINLINE uint64_t __stdcall hash64_u32_seed(const uint32_t key, const uint64_t seed)
+{
+    // 상위 32비트에도 키를 복사해 곱셈 결과가 고르게 퍼지도록 함
+    return hash64_u64_seed((uint64_t)key << 32 | key, seed);
+}
+
+FORCEINLINE uint64_t __stdcall hash64_u32(const uint32_t key)
+{
+    return hash64_u32_seed(key, 0);
+}
+
 END_EXTERN_C
 
 #endif // HASH_FUNCTION_H
\ No newline at end of file
@@ -15,10 +15,21 @@
 
 #include "safe99_common/defines.h"
 
+typedef struct safe99_timer
+{
+    uint64_t frequency;
+    uint64_t prev_counter;
+} safe99_timer_t;
+
+// POSIX <time.h>의 timer_t와 겹치지 않도록 MSVC에서만 예전 이름을 남김
+#if defined(_MSC_VER)
+typedef safe99_timer_t timer_t;
+#endif // _MSC_VER
+
 START_EXTERN_C
 
-SAFE99_API bool __stdcall timer_init(timer_t* p_timer);
-SAFE99_API float __stdcall timer_get_time(const timer_t* p_timer);
+SAFE99_API bool __stdcall timer_init(safe99_timer_t* p_timer);
+SAFE99_API float __stdcall timer_get_time(const safe99_timer_t* p_timer);
 
 END_EXTERN_C
 
@@ -0,0 +1,313 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_allocators.c
+// 
+// 설명: 메모리 풀 할당/해제 순서별 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// n개를 모두 할당한 뒤 순서를 바꿔 해제
+// - LIFO: 할당의 역순 (스택)
+// - FIFO: 할당 순서 그대로 (큐)
+// - random: 섞인 순서
+// 모든 할당자를 같은 함수 포인터 테이블로 호출하므로 호출 비용은 동일하게 포함됨
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_generic/chunked_memory_pool.h"
+// concurrent_memory_pool_t는 chunked_memory_pool_t (safe99_generic DLL) 위에서 동작
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+#include "safe99_generic/concurrent_memory_pool.h"
+#endif // SAFE99_GENERIC_HEADER_ONLY
+#include "safe99_generic/lockfree_memory_pool.h"
+#include "safe99_generic/static_memory_pool.h"
+#include "bench_cases.h"
+
+#define ELEMENT_SIZE 32
+#define NUM_ELEMENTS_PER_CHUNK 1024
+
+typedef enum free_order
+{
+    FREE_ORDER_LIFO,
+    FREE_ORDER_FIFO,
+    FREE_ORDER_RANDOM,
+    FREE_ORDER_COUNT
+} free_order_t;
+
+typedef struct allocator_context allocator_context_t;
+
+typedef struct allocator
+{
+    const char* name;
+    bool (*pf_initialize)(allocator_context_t* p_allocator_context);
+    void (*pf_release)(allocator_context_t* p_allocator_context);
+    void* (*pf_alloc_or_null)(allocator_context_t* p_allocator_context);
+    void (*pf_dealloc)(allocator_context_t* p_allocator_context, void* p_element);
+} allocator_t;
+
+struct allocator_context
+{
+    const allocator_t* p_allocator;
+    size_t num_elements;
+
+    void** ppa_elements;
+    size_t* pa_free_order;
+
+    chunked_memory_pool_t chunked_pool;
+    static_memory_pool_t static_pool;
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    concurrent_memory_pool_t concurrent_pool;
+    concurrent_memory_pool_cache_t concurrent_pool_cache;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+    lockfree_memory_pool_t lockfree_pool;
+};
+
+static void run_alloc_free(void* p_context);
+
+static bool initialize_malloc(allocator_context_t* p_allocator_context);
+static void release_malloc(allocator_context_t* p_allocator_context);
+static void* alloc_malloc(allocator_context_t* p_allocator_context);
+static void dealloc_malloc(allocator_context_t* p_allocator_context, void* p_element);
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static bool initialize_chunked(allocator_context_t* p_allocator_context);
+static void release_chunked(allocator_context_t* p_allocator_context);
+static void* alloc_chunked(allocator_context_t* p_allocator_context);
+static void dealloc_chunked(allocator_context_t* p_allocator_context, void* p_element);
+static bool initialize_static(allocator_context_t* p_allocator_context);
+static void release_static(allocator_context_t* p_allocator_context);
+static void* alloc_static(allocator_context_t* p_allocator_context);
+static void dealloc_static(allocator_context_t* p_allocator_context, void* p_element);
+static bool initialize_concurrent(allocator_context_t* p_allocator_context);
+static void release_concurrent(allocator_context_t* p_allocator_context);
+static void* alloc_concurrent(allocator_context_t* p_allocator_context);
+static void dealloc_concurrent(allocator_context_t* p_allocator_context, void* p_element);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+static bool initialize_lockfree(allocator_context_t* p_allocator_context);
+static void release_lockfree(allocator_context_t* p_allocator_context);
+static void* alloc_lockfree(allocator_context_t* p_allocator_context);
+static void dealloc_lockfree(allocator_context_t* p_allocator_context, void* p_element);
+
+static const allocator_t s_allocators[] =
+{
+    { "malloc", initialize_malloc, release_malloc, alloc_malloc, dealloc_malloc },
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    { "chunked_memory_pool", initialize_chunked, release_chunked, alloc_chunked, dealloc_chunked },
+    { "static_memory_pool", initialize_static, release_static, alloc_static, dealloc_static },
+    { "concurrent_memory_pool", initialize_concurrent, release_concurrent, alloc_concurrent, dealloc_concurrent },
+#endif // SAFE99_GENERIC_HEADER_ONLY
+    { "lockfree_memory_pool", initialize_lockfree, release_lockfree, alloc_lockfree, dealloc_lockfree }
+};
+
+static const char* const s_free_order_names[FREE_ORDER_COUNT] = { "lifo", "fifo", "random" };
+
+static const size_t s_num_elements[] = { 1024, 65536, 1048576 };
+
+void run_allocator_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    for (size_t i = 0; i < sizeof(s_num_elements) / sizeof(s_num_elements[0]); ++i)
+    {
+        allocator_context_t* p_context = (allocator_context_t*)malloc(sizeof(allocator_context_t));
+        if (p_context == NULL)
+        {
+            ASSERT(false, "Failed to malloc context");
+            continue;
+        }
+
+        memset(p_context, 0, sizeof(allocator_context_t));
+        p_context->num_elements = s_num_elements[i];
+        p_context->ppa_elements = (void**)malloc(sizeof(void*) * p_context->num_elements);
+        p_context->pa_free_order = (size_t*)malloc(sizeof(size_t) * p_context->num_elements);
+        if (p_context->ppa_elements == NULL || p_context->pa_free_order == NULL)
+        {
+            ASSERT(false, "Failed to malloc context");
+            SAFE_FREE(p_context->ppa_elements);
+            SAFE_FREE(p_context->pa_free_order);
+            SAFE_FREE(p_context);
+            continue;
+        }
+
+        for (int order = 0; order < FREE_ORDER_COUNT; ++order)
+        {
+            // 해제 순서
+            for (size_t j = 0; j < p_context->num_elements; ++j)
+            {
+                p_context->pa_free_order[j] = (order == FREE_ORDER_LIFO) ? p_context->num_elements - 1 - j : j;
+            }
+
+            if (order == FREE_ORDER_RANDOM)
+            {
+                // xorshift64 + Fisher-Yates
+                uint64_t state = BENCH_SEED;
+                for (size_t j = p_context->num_elements - 1; j > 0; --j)
+                {
+                    state ^= state << 13;
+                    state ^= state >> 7;
+                    state ^= state << 17;
+
+                    const size_t swap_index = (size_t)(state % (j + 1));
+                    const size_t temp = p_context->pa_free_order[j];
+                    p_context->pa_free_order[j] = p_context->pa_free_order[swap_index];
+                    p_context->pa_free_order[swap_index] = temp;
+                }
+            }
+
+            for (size_t j = 0; j < sizeof(s_allocators) / sizeof(s_allocators[0]); ++j)
+            {
+                p_context->p_allocator = &s_allocators[j];
+                if (!p_context->p_allocator->pf_initialize(p_context))
+                {
+                    continue;
+                }
+
+                char params[128];
+                snprintf(params, sizeof(params), "\"allocator\": \"%s\", \"order\": \"%s\", \"n\": %zu",
+                         p_context->p_allocator->name, s_free_order_names[order], p_context->num_elements);
+
+                bench_run(p_bench, "alloc_free_pattern", params, NULL, run_alloc_free, p_context, p_context->num_elements, NULL);
+
+                p_context->p_allocator->pf_release(p_context);
+            }
+        }
+
+        free(p_context->ppa_elements);
+        free(p_context->pa_free_order);
+        free(p_context);
+    }
+}
+
+static void run_alloc_free(void* p_context)
+{
+    allocator_context_t* p_allocator_context = (allocator_context_t*)p_context;
+    const allocator_t* p_allocator = p_allocator_context->p_allocator;
+    void** ppa_elements = p_allocator_context->ppa_elements;
+
+    for (size_t i = 0; i < p_allocator_context->num_elements; ++i)
+    {
+        ppa_elements[i] = p_allocator->pf_alloc_or_null(p_allocator_context);
+    }
+
+    bench_do_not_optimize(ppa_elements);
+
+    for (size_t i = 0; i < p_allocator_context->num_elements; ++i)
+    {
+        p_allocator->pf_dealloc(p_allocator_context, ppa_elements[p_allocator_context->pa_free_order[i]]);
+    }
+}
+
+static bool initialize_malloc(allocator_context_t* p_allocator_context)
+{
+    return true;
+}
+
+static void release_malloc(allocator_context_t* p_allocator_context)
+{
+}
+
+static void* alloc_malloc(allocator_context_t* p_allocator_context)
+{
+    return malloc(ELEMENT_SIZE);
+}
+
+static void dealloc_malloc(allocator_context_t* p_allocator_context, void* p_element)
+{
+    free(p_element);
+}
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static bool initialize_chunked(allocator_context_t* p_allocator_context)
+{
+    return chunked_memory_pool_initialize(&p_allocator_context->chunked_pool, ELEMENT_SIZE, NUM_ELEMENTS_PER_CHUNK);
+}
+
+static void release_chunked(allocator_context_t* p_allocator_context)
+{
+    chunked_memory_pool_release(&p_allocator_context->chunked_pool);
+}
+
+static void* alloc_chunked(allocator_context_t* p_allocator_context)
+{
+    return chunked_memory_pool_alloc_or_null(&p_allocator_context->chunked_pool);
+}
+
+static void dealloc_chunked(allocator_context_t* p_allocator_context, void* p_element)
+{
+    chunked_memory_pool_dealloc(&p_allocator_context->chunked_pool, p_element);
+}
+
+static bool initialize_static(allocator_context_t* p_allocator_context)
+{
+    return static_memory_pool_initialize(&p_allocator_context->static_pool, ELEMENT_SIZE, NUM_ELEMENTS_PER_CHUNK,
+                                         (p_allocator_context->num_elements + NUM_ELEMENTS_PER_CHUNK - 1) / NUM_ELEMENTS_PER_CHUNK);
+}
+
+static void release_static(allocator_context_t* p_allocator_context)
+{
+    static_memory_pool_release(&p_allocator_context->static_pool);
+}
+
+static void* alloc_static(allocator_context_t* p_allocator_context)
+{
+    return static_memory_pool_alloc_or_null(&p_allocator_context->static_pool);
+}
+
+static void dealloc_static(allocator_context_t* p_allocator_context, void* p_element)
+{
+    static_memory_pool_dealloc(&p_allocator_context->static_pool, p_element);
+}
+
+// 스레드 하나의 캐시만 사용
+static bool initialize_concurrent(allocator_context_t* p_allocator_context)
+{
+    if (!concurrent_memory_pool_initialize(&p_allocator_context->concurrent_pool, ELEMENT_SIZE, NUM_ELEMENTS_PER_CHUNK))
+    {
+        return false;
+    }
+
+    concurrent_memory_pool_cache_initialize(&p_allocator_context->concurrent_pool_cache, &p_allocator_context->concurrent_pool);
+    return true;
+}
+
+static void release_concurrent(allocator_context_t* p_allocator_context)
+{
+    concurrent_memory_pool_cache_release(&p_allocator_context->concurrent_pool_cache);
+    concurrent_memory_pool_release(&p_allocator_context->concurrent_pool);
+}
+
+static void* alloc_concurrent(allocator_context_t* p_allocator_context)
+{
+    return concurrent_memory_pool_alloc_or_null(&p_allocator_context->concurrent_pool_cache);
+}
+
+static void dealloc_concurrent(allocator_context_t* p_allocator_context, void* p_element)
+{
+    concurrent_memory_pool_dealloc(&p_allocator_context->concurrent_pool_cache, p_element);
+}
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static bool initialize_lockfree(allocator_context_t* p_allocator_context)
+{
+    return lockfree_memory_pool_initialize(&p_allocator_context->lockfree_pool, ELEMENT_SIZE, p_allocator_context->num_elements);
+}
+
+static void release_lockfree(allocator_context_t* p_allocator_context)
+{
+    lockfree_memory_pool_release(&p_allocator_context->lockfree_pool);
+}
+
+static void* alloc_lockfree(allocator_context_t* p_allocator_context)
+{
+    return lockfree_memory_pool_alloc_or_null(&p_allocator_context->lockfree_pool);
+}
+
+static void dealloc_lockfree(allocator_context_t* p_allocator_context, void* p_element)
+{
+    lockfree_memory_pool_dealloc(&p_allocator_context->lockfree_pool, p_element);
+}
\ No newline at end of file
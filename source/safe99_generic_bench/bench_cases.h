@@ -0,0 +1,37 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_cases.h
+// 
+// 설명: safe99_generic 벤치마크 항목
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#ifndef BENCH_CASES_H
+#define BENCH_CASES_H
+
+#include "bench.h"
+
+START_EXTERN_C
+
+// 벡터 성장 전략, 타입 벡터, map_t와 flat_map_t, 메모리 풀 기본 비교
+void run_generic_benchmarks(bench_t* p_bench);
+
+// 순차/임의 삽입, 조회 적중/실패, 순회 (참조 구현과 비교)
+void run_container_benchmarks(bench_t* p_bench);
+
+// LIFO/FIFO/임의 순서 할당/해제 (malloc과 비교)
+void run_allocator_benchmarks(bench_t* p_bench);
+
+// 해시 함수 처리량과 분포 품질
+void run_hash_benchmarks(bench_t* p_bench);
+
+// 스레드 수에 따른 메모리 풀 처리량
+void run_pool_benchmarks(bench_t* p_bench);
+
+END_EXTERN_C
+
+#endif // BENCH_CASES_H
\ No newline at end of file
@@ -0,0 +1,532 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_containers.c
+// 
+// 설명: 컨테이너 삽입/조회/순회 패턴 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 각 패턴마다 참조 구현과 같이 측정
+// - 벡터: realloc으로 두 배씩 늘리는 배열
+// - 맵: flat_map_t
+// - 리스트: 원소마다 malloc하는 노드
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_generic/dynamic_vector.h"
+#include "safe99_generic/fixed_vector.h"
+#include "safe99_generic/flat_map.h"
+#include "safe99_generic/list.h"
+#include "safe99_generic/map.h"
+#include "bench_cases.h"
+
+// 임의 위치 삽입은 O(n^2)이므로 작은 크기만
+#define NUM_MAX_RANDOM_INSERT_ELEMENTS 65536
+
+typedef struct container_context
+{
+    size_t num_elements;
+
+    uint64_t* pa_keys;
+    uint64_t* pa_miss_keys;
+    uint64_t* pa_sequential_keys;
+
+    // 임의 위치 삽입 인덱스 (i번째 삽입은 [0, i] 범위)
+    size_t* pa_insert_indices;
+
+    const uint64_t* pa_insert_keys;
+
+    map_t map;
+    flat_map_t flat_map;
+
+    dynamic_vector_t vector;
+    list_t list;
+    list_node_t* pa_list_nodes;
+    uint64_t* pa_array;
+
+    uint64_t sum;
+} container_context_t;
+
+static void run_dynamic_vector_random_insert(void* p_context);
+static void run_fixed_vector_random_insert(void* p_context);
+static void run_array_random_insert(void* p_context);
+static void run_array_push_back(void* p_context);
+static void run_flat_map_insert_keys(void* p_context);
+static void run_flat_map_find_hit(void* p_context);
+static void run_flat_map_find_miss(void* p_context);
+static void run_dynamic_vector_iterate(void* p_context);
+static void run_array_iterate(void* p_context);
+static void run_flat_map_iterate(void* p_context);
+
+// map_t, list_t 참조 구현 (safe99_generic DLL 필요)
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void run_list_push_back(void* p_context);
+static void run_map_insert_keys(void* p_context);
+static void run_map_find_hit(void* p_context);
+static void run_map_find_miss(void* p_context);
+static void run_list_iterate(void* p_context);
+static void run_map_iterate(void* p_context);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static uint64_t* make_random_keys(const size_t num_keys, const uint64_t seed);
+
+static const size_t s_num_elements[] = { 1024, 65536, 1048576 };
+
+void run_container_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    for (size_t i = 0; i < sizeof(s_num_elements) / sizeof(s_num_elements[0]); ++i)
+    {
+        container_context_t context;
+        memset(&context, 0, sizeof(container_context_t));
+        context.num_elements = s_num_elements[i];
+
+        context.pa_keys = make_random_keys(context.num_elements, BENCH_SEED);
+        context.pa_miss_keys = make_random_keys(context.num_elements, ~(uint64_t)BENCH_SEED);
+        context.pa_sequential_keys = (uint64_t*)malloc(sizeof(uint64_t) * context.num_elements);
+        context.pa_insert_indices = (size_t*)malloc(sizeof(size_t) * context.num_elements);
+        if (context.pa_keys == NULL || context.pa_miss_keys == NULL
+            || context.pa_sequential_keys == NULL || context.pa_insert_indices == NULL)
+        {
+            ASSERT(false, "Failed to malloc context");
+            SAFE_FREE(context.pa_keys);
+            SAFE_FREE(context.pa_miss_keys);
+            SAFE_FREE(context.pa_sequential_keys);
+            SAFE_FREE(context.pa_insert_indices);
+            continue;
+        }
+
+        for (size_t j = 0; j < context.num_elements; ++j)
+        {
+            context.pa_sequential_keys[j] = (uint64_t)j;
+            context.pa_insert_indices[j] = (size_t)(context.pa_keys[j] % (j + 1));
+        }
+
+        char params[64];
+        snprintf(params, sizeof(params), "\"n\": %zu", context.num_elements);
+
+        // 삽입
+        bench_run(p_bench, "array_push_back", params, NULL, run_array_push_back, &context, context.num_elements, NULL);
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+        bench_run(p_bench, "list_push_back", params, NULL, run_list_push_back, &context, context.num_elements, NULL);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+        if (context.num_elements <= NUM_MAX_RANDOM_INSERT_ELEMENTS)
+        {
+            bench_run(p_bench, "dynamic_vector_random_insert", params, NULL, run_dynamic_vector_random_insert, &context, context.num_elements, NULL);
+            bench_run(p_bench, "fixed_vector_random_insert", params, NULL, run_fixed_vector_random_insert, &context, context.num_elements, NULL);
+            bench_run(p_bench, "array_random_insert", params, NULL, run_array_random_insert, &context, context.num_elements, NULL);
+        }
+
+        static const char* const s_key_orders[] = { "sequential", "random" };
+        for (size_t j = 0; j < 2; ++j)
+        {
+            context.pa_insert_keys = (j == 0) ? context.pa_sequential_keys : context.pa_keys;
+
+            char order_params[96];
+            snprintf(order_params, sizeof(order_params), "\"n\": %zu, \"keys\": \"%s\"", context.num_elements, s_key_orders[j]);
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+            bench_run(p_bench, "map_insert_pattern", order_params, NULL, run_map_insert_keys, &context, context.num_elements, NULL);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+            bench_run(p_bench, "flat_map_insert_pattern", order_params, NULL, run_flat_map_insert_keys, &context, context.num_elements, NULL);
+        }
+
+        // 조회 (적중/실패)
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+        if (map_initialize(&context.map, sizeof(uint64_t), sizeof(uint64_t), context.num_elements))
+        {
+            for (size_t j = 0; j < context.num_elements; ++j)
+            {
+                map_insert(&context.map, &context.pa_keys[j], sizeof(uint64_t), &context.pa_keys[j], sizeof(uint64_t));
+            }
+
+            bench_run(p_bench, "map_find_hit", params, NULL, run_map_find_hit, &context, context.num_elements, NULL);
+            bench_run(p_bench, "map_find_miss", params, NULL, run_map_find_miss, &context, context.num_elements, NULL);
+            bench_run(p_bench, "map_iterate", params, NULL, run_map_iterate, &context, context.num_elements, NULL);
+
+            map_release(&context.map);
+        }
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+        if (flat_map_initialize(&context.flat_map, sizeof(uint64_t), sizeof(uint64_t), context.num_elements))
+        {
+            for (size_t j = 0; j < context.num_elements; ++j)
+            {
+                flat_map_insert(&context.flat_map, &context.pa_keys[j], sizeof(uint64_t), &context.pa_keys[j], sizeof(uint64_t));
+            }
+
+            bench_run(p_bench, "flat_map_find_hit", params, NULL, run_flat_map_find_hit, &context, context.num_elements, NULL);
+            bench_run(p_bench, "flat_map_find_miss", params, NULL, run_flat_map_find_miss, &context, context.num_elements, NULL);
+            bench_run(p_bench, "flat_map_iterate", params, NULL, run_flat_map_iterate, &context, context.num_elements, NULL);
+
+            flat_map_release(&context.flat_map);
+        }
+
+        // 순회
+        if (dynamic_vector_initialize(&context.vector, sizeof(uint64_t), context.num_elements))
+        {
+            dynamic_vector_push_back_n(&context.vector, context.pa_keys, sizeof(uint64_t), context.num_elements);
+            bench_run(p_bench, "dynamic_vector_iterate", params, NULL, run_dynamic_vector_iterate, &context, context.num_elements, NULL);
+            dynamic_vector_release(&context.vector);
+        }
+
+        context.pa_array = (uint64_t*)malloc(sizeof(uint64_t) * context.num_elements);
+        if (context.pa_array != NULL)
+        {
+            memcpy(context.pa_array, context.pa_keys, sizeof(uint64_t) * context.num_elements);
+            bench_run(p_bench, "array_iterate", params, NULL, run_array_iterate, &context, context.num_elements, NULL);
+            SAFE_FREE(context.pa_array);
+        }
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+        // 노드를 섞인 순서로 연결해 실제 사용처럼 메모리상 위치가 흩어지게 함
+        context.pa_list_nodes = (list_node_t*)malloc(sizeof(list_node_t) * context.num_elements);
+        size_t* pa_node_order = (size_t*)malloc(sizeof(size_t) * context.num_elements);
+        if (context.pa_list_nodes != NULL && pa_node_order != NULL)
+        {
+            // Fisher-Yates (pa_insert_indices[j]는 [0, j] 범위)
+            for (size_t j = 0; j < context.num_elements; ++j)
+            {
+                pa_node_order[j] = j;
+            }
+            for (size_t j = context.num_elements - 1; j > 0; --j)
+            {
+                const size_t swap_index = context.pa_insert_indices[j];
+                const size_t temp = pa_node_order[j];
+                pa_node_order[j] = pa_node_order[swap_index];
+                pa_node_order[swap_index] = temp;
+            }
+
+            context.list.p_head = NULL;
+            context.list.p_tail = NULL;
+            for (size_t j = 0; j < context.num_elements; ++j)
+            {
+                list_node_t* p_node = &context.pa_list_nodes[pa_node_order[j]];
+                p_node->p_element = &context.pa_keys[j];
+                list_add_tail(&context.list.p_head, &context.list.p_tail, p_node);
+            }
+
+            bench_run(p_bench, "list_iterate", params, NULL, run_list_iterate, &context, context.num_elements, NULL);
+        }
+        SAFE_FREE(context.pa_list_nodes);
+        SAFE_FREE(pa_node_order);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+        free(context.pa_keys);
+        free(context.pa_miss_keys);
+        free(context.pa_sequential_keys);
+        free(context.pa_insert_indices);
+    }
+}
+
+static void run_dynamic_vector_random_insert(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    dynamic_vector_t vector;
+    if (!dynamic_vector_initialize(&vector, sizeof(uint64_t), 1))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        dynamic_vector_insert(&vector, &p_container_context->pa_keys[i], sizeof(uint64_t), p_container_context->pa_insert_indices[i]);
+    }
+
+    bench_do_not_optimize(dynamic_vector_get_elements_ptr_or_null(&vector));
+    dynamic_vector_release(&vector);
+}
+
+static void run_fixed_vector_random_insert(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    fixed_vector_t vector;
+    if (!fixed_vector_initialize(&vector, sizeof(uint64_t), p_container_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        fixed_vector_insert(&vector, &p_container_context->pa_keys[i], sizeof(uint64_t), p_container_context->pa_insert_indices[i]);
+    }
+
+    bench_do_not_optimize(fixed_vector_get_elements_ptr_or_null(&vector));
+    fixed_vector_release(&vector);
+}
+
+static void run_array_random_insert(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    uint64_t* pa_array = NULL;
+    size_t num_max_elements = 0;
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        if (i == num_max_elements)
+        {
+            num_max_elements = (num_max_elements == 0) ? 1 : num_max_elements * 2;
+            uint64_t* pa_new_array = (uint64_t*)realloc(pa_array, sizeof(uint64_t) * num_max_elements);
+            if (pa_new_array == NULL)
+            {
+                break;
+            }
+            pa_array = pa_new_array;
+        }
+
+        const size_t index = p_container_context->pa_insert_indices[i];
+        memmove(pa_array + index + 1, pa_array + index, sizeof(uint64_t) * (i - index));
+        pa_array[index] = p_container_context->pa_keys[i];
+    }
+
+    bench_do_not_optimize(pa_array);
+    free(pa_array);
+}
+
+static void run_array_push_back(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    uint64_t* pa_array = NULL;
+    size_t num_max_elements = 0;
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        if (i == num_max_elements)
+        {
+            num_max_elements = (num_max_elements == 0) ? 1 : num_max_elements * 2;
+            uint64_t* pa_new_array = (uint64_t*)realloc(pa_array, sizeof(uint64_t) * num_max_elements);
+            if (pa_new_array == NULL)
+            {
+                break;
+            }
+            pa_array = pa_new_array;
+        }
+
+        pa_array[i] = p_container_context->pa_keys[i];
+    }
+
+    bench_do_not_optimize(pa_array);
+    free(pa_array);
+}
+
+static void run_flat_map_insert_keys(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    flat_map_t map;
+    if (!flat_map_initialize(&map, sizeof(uint64_t), sizeof(uint64_t), p_container_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        flat_map_insert(&map, &p_container_context->pa_insert_keys[i], sizeof(uint64_t), &p_container_context->pa_insert_keys[i], sizeof(uint64_t));
+    }
+
+    bench_do_not_optimize(map.pa_slots);
+    flat_map_release(&map);
+}
+
+static void run_flat_map_find_hit(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        bench_do_not_optimize(flat_map_get_value_or_null(&p_container_context->flat_map, &p_container_context->pa_keys[i], sizeof(uint64_t)));
+    }
+}
+
+static void run_flat_map_find_miss(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        bench_do_not_optimize(flat_map_get_value_or_null(&p_container_context->flat_map, &p_container_context->pa_miss_keys[i], sizeof(uint64_t)));
+    }
+}
+
+static void run_dynamic_vector_iterate(void* p_context)
+{
+    container_context_t* p_container_context = (container_context_t*)p_context;
+
+    const uint64_t* p_elements = (const uint64_t*)dynamic_vector_get_elements_ptr_or_null(&p_container_context->vector);
+    const size_t num_elements = dynamic_vector_get_num_elements(&p_container_context->vector);
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        sum += p_elements[i];
+    }
+
+    p_container_context->sum = sum;
+    bench_do_not_optimize(&p_container_context->sum);
+}
+
+static void run_array_iterate(void* p_context)
+{
+    container_context_t* p_container_context = (container_context_t*)p_context;
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        sum += p_container_context->pa_array[i];
+    }
+
+    p_container_context->sum = sum;
+    bench_do_not_optimize(&p_container_context->sum);
+}
+
+static void run_flat_map_iterate(void* p_context)
+{
+    container_context_t* p_container_context = (container_context_t*)p_context;
+
+    const flat_map_t* p_map = &p_container_context->flat_map;
+    const size_t num_max_elements = flat_map_get_num_max_elements(p_map);
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < num_max_elements; ++i)
+    {
+        if (flat_map_is_occupied(p_map, i))
+        {
+            sum += *(const uint64_t*)flat_map_get_value_at(p_map, i);
+        }
+    }
+
+    p_container_context->sum = sum;
+    bench_do_not_optimize(&p_container_context->sum);
+}
+
+static uint64_t* make_random_keys(const size_t num_keys, const uint64_t seed)
+{
+    uint64_t* pa_keys = (uint64_t*)malloc(sizeof(uint64_t) * num_keys);
+    if (pa_keys == NULL)
+    {
+        return NULL;
+    }
+
+    // splitmix64
+    uint64_t state = seed;
+    for (size_t i = 0; i < num_keys; ++i)
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        pa_keys[i] = z ^ (z >> 31);
+    }
+
+    return pa_keys;
+}
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+// 원소마다 노드를 malloc하는 일반적인 연결 리스트 사용
+static void run_list_push_back(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    list_node_t* p_head = NULL;
+    list_node_t* p_tail = NULL;
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        list_node_t* p_node = (list_node_t*)malloc(sizeof(list_node_t));
+        if (p_node == NULL)
+        {
+            break;
+        }
+
+        p_node->p_element = &p_container_context->pa_keys[i];
+        list_add_tail(&p_head, &p_tail, p_node);
+    }
+
+    bench_do_not_optimize(p_tail);
+
+    while (p_head != NULL)
+    {
+        list_node_t* p_node = p_head;
+        list_delete_head(&p_head, &p_tail);
+        free(p_node);
+    }
+}
+
+static void run_map_insert_keys(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    map_t map;
+    if (!map_initialize(&map, sizeof(uint64_t), sizeof(uint64_t), p_container_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        map_insert(&map, &p_container_context->pa_insert_keys[i], sizeof(uint64_t), &p_container_context->pa_insert_keys[i], sizeof(uint64_t));
+    }
+
+    bench_do_not_optimize(map_get_key_values_ptr(&map));
+    map_release(&map);
+}
+
+static void run_map_find_hit(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        bench_do_not_optimize(map_get_value_or_null(&p_container_context->map, &p_container_context->pa_keys[i], sizeof(uint64_t)));
+    }
+}
+
+static void run_map_find_miss(void* p_context)
+{
+    const container_context_t* p_container_context = (const container_context_t*)p_context;
+
+    for (size_t i = 0; i < p_container_context->num_elements; ++i)
+    {
+        bench_do_not_optimize(map_get_value_or_null(&p_container_context->map, &p_container_context->pa_miss_keys[i], sizeof(uint64_t)));
+    }
+}
+
+static void run_list_iterate(void* p_context)
+{
+    container_context_t* p_container_context = (container_context_t*)p_context;
+
+    uint64_t sum = 0;
+    for (const list_node_t* p_node = p_container_context->list.p_head; p_node != NULL; p_node = p_node->p_next)
+    {
+        sum += *(const uint64_t*)p_node->p_element;
+    }
+
+    p_container_context->sum = sum;
+    bench_do_not_optimize(&p_container_context->sum);
+}
+
+static void run_map_iterate(void* p_context)
+{
+    container_context_t* p_container_context = (container_context_t*)p_context;
+
+    const key_value_t* p_key_values = map_get_key_values_ptr(&p_container_context->map);
+    const size_t num_elements = map_get_num_elements(&p_container_context->map);
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        sum += *(const uint64_t*)p_key_values[i].p_value;
+    }
+
+    p_container_context->sum = sum;
+    bench_do_not_optimize(&p_container_context->sum);
+}
+#endif // SAFE99_GENERIC_HEADER_ONLY
\ No newline at end of file
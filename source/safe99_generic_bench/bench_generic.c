@@ -0,0 +1,545 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_generic.c
+// 
+// 설명: safe99_generic 컨테이너 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_math/math_misc.h"
+#include "safe99_generic/dynamic_vector.h"
+#include "safe99_generic/fixed_vector.h"
+#include "safe99_generic/map.h"
+#include "safe99_generic/flat_map.h"
+#include "safe99_generic/chunked_memory_pool.h"
+#include "safe99_generic/static_memory_pool.h"
+#include "safe99_generic/typed_vector.h"
+#include "bench_cases.h"
+
+#define NUM_ELEMENTS_PER_CHUNK 1024
+#define NUM_ELEMENTS_PER_PUSH_BACK_N 64
+#define NUM_SMALL_VECTOR_ELEMENTS 4
+
+DECLARE_VECTOR(uint64_vector, uint64_t);
+DECLARE_FIXED_VECTOR(uint64_fixed_vector, uint64_t);
+
+typedef struct generic_context
+{
+    size_t num_elements;
+
+    // BENCH_SEED로 만든 키
+    uint64_t* pa_keys;
+    void** ppa_elements;
+
+    // dynamic_vector
+    float growth_factor;
+    size_t num_max_bytes;
+
+    // 읽기 벤치마크용으로 채워 둔 벡터
+    dynamic_vector_t filled_vector;
+    uint64_vector_t filled_typed_vector;
+    uint64_t sum;
+} generic_context_t;
+
+static void run_dynamic_vector_push_back(void* p_context);
+static void run_dynamic_vector_push_back_n(void* p_context);
+static void run_dynamic_vector_reserve_push_back(void* p_context);
+static void run_dynamic_vector_small(void* p_context);
+static void run_fixed_vector_push_back(void* p_context);
+static void run_typed_vector_push_back(void* p_context);
+static void run_typed_fixed_vector_push_back(void* p_context);
+static void run_dynamic_vector_sum(void* p_context);
+static void run_typed_vector_sum(void* p_context);
+static void run_map_benchmarks(bench_t* p_bench);
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void run_map_insert(void* p_context);
+static void run_map_find(void* p_context);
+static void setup_map_remove(void* p_context);
+static void run_map_remove(void* p_context);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+static void run_flat_map_insert(void* p_context);
+static void run_flat_map_find(void* p_context);
+static void setup_flat_map_remove(void* p_context);
+static void run_flat_map_remove(void* p_context);
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void run_chunked_memory_pool(void* p_context);
+static void run_static_memory_pool(void* p_context);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static uint64_t* make_keys(const size_t num_keys);
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static map_t s_map;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+static flat_map_t s_flat_map;
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static chunked_memory_pool_t s_chunked_pool;
+static static_memory_pool_t s_static_pool;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static const size_t s_num_elements[] = { 1024, 65536 };
+static const float s_growth_factors[] = { 1.5f, 2.0f };
+static const size_t s_map_num_elements[] = { 1024, 65536, 1048576, 10000000 };
+
+void run_generic_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    for (size_t i = 0; i < sizeof(s_num_elements) / sizeof(s_num_elements[0]); ++i)
+    {
+        generic_context_t context;
+        context.num_elements = s_num_elements[i];
+        context.pa_keys = make_keys(context.num_elements);
+        context.ppa_elements = (void**)malloc(sizeof(void*) * context.num_elements);
+        if (context.pa_keys == NULL || context.ppa_elements == NULL)
+        {
+            ASSERT(false, "Failed to malloc context");
+            SAFE_FREE(context.pa_keys);
+            SAFE_FREE(context.ppa_elements);
+            continue;
+        }
+
+        char params[128];
+        snprintf(params, sizeof(params), "\"n\": %zu", context.num_elements);
+
+        // 최대 메모리는 마지막 용량 (한 번 실행해서 구함)
+        for (size_t j = 0; j < sizeof(s_growth_factors) / sizeof(s_growth_factors[0]); ++j)
+        {
+            context.growth_factor = s_growth_factors[j];
+            run_dynamic_vector_push_back(&context);
+
+            char vector_params[128];
+            snprintf(vector_params, sizeof(vector_params), "\"n\": %zu, \"growth_factor\": %.1f, \"peak_bytes\": %zu",
+                     context.num_elements, context.growth_factor, context.num_max_bytes);
+
+            bench_run(p_bench, "dynamic_vector_push_back", vector_params, NULL, run_dynamic_vector_push_back, &context, context.num_elements, NULL);
+        }
+        context.growth_factor = DYNAMIC_VECTOR_DEFAULT_GROWTH_FACTOR;
+
+        bench_run(p_bench, "dynamic_vector_push_back_n", params, NULL, run_dynamic_vector_push_back_n, &context, context.num_elements, NULL);
+        bench_run(p_bench, "dynamic_vector_reserve_push_back", params, NULL, run_dynamic_vector_reserve_push_back, &context, context.num_elements, NULL);
+        bench_run(p_bench, "dynamic_vector_small", params, NULL, run_dynamic_vector_small, &context, context.num_elements, NULL);
+        bench_run(p_bench, "fixed_vector_push_back", params, NULL, run_fixed_vector_push_back, &context, context.num_elements, NULL);
+
+        // 타입이 정해진 벡터와 비교
+        bench_run(p_bench, "typed_vector_push_back", params, NULL, run_typed_vector_push_back, &context, context.num_elements, NULL);
+        bench_run(p_bench, "typed_fixed_vector_push_back", params, NULL, run_typed_fixed_vector_push_back, &context, context.num_elements, NULL);
+
+        if (dynamic_vector_initialize(&context.filled_vector, sizeof(uint64_t), context.num_elements))
+        {
+            if (uint64_vector_initialize(&context.filled_typed_vector, context.num_elements))
+            {
+                dynamic_vector_push_back_n(&context.filled_vector, context.pa_keys, sizeof(uint64_t), context.num_elements);
+                uint64_vector_push_back_n(&context.filled_typed_vector, context.pa_keys, context.num_elements);
+
+                bench_run(p_bench, "dynamic_vector_sum", params, NULL, run_dynamic_vector_sum, &context, context.num_elements, NULL);
+                bench_run(p_bench, "typed_vector_sum", params, NULL, run_typed_vector_sum, &context, context.num_elements, NULL);
+
+                uint64_vector_release(&context.filled_typed_vector);
+            }
+
+            dynamic_vector_release(&context.filled_vector);
+        }
+
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+        if (chunked_memory_pool_initialize(&s_chunked_pool, sizeof(uint64_t), NUM_ELEMENTS_PER_CHUNK))
+        {
+            bench_run(p_bench, "chunked_memory_pool_alloc_dealloc", params, NULL, run_chunked_memory_pool, &context, context.num_elements, NULL);
+            chunked_memory_pool_release(&s_chunked_pool);
+        }
+
+        if (static_memory_pool_initialize(&s_static_pool, sizeof(uint64_t), NUM_ELEMENTS_PER_CHUNK,
+                                          (context.num_elements + NUM_ELEMENTS_PER_CHUNK - 1) / NUM_ELEMENTS_PER_CHUNK))
+        {
+            bench_run(p_bench, "static_memory_pool_alloc_dealloc", params, NULL, run_static_memory_pool, &context, context.num_elements, NULL);
+            static_memory_pool_release(&s_static_pool);
+        }
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+        free(context.pa_keys);
+        free(context.ppa_elements);
+    }
+
+    run_map_benchmarks(p_bench);
+}
+
+// map_t와 flat_map_t 비교
+static void run_map_benchmarks(bench_t* p_bench)
+{
+    for (size_t i = 0; i < sizeof(s_map_num_elements) / sizeof(s_map_num_elements[0]); ++i)
+    {
+        generic_context_t context;
+        memset(&context, 0, sizeof(generic_context_t));
+        context.num_elements = s_map_num_elements[i];
+        context.pa_keys = make_keys(context.num_elements);
+        if (context.pa_keys == NULL)
+        {
+            ASSERT(false, "Failed to malloc keys");
+            continue;
+        }
+
+        char params[64];
+        snprintf(params, sizeof(params), "\"n\": %zu", context.num_elements);
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+        bench_run(p_bench, "map_insert", params, NULL, run_map_insert, &context, context.num_elements, NULL);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+        bench_run(p_bench, "flat_map_insert", params, NULL, run_flat_map_insert, &context, context.num_elements, NULL);
+
+        // 찾기/제거는 한 번 채운 맵을 재사용
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+        if (map_initialize(&s_map, sizeof(uint64_t), sizeof(uint64_t), context.num_elements))
+        {
+            setup_map_remove(&context);
+            bench_run(p_bench, "map_find", params, NULL, run_map_find, &context, context.num_elements, NULL);
+            bench_run(p_bench, "map_remove", params, setup_map_remove, run_map_remove, &context, context.num_elements, NULL);
+
+            map_release(&s_map);
+        }
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+        if (flat_map_initialize(&s_flat_map, sizeof(uint64_t), sizeof(uint64_t), context.num_elements))
+        {
+            setup_flat_map_remove(&context);
+            bench_run(p_bench, "flat_map_find", params, NULL, run_flat_map_find, &context, context.num_elements, NULL);
+            bench_run(p_bench, "flat_map_remove", params, setup_flat_map_remove, run_flat_map_remove, &context, context.num_elements, NULL);
+
+            flat_map_release(&s_flat_map);
+        }
+
+        free(context.pa_keys);
+    }
+}
+
+static uint64_t* make_keys(const size_t num_keys)
+{
+    uint64_t* pa_keys = (uint64_t*)malloc(sizeof(uint64_t) * num_keys);
+    if (pa_keys == NULL)
+    {
+        return NULL;
+    }
+
+    // splitmix64
+    uint64_t state = BENCH_SEED;
+    for (size_t i = 0; i < num_keys; ++i)
+    {
+        uint64_t z = (state += 0x9e3779b97f4a7c15ull);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        pa_keys[i] = z ^ (z >> 31);
+    }
+
+    return pa_keys;
+}
+
+static void run_dynamic_vector_push_back(void* p_context)
+{
+    generic_context_t* p_generic_context = (generic_context_t*)p_context;
+
+    // 확장 비용까지 포함하도록 작은 크기에서 시작
+    dynamic_vector_t vector;
+    if (!dynamic_vector_initialize(&vector, sizeof(uint64_t), 16))
+    {
+        return;
+    }
+
+    dynamic_vector_set_growth_factor(&vector, p_generic_context->growth_factor);
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        dynamic_vector_push_back(&vector, &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+
+    p_generic_context->num_max_bytes = dynamic_vector_get_num_max_elements(&vector) * sizeof(uint64_t);
+
+    bench_do_not_optimize(dynamic_vector_get_elements_ptr_or_null(&vector));
+    dynamic_vector_release(&vector);
+}
+
+static void run_dynamic_vector_push_back_n(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    dynamic_vector_t vector;
+    if (!dynamic_vector_initialize(&vector, sizeof(uint64_t), 16))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; i += NUM_ELEMENTS_PER_PUSH_BACK_N)
+    {
+        const size_t num_elements = MIN(NUM_ELEMENTS_PER_PUSH_BACK_N, p_generic_context->num_elements - i);
+        dynamic_vector_push_back_n(&vector, &p_generic_context->pa_keys[i], sizeof(uint64_t), num_elements);
+    }
+
+    bench_do_not_optimize(dynamic_vector_get_elements_ptr_or_null(&vector));
+    dynamic_vector_release(&vector);
+}
+
+static void run_dynamic_vector_reserve_push_back(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    dynamic_vector_t vector;
+    if (!dynamic_vector_initialize(&vector, sizeof(uint64_t), 16)
+        || !dynamic_vector_reserve(&vector, p_generic_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        dynamic_vector_push_back(&vector, &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+
+    bench_do_not_optimize(dynamic_vector_get_elements_ptr_or_null(&vector));
+    dynamic_vector_release(&vector);
+}
+
+static void run_dynamic_vector_small(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    // 원소 몇 개짜리 벡터를 반복해서 만들고 버림 (내부 버퍼 사용)
+    for (size_t i = 0; i + NUM_SMALL_VECTOR_ELEMENTS <= p_generic_context->num_elements; i += NUM_SMALL_VECTOR_ELEMENTS)
+    {
+        dynamic_vector_t vector;
+        if (!dynamic_vector_initialize(&vector, sizeof(uint64_t), NUM_SMALL_VECTOR_ELEMENTS))
+        {
+            return;
+        }
+
+        dynamic_vector_push_back_n(&vector, &p_generic_context->pa_keys[i], sizeof(uint64_t), NUM_SMALL_VECTOR_ELEMENTS);
+
+        bench_do_not_optimize(dynamic_vector_get_elements_ptr_or_null(&vector));
+        dynamic_vector_release(&vector);
+    }
+}
+
+static void run_fixed_vector_push_back(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    fixed_vector_t vector;
+    if (!fixed_vector_initialize(&vector, sizeof(uint64_t), p_generic_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        fixed_vector_push_back(&vector, &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+
+    bench_do_not_optimize(fixed_vector_get_elements_ptr_or_null(&vector));
+    fixed_vector_release(&vector);
+}
+
+static void run_typed_vector_push_back(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    uint64_vector_t vector;
+    if (!uint64_vector_initialize(&vector, 16))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        uint64_vector_push_back(&vector, p_generic_context->pa_keys[i]);
+    }
+
+    bench_do_not_optimize(uint64_vector_get_elements_ptr_or_null(&vector));
+    uint64_vector_release(&vector);
+}
+
+static void run_typed_fixed_vector_push_back(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    uint64_fixed_vector_t vector;
+    if (!uint64_fixed_vector_initialize(&vector, p_generic_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        uint64_fixed_vector_push_back(&vector, p_generic_context->pa_keys[i]);
+    }
+
+    bench_do_not_optimize(uint64_fixed_vector_get_elements_ptr_or_null(&vector));
+    uint64_fixed_vector_release(&vector);
+}
+
+static void run_dynamic_vector_sum(void* p_context)
+{
+    generic_context_t* p_generic_context = (generic_context_t*)p_context;
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        sum += *(const uint64_t*)dynamic_vector_get_element_or_null(&p_generic_context->filled_vector, i);
+    }
+
+    p_generic_context->sum = sum;
+    bench_do_not_optimize(&p_generic_context->sum);
+}
+
+static void run_typed_vector_sum(void* p_context)
+{
+    generic_context_t* p_generic_context = (generic_context_t*)p_context;
+
+    uint64_t sum = 0;
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        sum += uint64_vector_get(&p_generic_context->filled_typed_vector, i);
+    }
+
+    p_generic_context->sum = sum;
+    bench_do_not_optimize(&p_generic_context->sum);
+}
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void run_map_insert(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    map_t map;
+    if (!map_initialize(&map, sizeof(uint64_t), sizeof(uint64_t), p_generic_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        map_insert(&map, &p_generic_context->pa_keys[i], sizeof(uint64_t), &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+
+    bench_do_not_optimize(map_get_key_values_ptr(&map));
+    map_release(&map);
+}
+
+static void run_map_find(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        bench_do_not_optimize(map_find_or_null(&s_map, &p_generic_context->pa_keys[i], sizeof(uint64_t)));
+    }
+}
+
+static void setup_map_remove(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    map_clear(&s_map);
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        map_insert(&s_map, &p_generic_context->pa_keys[i], sizeof(uint64_t), &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+}
+
+static void run_map_remove(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        map_remove(&s_map, &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+}
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static void run_flat_map_insert(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    flat_map_t map;
+    if (!flat_map_initialize(&map, sizeof(uint64_t), sizeof(uint64_t), p_generic_context->num_elements))
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        flat_map_insert(&map, &p_generic_context->pa_keys[i], sizeof(uint64_t), &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+
+    bench_do_not_optimize(map.pa_slots);
+    flat_map_release(&map);
+}
+
+static void run_flat_map_find(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        bench_do_not_optimize(flat_map_get_value_or_null(&s_flat_map, &p_generic_context->pa_keys[i], sizeof(uint64_t)));
+    }
+}
+
+static void setup_flat_map_remove(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    flat_map_clear(&s_flat_map);
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        flat_map_insert(&s_flat_map, &p_generic_context->pa_keys[i], sizeof(uint64_t), &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+}
+
+static void run_flat_map_remove(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        flat_map_remove(&s_flat_map, &p_generic_context->pa_keys[i], sizeof(uint64_t));
+    }
+}
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void run_chunked_memory_pool(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        p_generic_context->ppa_elements[i] = chunked_memory_pool_alloc_or_null(&s_chunked_pool);
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        chunked_memory_pool_dealloc(&s_chunked_pool, p_generic_context->ppa_elements[i]);
+    }
+}
+
+static void run_static_memory_pool(void* p_context)
+{
+    const generic_context_t* p_generic_context = (const generic_context_t*)p_context;
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        p_generic_context->ppa_elements[i] = static_memory_pool_alloc_or_null(&s_static_pool);
+    }
+
+    for (size_t i = 0; i < p_generic_context->num_elements; ++i)
+    {
+        static_memory_pool_dealloc(&s_static_pool, p_generic_context->ppa_elements[i]);
+    }
+}
+#endif // SAFE99_GENERIC_HEADER_ONLY
\ No newline at end of file
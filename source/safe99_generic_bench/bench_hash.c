@@ -0,0 +1,271 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_hash.c
+// 
+// 설명: 해시 함수 처리량/분포 품질 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_generic/util/hash_function.h"
+#include "bench_cases.h"
+
+#define BUFFER_SIZE ((size_t)1 << 20)
+#define NUM_HASHES_PER_RUN 256
+
+// 분포 품질
+#define NUM_QUALITY_KEYS ((size_t)1 << 20)
+#define NUM_QUALITY_BUCKETS ((size_t)1 << 16)
+#define NUM_AVALANCHE_KEYS 10000
+
+// 이 기준을 넘으면 실패로 기록
+// 균일한 해시의 z-score는 표준 정규 분포, 편차는 키 10000개 기준 표준편차 0.005의 4096개 중 최대값
+#define MAX_QUALITY_ABS_Z_SCORE 4.0
+#define MAX_QUALITY_AVALANCHE_BIAS 0.05
+
+typedef uint64_t (__stdcall *hash64_func)(const char* bytes, const size_t size);
+
+typedef struct hash_entry
+{
+    const char* name;
+    hash64_func pf_hash;
+
+    // 0이면 모든 크기
+    size_t fixed_size;
+
+    // false면 분포 품질을 기록만 하고 기준 검사는 하지 않음
+    bool b_check_quality;
+} hash_entry_t;
+
+typedef struct hash_context
+{
+    hash64_func pf_hash;
+    const char* p_buffer;
+    size_t size;
+    uint64_t result;
+} hash_context_t;
+
+static uint64_t __stdcall hash64_u32_bytes(const char* bytes, const size_t size);
+static uint64_t __stdcall hash64_u64_bytes(const char* bytes, const size_t size);
+
+static void run_hash(void* p_context);
+
+static double get_bucket_z_score(const hash_entry_t* p_entry, const size_t key_size, const uint32_t shift, uint32_t* pa_buckets);
+static double get_avalanche_bias(const hash_entry_t* p_entry, const size_t key_size);
+
+static const hash_entry_t s_hashes[] =
+{
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    // map_t가 쓰는 기존 해시, 바이트 단위라 애벌랜치가 약한 것을 알고 있으므로 비교용으로만 기록
+    { "fnv1a", hash64_fnv1a, 0, false },
+#endif // SAFE99_GENERIC_HEADER_ONLY
+    { "wyhash", hash64_wyhash, 0, true },
+    { "u32", hash64_u32_bytes, sizeof(uint32_t), true },
+    { "u64", hash64_u64_bytes, sizeof(uint64_t), true }
+};
+
+static const size_t s_sizes[] = { 4, 8, 16, 64, 256, 4096, BUFFER_SIZE };
+
+void run_hash_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    char* pa_buffer = (char*)malloc(BUFFER_SIZE + NUM_HASHES_PER_RUN);
+    uint32_t* pa_buckets = (uint32_t*)malloc(sizeof(uint32_t) * NUM_QUALITY_BUCKETS);
+    if (pa_buffer == NULL || pa_buckets == NULL)
+    {
+        ASSERT(false, "Failed to malloc buffer");
+        goto exit;
+    }
+
+    srand(BENCH_SEED);
+    for (size_t i = 0; i < BUFFER_SIZE + NUM_HASHES_PER_RUN; ++i)
+    {
+        pa_buffer[i] = (char)rand();
+    }
+
+    // 처리량: ops = 바이트 수
+    for (size_t i = 0; i < sizeof(s_hashes) / sizeof(s_hashes[0]); ++i)
+    {
+        const hash_entry_t* p_entry = &s_hashes[i];
+
+        for (size_t j = 0; j < sizeof(s_sizes) / sizeof(s_sizes[0]); ++j)
+        {
+            if (p_entry->fixed_size != 0 && p_entry->fixed_size != s_sizes[j])
+            {
+                continue;
+            }
+
+            hash_context_t context;
+            context.pf_hash = p_entry->pf_hash;
+            context.p_buffer = pa_buffer;
+            context.size = s_sizes[j];
+            context.result = 0;
+
+            char params[128];
+            snprintf(params, sizeof(params), "\"hash\": \"%s\", \"size\": %zu", p_entry->name, s_sizes[j]);
+
+            const size_t num_hashes = (s_sizes[j] >= BUFFER_SIZE) ? 1 : NUM_HASHES_PER_RUN;
+
+            bench_result_t result;
+            if (!bench_run(p_bench, "hash_throughput", params, NULL, run_hash, &context, s_sizes[j] * num_hashes, &result))
+            {
+                continue;
+            }
+
+            // ns/byte -> GB/s
+            char metrics[64];
+            snprintf(metrics, sizeof(metrics), "\"gb_per_s\": %.3f", (result.ns_per_op > 0.0) ? 1.0 / result.ns_per_op : 0.0);
+            bench_report(p_bench, "hash_throughput_gbps", params, metrics);
+        }
+    }
+
+    // 분포 품질
+    // - 연속된 정수 키의 하위/상위 16비트 버킷 카이제곱 (z-score, |z| < 3 정도면 균일)
+    // - 입력 비트 하나를 바꿨을 때 출력 비트가 바뀔 확률의 0.5에서 최대 편차 (작을수록 좋음)
+    for (size_t i = 0; i < sizeof(s_hashes) / sizeof(s_hashes[0]); ++i)
+    {
+        const hash_entry_t* p_entry = &s_hashes[i];
+        const size_t key_size = (p_entry->fixed_size != 0) ? p_entry->fixed_size : sizeof(uint64_t);
+
+        char params[128];
+        snprintf(params, sizeof(params), "\"hash\": \"%s\", \"key_size\": %zu, \"keys\": %zu, \"buckets\": %zu",
+                 p_entry->name, key_size, NUM_QUALITY_KEYS, NUM_QUALITY_BUCKETS);
+
+        const double low_bits_z = get_bucket_z_score(p_entry, key_size, 0, pa_buckets);
+        const double high_bits_z = get_bucket_z_score(p_entry, key_size, 48, pa_buckets);
+        const double avalanche_bias = get_avalanche_bias(p_entry, key_size);
+        const bool b_pass = fabs(low_bits_z) < MAX_QUALITY_ABS_Z_SCORE
+                            && fabs(high_bits_z) < MAX_QUALITY_ABS_Z_SCORE
+                            && avalanche_bias < MAX_QUALITY_AVALANCHE_BIAS;
+
+        char metrics[160];
+        snprintf(metrics, sizeof(metrics), "\"low_bits_z\": %.2f, \"high_bits_z\": %.2f, \"avalanche_max_bias\": %.4f, \"pass\": %s",
+                 low_bits_z, high_bits_z, avalanche_bias, b_pass ? "true" : "false");
+
+        if (!bench_report(p_bench, "hash_quality", params, metrics) || !p_entry->b_check_quality || b_pass)
+        {
+            continue;
+        }
+
+        fprintf(stderr, "hash_quality %s: |z| must be < %.1f and avalanche bias < %.2f (low z %.2f, high z %.2f, bias %.4f)\n",
+                p_entry->name, MAX_QUALITY_ABS_Z_SCORE, MAX_QUALITY_AVALANCHE_BIAS, low_bits_z, high_bits_z, avalanche_bias);
+        ++p_bench->num_failures;
+    }
+
+exit:
+    SAFE_FREE(pa_buffer);
+    SAFE_FREE(pa_buckets);
+}
+
+static uint64_t __stdcall hash64_u32_bytes(const char* bytes, const size_t size)
+{
+    (void)size;
+
+    uint32_t key;
+    memcpy(&key, bytes, sizeof(uint32_t));
+    return hash64_u32(key);
+}
+
+static uint64_t __stdcall hash64_u64_bytes(const char* bytes, const size_t size)
+{
+    (void)size;
+
+    uint64_t key;
+    memcpy(&key, bytes, sizeof(uint64_t));
+    return hash64_u64(key);
+}
+
+static void run_hash(void* p_context)
+{
+    hash_context_t* p_hash_context = (hash_context_t*)p_context;
+
+    if (p_hash_context->size >= BUFFER_SIZE)
+    {
+        p_hash_context->result ^= p_hash_context->pf_hash(p_hash_context->p_buffer, p_hash_context->size);
+    }
+    else
+    {
+        // 시작 위치를 바꿔 가며 정렬되지 않은 읽기도 포함
+        for (size_t i = 0; i < NUM_HASHES_PER_RUN; ++i)
+        {
+            p_hash_context->result ^= p_hash_context->pf_hash(p_hash_context->p_buffer + i, p_hash_context->size);
+        }
+    }
+
+    bench_do_not_optimize(&p_hash_context->result);
+}
+
+static double get_bucket_z_score(const hash_entry_t* p_entry, const size_t key_size, const uint32_t shift, uint32_t* pa_buckets)
+{
+    memset(pa_buckets, 0, sizeof(uint32_t) * NUM_QUALITY_BUCKETS);
+
+    for (size_t i = 0; i < NUM_QUALITY_KEYS; ++i)
+    {
+        const uint64_t key = (uint64_t)i;
+        const uint64_t hash = p_entry->pf_hash((const char*)&key, key_size);
+        ++pa_buckets[(hash >> shift) & (NUM_QUALITY_BUCKETS - 1)];
+    }
+
+    const double expected = (double)NUM_QUALITY_KEYS / (double)NUM_QUALITY_BUCKETS;
+    double chi_square = 0.0;
+    for (size_t i = 0; i < NUM_QUALITY_BUCKETS; ++i)
+    {
+        const double difference = (double)pa_buckets[i] - expected;
+        chi_square += difference * difference / expected;
+    }
+
+    // 자유도 k인 카이제곱 분포는 평균 k, 분산 2k
+    const double degrees_of_freedom = (double)(NUM_QUALITY_BUCKETS - 1);
+    return (chi_square - degrees_of_freedom) / sqrt(2.0 * degrees_of_freedom);
+}
+
+static double get_avalanche_bias(const hash_entry_t* p_entry, const size_t key_size)
+{
+    static uint32_t s_flip_counts[64][64];
+    memset(s_flip_counts, 0, sizeof(s_flip_counts));
+
+    const size_t num_input_bits = key_size * 8;
+
+    // splitmix64
+    uint64_t state = BENCH_SEED;
+    for (size_t i = 0; i < NUM_AVALANCHE_KEYS; ++i)
+    {
+        uint64_t key = (state += 0x9e3779b97f4a7c15ull);
+        key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+        key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+        key ^= key >> 31;
+
+        const uint64_t hash = p_entry->pf_hash((const char*)&key, key_size);
+        for (size_t bit = 0; bit < num_input_bits; ++bit)
+        {
+            const uint64_t flipped_key = key ^ ((uint64_t)1 << bit);
+            const uint64_t difference = hash ^ p_entry->pf_hash((const char*)&flipped_key, key_size);
+            for (size_t out_bit = 0; out_bit < 64; ++out_bit)
+            {
+                s_flip_counts[bit][out_bit] += (uint32_t)((difference >> out_bit) & 1);
+            }
+        }
+    }
+
+    double max_bias = 0.0;
+    for (size_t bit = 0; bit < num_input_bits; ++bit)
+    {
+        for (size_t out_bit = 0; out_bit < 64; ++out_bit)
+        {
+            const double probability = (double)s_flip_counts[bit][out_bit] / (double)NUM_AVALANCHE_KEYS;
+            const double bias = (probability >= 0.5) ? probability - 0.5 : 0.5 - probability;
+            max_bias = (bias > max_bias) ? bias : max_bias;
+        }
+    }
+
+    return max_bias;
+}
\ No newline at end of file
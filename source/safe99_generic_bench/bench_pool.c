@@ -0,0 +1,869 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_pool.c
+// 
+// 설명: 멀티스레드 메모리 풀 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include "safe99_math/math_misc.h"
+#include "safe99_generic/chunked_memory_pool.h"
+// concurrent_memory_pool_t는 chunked_memory_pool_t (safe99_generic DLL) 위에서 동작
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+#include "safe99_generic/concurrent_memory_pool.h"
+#endif // SAFE99_GENERIC_HEADER_ONLY
+#include "safe99_generic/lockfree_memory_pool.h"
+#include "safe99_generic/static_memory_pool.h"
+#include "bench_cases.h"
+
+#define ELEMENT_SIZE 32
+#define NUM_ELEMENTS_PER_CHUNK 1024
+
+// 스레드마다 NUM_BATCH_ELEMENTS개를 할당한 뒤 모두 해제하는 것을 반복
+#define NUM_OPS_PER_THREAD ((size_t)1 << 20)
+#define NUM_BATCH_ELEMENTS 256
+#define NUM_MAX_THREADS 16
+
+// 스트레스 테스트: 용량을 스레드 수 * 배치 크기보다 작게 잡아 고갈 상황도 포함
+#define NUM_STRESS_THREADS 8
+#define NUM_STRESS_ROUNDS 100000
+#define NUM_STRESS_MAX_ELEMENTS 256
+#define NUM_STRESS_MAX_BATCH_ELEMENTS 64
+
+// 생산자/소비자 테스트: 짝마다 생산자 스레드가 할당하고 소비자 스레드가 해제
+// 해제된 원소는 다른 스레드의 반환 스택을 거쳐 생산자 캐시로 돌아감
+#define NUM_HANDOFF_MAX_PAIRS 4
+#define NUM_HANDOFF_OPS_PER_PAIR ((size_t)1 << 20)
+#define NUM_HANDOFF_QUEUE_ELEMENTS 1024
+
+// 원소 [0], [1]은 해제된 동안 풀의 연결 포인터로 쓰이므로 [2], [3]에 기록
+#define HANDOFF_STATE_INDEX 2
+#define HANDOFF_STAMP_INDEX 3
+#define HANDOFF_STATE_LIVE 0x4c4956454c495645ull
+#define HANDOFF_STATE_FREED 0x4652454546524545ull
+
+// 스레드와 잠금 (Linux에서도 빌드되도록 pthread로 대신함)
+#if defined(_WIN32)
+typedef HANDLE thread_t;
+typedef CRITICAL_SECTION lock_t;
+#define THREAD_FUNC(name) DWORD WINAPI name(void* p_param)
+#define THREAD_RETURN 0
+typedef LPTHREAD_START_ROUTINE thread_func;
+#else
+typedef pthread_t thread_t;
+typedef pthread_mutex_t lock_t;
+#define THREAD_FUNC(name) void* name(void* p_param)
+#define THREAD_RETURN NULL
+typedef void* (*thread_func)(void*);
+#endif // _WIN32
+
+typedef enum pool_kind
+{
+    POOL_KIND_CHUNKED,
+    POOL_KIND_LOCKED_CHUNKED,
+    POOL_KIND_CONCURRENT,
+    POOL_KIND_STATIC,
+    POOL_KIND_LOCKFREE
+} pool_kind_t;
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+// 생산자 -> 소비자 원형 큐, 모든 멤버는 lock으로 보호
+typedef struct handoff_queue
+{
+    lock_t lock;
+    void* a_elements[NUM_HANDOFF_QUEUE_ELEMENTS];
+    size_t head;
+    size_t num_elements;
+} handoff_queue_t;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+typedef struct pool_thread_context
+{
+    struct pool_context* p_pool_context;
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    concurrent_memory_pool_cache_t cache;
+
+    // 생산자/소비자 테스트, 짝이 같은 큐를 가리킴
+    handoff_queue_t* p_queue;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+    void* pa_elements[NUM_BATCH_ELEMENTS];
+
+    // 스트레스 테스트
+    uint32_t thread_index;
+    size_t num_violations;
+    size_t num_exhausted;
+} pool_thread_context_t;
+
+typedef struct pool_context
+{
+    pool_kind_t kind;
+    size_t num_threads;
+
+    chunked_memory_pool_t chunked_pool;
+    lock_t chunked_pool_lock;
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    concurrent_memory_pool_t concurrent_pool;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+    static_memory_pool_t static_pool;
+    lockfree_memory_pool_t lockfree_pool;
+
+    pool_thread_context_t* pa_threads;
+} pool_context_t;
+
+static void run_pool(void* p_context);
+static THREAD_FUNC(run_pool_thread);
+static void run_lockfree_pool_stress(bench_t* p_bench, pool_context_t* p_pool_context);
+static THREAD_FUNC(run_lockfree_pool_stress_thread);
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void run_concurrent_pool_handoff(bench_t* p_bench, pool_context_t* p_pool_context, const size_t num_pairs);
+static THREAD_FUNC(run_concurrent_pool_producer_thread);
+static THREAD_FUNC(run_concurrent_pool_consumer_thread);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static bool create_thread(thread_t* p_out_thread, thread_func pf_thread, void* p_param);
+static void join_threads(thread_t* pa_threads, const size_t num_threads);
+static size_t get_num_processors(void);
+static void lock_init(lock_t* p_lock);
+static void lock_delete(lock_t* p_lock);
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void lock_enter(lock_t* p_lock);
+static void lock_leave(lock_t* p_lock);
+static void yield_thread(void);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static const char* const s_kind_names[] =
+{
+    "chunked_memory_pool",
+    "chunked_memory_pool_locked",
+    "concurrent_memory_pool",
+    "static_memory_pool",
+    "lockfree_memory_pool"
+};
+
+void run_pool_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    pool_context_t context;
+    memset(&context, 0, sizeof(pool_context_t));
+
+    context.pa_threads = (pool_thread_context_t*)malloc(sizeof(pool_thread_context_t) * NUM_MAX_THREADS);
+    if (context.pa_threads == NULL)
+    {
+        ASSERT(false, "Failed to malloc thread contexts");
+        return;
+    }
+
+    for (size_t i = 0; i < NUM_MAX_THREADS; ++i)
+    {
+        context.pa_threads[i].p_pool_context = &context;
+    }
+
+    lock_init(&context.chunked_pool_lock);
+
+    const size_t num_max_threads = MIN(get_num_processors(), NUM_MAX_THREADS);
+
+    // 기준: 기존 단일 스레드 풀을 호출 스레드에서 잠금 없이 사용
+    // 헤더만으로 빌드하면 기준이 없으므로 배속은 기록하지 않음
+    double static_baseline_ns_per_op = 0.0;
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    double baseline_ns_per_op = 0.0;
+    if (chunked_memory_pool_initialize(&context.chunked_pool, ELEMENT_SIZE, NUM_ELEMENTS_PER_CHUNK))
+    {
+        context.kind = POOL_KIND_CHUNKED;
+        context.num_threads = 1;
+
+        bench_result_t result;
+        if (bench_run(p_bench, "pool_alloc_dealloc", "\"pool\": \"chunked_memory_pool\", \"threads\": 1", NULL,
+                      run_pool, &context, NUM_OPS_PER_THREAD, &result))
+        {
+            baseline_ns_per_op = result.ns_per_op;
+        }
+
+        chunked_memory_pool_release(&context.chunked_pool);
+    }
+
+    if (static_memory_pool_initialize(&context.static_pool, ELEMENT_SIZE, NUM_BATCH_ELEMENTS, 1))
+    {
+        context.kind = POOL_KIND_STATIC;
+        context.num_threads = 1;
+
+        bench_result_t result;
+        if (bench_run(p_bench, "pool_alloc_dealloc", "\"pool\": \"static_memory_pool\", \"threads\": 1", NULL,
+                      run_pool, &context, NUM_OPS_PER_THREAD, &result))
+        {
+            static_baseline_ns_per_op = result.ns_per_op;
+        }
+
+        static_memory_pool_release(&context.static_pool);
+    }
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+    for (size_t num_threads = 1; num_threads <= num_max_threads; num_threads *= 2)
+    {
+#if defined(SAFE99_GENERIC_HEADER_ONLY)
+        static const pool_kind_t s_threaded_kinds[] = { POOL_KIND_LOCKFREE };
+#else
+        static const pool_kind_t s_threaded_kinds[] = { POOL_KIND_LOCKED_CHUNKED, POOL_KIND_CONCURRENT, POOL_KIND_LOCKFREE };
+#endif // SAFE99_GENERIC_HEADER_ONLY
+        for (size_t i = 0; i < sizeof(s_threaded_kinds) / sizeof(s_threaded_kinds[0]); ++i)
+        {
+            const pool_kind_t kind = s_threaded_kinds[i];
+            context.kind = kind;
+            context.num_threads = num_threads;
+
+            bool b_initialized = false;
+            double single_thread_ns_per_op = 0.0;
+            switch (kind)
+            {
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+            case POOL_KIND_CONCURRENT:
+                b_initialized = concurrent_memory_pool_initialize(&context.concurrent_pool, ELEMENT_SIZE, NUM_ELEMENTS_PER_CHUNK);
+                single_thread_ns_per_op = baseline_ns_per_op;
+                break;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+            case POOL_KIND_LOCKFREE:
+                // 용량 제한: 스레드마다 배치 하나
+                b_initialized = lockfree_memory_pool_initialize(&context.lockfree_pool, ELEMENT_SIZE, NUM_BATCH_ELEMENTS * num_threads);
+                single_thread_ns_per_op = static_baseline_ns_per_op;
+                break;
+            default:
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+                b_initialized = chunked_memory_pool_initialize(&context.chunked_pool, ELEMENT_SIZE, NUM_ELEMENTS_PER_CHUNK);
+                single_thread_ns_per_op = baseline_ns_per_op;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+                break;
+            }
+
+            if (!b_initialized)
+            {
+                continue;
+            }
+
+            char params[128];
+            snprintf(params, sizeof(params), "\"pool\": \"%s\", \"threads\": %zu", s_kind_names[kind], num_threads);
+
+            // ops는 모든 스레드의 할당/해제 쌍의 합
+            bench_result_t result;
+            if (bench_run(p_bench, "pool_alloc_dealloc", params, NULL, run_pool, &context, NUM_OPS_PER_THREAD * num_threads, &result)
+                && single_thread_ns_per_op > 0.0 && result.ns_per_op > 0.0)
+            {
+                char metrics[64];
+                snprintf(metrics, sizeof(metrics), "\"speedup_vs_single_thread\": %.2f", single_thread_ns_per_op / result.ns_per_op);
+                bench_report(p_bench, "pool_scaling", params, metrics);
+            }
+
+            switch (kind)
+            {
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+            case POOL_KIND_CONCURRENT:
+                concurrent_memory_pool_release(&context.concurrent_pool);
+                break;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+            case POOL_KIND_LOCKFREE:
+                lockfree_memory_pool_release(&context.lockfree_pool);
+                break;
+            default:
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+                chunked_memory_pool_release(&context.chunked_pool);
+#endif // SAFE99_GENERIC_HEADER_ONLY
+                break;
+            }
+        }
+    }
+
+    run_lockfree_pool_stress(p_bench, &context);
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    run_concurrent_pool_handoff(p_bench, &context, MIN(MAX(num_max_threads / 2, 1), NUM_HANDOFF_MAX_PAIRS));
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+    lock_delete(&context.chunked_pool_lock);
+    SAFE_FREE(context.pa_threads);
+}
+
+static void run_pool(void* p_context)
+{
+    pool_context_t* p_pool_context = (pool_context_t*)p_context;
+
+    if (p_pool_context->kind == POOL_KIND_CHUNKED || p_pool_context->kind == POOL_KIND_STATIC)
+    {
+        run_pool_thread(&p_pool_context->pa_threads[0]);
+        return;
+    }
+
+    thread_t a_threads[NUM_MAX_THREADS];
+    size_t num_threads = 0;
+    for (size_t i = 0; i < p_pool_context->num_threads; ++i)
+    {
+        if (!create_thread(&a_threads[num_threads], run_pool_thread, &p_pool_context->pa_threads[i]))
+        {
+            ASSERT(false, "Failed to create thread");
+            continue;
+        }
+
+        ++num_threads;
+    }
+
+    join_threads(a_threads, num_threads);
+}
+
+static THREAD_FUNC(run_pool_thread)
+{
+    pool_thread_context_t* p_thread_context = (pool_thread_context_t*)p_param;
+    pool_context_t* p_pool_context = p_thread_context->p_pool_context;
+    void** ppa_elements = p_thread_context->pa_elements;
+
+    switch (p_pool_context->kind)
+    {
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+    case POOL_KIND_CHUNKED:
+        for (size_t i = 0; i < NUM_OPS_PER_THREAD; i += NUM_BATCH_ELEMENTS)
+        {
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                ppa_elements[j] = chunked_memory_pool_alloc_or_null(&p_pool_context->chunked_pool);
+            }
+
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                chunked_memory_pool_dealloc(&p_pool_context->chunked_pool, ppa_elements[j]);
+            }
+        }
+        break;
+
+    case POOL_KIND_LOCKED_CHUNKED:
+        // 기존 풀을 여러 스레드에서 쓰려면 호출마다 전역 잠금이 필요
+        for (size_t i = 0; i < NUM_OPS_PER_THREAD; i += NUM_BATCH_ELEMENTS)
+        {
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                lock_enter(&p_pool_context->chunked_pool_lock);
+                ppa_elements[j] = chunked_memory_pool_alloc_or_null(&p_pool_context->chunked_pool);
+                lock_leave(&p_pool_context->chunked_pool_lock);
+            }
+
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                lock_enter(&p_pool_context->chunked_pool_lock);
+                chunked_memory_pool_dealloc(&p_pool_context->chunked_pool, ppa_elements[j]);
+                lock_leave(&p_pool_context->chunked_pool_lock);
+            }
+        }
+        break;
+
+    case POOL_KIND_CONCURRENT:
+    {
+        concurrent_memory_pool_cache_t* p_cache = &p_thread_context->cache;
+        concurrent_memory_pool_cache_initialize(p_cache, &p_pool_context->concurrent_pool);
+
+        for (size_t i = 0; i < NUM_OPS_PER_THREAD; i += NUM_BATCH_ELEMENTS)
+        {
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                ppa_elements[j] = concurrent_memory_pool_alloc_or_null(p_cache);
+            }
+
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                concurrent_memory_pool_dealloc(p_cache, ppa_elements[j]);
+            }
+        }
+
+        concurrent_memory_pool_cache_release(p_cache);
+        break;
+    }
+
+    case POOL_KIND_STATIC:
+        for (size_t i = 0; i < NUM_OPS_PER_THREAD; i += NUM_BATCH_ELEMENTS)
+        {
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                ppa_elements[j] = static_memory_pool_alloc_or_null(&p_pool_context->static_pool);
+            }
+
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                static_memory_pool_dealloc(&p_pool_context->static_pool, ppa_elements[j]);
+            }
+        }
+        break;
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+    case POOL_KIND_LOCKFREE:
+        for (size_t i = 0; i < NUM_OPS_PER_THREAD; i += NUM_BATCH_ELEMENTS)
+        {
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                ppa_elements[j] = lockfree_memory_pool_alloc_or_null(&p_pool_context->lockfree_pool);
+            }
+
+            for (size_t j = 0; j < NUM_BATCH_ELEMENTS; ++j)
+            {
+                lockfree_memory_pool_dealloc(&p_pool_context->lockfree_pool, ppa_elements[j]);
+            }
+        }
+        break;
+
+    default:
+        ASSERT(false, "invalid pool kind");
+        break;
+    }
+
+    bench_do_not_optimize(ppa_elements);
+    return THREAD_RETURN;
+}
+
+// 여러 스레드가 할당/해제를 섞어 반복한 뒤
+// - 할당받은 원소에 쓴 값이 해제 직전까지 유지되는지 (같은 원소가 두 스레드에 동시에 나가지 않는지)
+// - 모든 원소가 정확히 한 번씩 풀로 돌아왔는지 확인
+static void run_lockfree_pool_stress(bench_t* p_bench, pool_context_t* p_pool_context)
+{
+    if (!lockfree_memory_pool_initialize(&p_pool_context->lockfree_pool, sizeof(uint64_t), NUM_STRESS_MAX_ELEMENTS))
+    {
+        return;
+    }
+
+    thread_t a_threads[NUM_STRESS_THREADS];
+    size_t num_threads = 0;
+    for (size_t i = 0; i < NUM_STRESS_THREADS; ++i)
+    {
+        pool_thread_context_t* p_thread_context = &p_pool_context->pa_threads[i];
+        p_thread_context->thread_index = (uint32_t)i;
+        p_thread_context->num_violations = 0;
+        p_thread_context->num_exhausted = 0;
+
+        if (!create_thread(&a_threads[num_threads], run_lockfree_pool_stress_thread, p_thread_context))
+        {
+            ASSERT(false, "Failed to create thread");
+            continue;
+        }
+
+        ++num_threads;
+    }
+
+    join_threads(a_threads, num_threads);
+
+    size_t num_violations = 0;
+    size_t num_exhausted = 0;
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        num_violations += p_pool_context->pa_threads[i].num_violations;
+        num_exhausted += p_pool_context->pa_threads[i].num_exhausted;
+    }
+
+    // 모두 꺼내서 중복 없이 용량만큼 나오는지 확인
+    bool b_returned[NUM_STRESS_MAX_ELEMENTS] = { false, };
+    size_t num_returned = 0;
+    char* p_element;
+    while ((p_element = (char*)lockfree_memory_pool_alloc_or_null(&p_pool_context->lockfree_pool)) != NULL)
+    {
+        const size_t index = (size_t)(p_element - p_pool_context->lockfree_pool.pa_elements) / p_pool_context->lockfree_pool.element_size_with_padding;
+        if (b_returned[index])
+        {
+            ++num_violations;
+        }
+
+        b_returned[index] = true;
+        ++num_returned;
+    }
+
+    char params[128];
+    snprintf(params, sizeof(params), "\"threads\": %zu, \"rounds\": %d, \"capacity\": %d",
+             num_threads, NUM_STRESS_ROUNDS, NUM_STRESS_MAX_ELEMENTS);
+
+    char metrics[128];
+    snprintf(metrics, sizeof(metrics), "\"violations\": %zu, \"returned\": %zu, \"exhausted\": %zu, \"passed\": %s",
+             num_violations, num_returned, num_exhausted,
+             (num_violations == 0 && num_returned == NUM_STRESS_MAX_ELEMENTS) ? "true" : "false");
+    bench_report(p_bench, "lockfree_memory_pool_stress", params, metrics);
+
+    lockfree_memory_pool_release(&p_pool_context->lockfree_pool);
+}
+
+static THREAD_FUNC(run_lockfree_pool_stress_thread)
+{
+    pool_thread_context_t* p_thread_context = (pool_thread_context_t*)p_param;
+    lockfree_memory_pool_t* p_pool = &p_thread_context->p_pool_context->lockfree_pool;
+    uint64_t** ppa_elements = (uint64_t**)p_thread_context->pa_elements;
+
+    // xorshift32, 스레드마다 다른 시퀀스
+    uint32_t state = BENCH_SEED ^ ((p_thread_context->thread_index + 1) * 0x9e3779b9u);
+
+    for (uint32_t round = 0; round < NUM_STRESS_ROUNDS; ++round)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+
+        const uint64_t stamp = ((uint64_t)p_thread_context->thread_index << 32) | round;
+        const size_t num_elements = state % NUM_STRESS_MAX_BATCH_ELEMENTS + 1;
+
+        size_t num_alloc_elements = 0;
+        for (; num_alloc_elements < num_elements; ++num_alloc_elements)
+        {
+            uint64_t* p_element = (uint64_t*)lockfree_memory_pool_alloc_or_null(p_pool);
+            if (p_element == NULL)
+            {
+                ++p_thread_context->num_exhausted;
+                break;
+            }
+
+            *p_element = stamp;
+            ppa_elements[num_alloc_elements] = p_element;
+        }
+
+        for (size_t i = 0; i < num_alloc_elements; ++i)
+        {
+            if (*ppa_elements[i] != stamp)
+            {
+                ++p_thread_context->num_violations;
+            }
+
+            lockfree_memory_pool_dealloc(p_pool, ppa_elements[i]);
+        }
+    }
+
+    return THREAD_RETURN;
+}
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+// 짝마다 생산자가 원소를 할당해 큐에 넣고 소비자가 꺼내 자기 캐시로 해제한 뒤
+// - 소비자가 받은 원소의 스탬프가 생산자가 쓴 값과 같은지
+// - 생산자가 받은 원소가 아직 소비자에게 살아 있는 원소가 아닌지 확인
+static void run_concurrent_pool_handoff(bench_t* p_bench, pool_context_t* p_pool_context, const size_t num_pairs)
+{
+    ASSERT(num_pairs * 2 <= NUM_MAX_THREADS, "too many pairs");
+
+    handoff_queue_t* pa_queues = (handoff_queue_t*)malloc(sizeof(handoff_queue_t) * num_pairs);
+    if (pa_queues == NULL)
+    {
+        ASSERT(false, "Failed to malloc handoff queues");
+        return;
+    }
+
+    if (!concurrent_memory_pool_initialize(&p_pool_context->concurrent_pool, ELEMENT_SIZE, NUM_ELEMENTS_PER_CHUNK))
+    {
+        goto failed_init_pool;
+    }
+
+    for (size_t i = 0; i < num_pairs; ++i)
+    {
+        lock_init(&pa_queues[i].lock);
+        pa_queues[i].head = 0;
+        pa_queues[i].num_elements = 0;
+    }
+
+    // 소비자가 해제한 원소가 생산자 캐시로 돌아가야 하므로 캐시는 스레드를 만들기 전에 초기화하고 모두 끝난 뒤 해제
+    for (size_t i = 0; i < num_pairs * 2; ++i)
+    {
+        pool_thread_context_t* p_thread_context = &p_pool_context->pa_threads[i];
+        p_thread_context->thread_index = (uint32_t)(i / 2);
+        p_thread_context->num_violations = 0;
+        p_thread_context->p_queue = &pa_queues[i / 2];
+        concurrent_memory_pool_cache_initialize(&p_thread_context->cache, &p_pool_context->concurrent_pool);
+    }
+
+    const uint64_t start_counter = bench_get_counter();
+
+    thread_t a_threads[NUM_MAX_THREADS];
+    size_t num_threads = 0;
+    size_t num_pairs_started = 0;
+    for (size_t i = 0; i < num_pairs; ++i)
+    {
+        // 소비자가 없으면 생산자가 큐가 비기를 계속 기다리므로 짝으로만 시작
+        if (!create_thread(&a_threads[num_threads], run_concurrent_pool_consumer_thread, &p_pool_context->pa_threads[i * 2 + 1]))
+        {
+            ASSERT(false, "Failed to create thread");
+            continue;
+        }
+        ++num_threads;
+
+        if (!create_thread(&a_threads[num_threads], run_concurrent_pool_producer_thread, &p_pool_context->pa_threads[i * 2]))
+        {
+            ASSERT(false, "Failed to create thread");
+
+            // 소비자는 종료 표시(NULL)를 받아야 끝남
+            handoff_queue_t* p_queue = &pa_queues[i];
+            lock_enter(&p_queue->lock);
+            p_queue->a_elements[p_queue->head] = NULL;
+            p_queue->num_elements = 1;
+            lock_leave(&p_queue->lock);
+            continue;
+        }
+        ++num_threads;
+        ++num_pairs_started;
+    }
+
+    join_threads(a_threads, num_threads);
+
+    const double elapsed_ns = bench_counter_to_ns(bench_get_counter() - start_counter);
+
+    size_t num_violations = 0;
+    for (size_t i = 0; i < num_pairs * 2; ++i)
+    {
+        num_violations += p_pool_context->pa_threads[i].num_violations;
+    }
+
+    // 소비자 캐시를 먼저 해제해 생산자 반환 스택으로 간 원소가 모두 도착한 뒤 생산자 캐시를 해제
+    for (size_t i = 0; i < num_pairs; ++i)
+    {
+        concurrent_memory_pool_cache_release(&p_pool_context->pa_threads[i * 2 + 1].cache);
+    }
+    for (size_t i = 0; i < num_pairs; ++i)
+    {
+        concurrent_memory_pool_cache_release(&p_pool_context->pa_threads[i * 2].cache);
+    }
+
+    const size_t num_ops = NUM_HANDOFF_OPS_PER_PAIR * num_pairs_started;
+    const bool b_passed = (num_violations == 0 && num_pairs_started == num_pairs);
+
+    char params[128];
+    snprintf(params, sizeof(params), "\"pairs\": %zu, \"ops_per_pair\": %zu, \"element_size\": %d",
+             num_pairs, NUM_HANDOFF_OPS_PER_PAIR, ELEMENT_SIZE);
+
+    char metrics[128];
+    snprintf(metrics, sizeof(metrics), "\"violations\": %zu, \"ns_per_op\": %.3f, \"passed\": %s",
+             num_violations, (num_ops > 0) ? elapsed_ns / (double)num_ops : 0.0, b_passed ? "true" : "false");
+    if (bench_report(p_bench, "concurrent_memory_pool_handoff", params, metrics) && !b_passed)
+    {
+        fprintf(stderr, "concurrent_memory_pool_handoff: %zu violation(s), %zu of %zu pair(s) started\n",
+                num_violations, num_pairs_started, num_pairs);
+        ++p_bench->num_failures;
+    }
+
+    for (size_t i = 0; i < num_pairs; ++i)
+    {
+        lock_delete(&pa_queues[i].lock);
+    }
+
+    concurrent_memory_pool_release(&p_pool_context->concurrent_pool);
+
+failed_init_pool:
+    SAFE_FREE(pa_queues);
+}
+
+static THREAD_FUNC(run_concurrent_pool_producer_thread)
+{
+    pool_thread_context_t* p_thread_context = (pool_thread_context_t*)p_param;
+    handoff_queue_t* p_queue = p_thread_context->p_queue;
+    concurrent_memory_pool_cache_t* p_cache = &p_thread_context->cache;
+    uint64_t** ppa_elements = (uint64_t**)p_thread_context->pa_elements;
+
+    size_t num_produced = 0;
+    while (num_produced < NUM_HANDOFF_OPS_PER_PAIR)
+    {
+        const size_t num_elements = MIN(NUM_BATCH_ELEMENTS, NUM_HANDOFF_OPS_PER_PAIR - num_produced);
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            uint64_t* p_element = (uint64_t*)concurrent_memory_pool_alloc_or_null(p_cache);
+            ASSERT(p_element != NULL, "Failed to alloc element");
+
+            // 소비자가 아직 해제하지 않은 원소가 다시 나오면 위반
+            if (p_element[HANDOFF_STATE_INDEX] == HANDOFF_STATE_LIVE)
+            {
+                ++p_thread_context->num_violations;
+            }
+
+            p_element[HANDOFF_STATE_INDEX] = HANDOFF_STATE_LIVE;
+            p_element[HANDOFF_STAMP_INDEX] = ((uint64_t)p_thread_context->thread_index << 32) | (uint32_t)(num_produced + i);
+            ppa_elements[i] = p_element;
+        }
+
+        // 큐에 자리가 날 때까지 기다리며 넣음
+        size_t num_pushed = 0;
+        while (num_pushed < num_elements)
+        {
+            lock_enter(&p_queue->lock);
+            while (num_pushed < num_elements && p_queue->num_elements < NUM_HANDOFF_QUEUE_ELEMENTS)
+            {
+                p_queue->a_elements[(p_queue->head + p_queue->num_elements) % NUM_HANDOFF_QUEUE_ELEMENTS] = ppa_elements[num_pushed++];
+                ++p_queue->num_elements;
+            }
+            lock_leave(&p_queue->lock);
+
+            if (num_pushed < num_elements)
+            {
+                yield_thread();
+            }
+        }
+
+        num_produced += num_elements;
+    }
+
+    // 종료 표시
+    while (true)
+    {
+        lock_enter(&p_queue->lock);
+        const bool b_pushed = (p_queue->num_elements < NUM_HANDOFF_QUEUE_ELEMENTS);
+        if (b_pushed)
+        {
+            p_queue->a_elements[(p_queue->head + p_queue->num_elements) % NUM_HANDOFF_QUEUE_ELEMENTS] = NULL;
+            ++p_queue->num_elements;
+        }
+        lock_leave(&p_queue->lock);
+
+        if (b_pushed)
+        {
+            break;
+        }
+        yield_thread();
+    }
+
+    return THREAD_RETURN;
+}
+
+static THREAD_FUNC(run_concurrent_pool_consumer_thread)
+{
+    pool_thread_context_t* p_thread_context = (pool_thread_context_t*)p_param;
+    handoff_queue_t* p_queue = p_thread_context->p_queue;
+    concurrent_memory_pool_cache_t* p_cache = &p_thread_context->cache;
+    uint64_t** ppa_elements = (uint64_t**)p_thread_context->pa_elements;
+
+    uint32_t expected_sequence = 0;
+    bool b_done = false;
+    while (!b_done)
+    {
+        size_t num_elements = 0;
+        lock_enter(&p_queue->lock);
+        while (num_elements < NUM_BATCH_ELEMENTS && p_queue->num_elements > 0)
+        {
+            ppa_elements[num_elements++] = (uint64_t*)p_queue->a_elements[p_queue->head];
+            p_queue->head = (p_queue->head + 1) % NUM_HANDOFF_QUEUE_ELEMENTS;
+            --p_queue->num_elements;
+        }
+        lock_leave(&p_queue->lock);
+
+        if (num_elements == 0)
+        {
+            yield_thread();
+            continue;
+        }
+
+        for (size_t i = 0; i < num_elements; ++i)
+        {
+            uint64_t* p_element = ppa_elements[i];
+            if (p_element == NULL)
+            {
+                b_done = true;
+                break;
+            }
+
+            // 큐는 순서를 지키므로 스탬프는 생산 순서와 같아야 함
+            const uint64_t expected_stamp = ((uint64_t)p_thread_context->thread_index << 32) | expected_sequence++;
+            if (p_element[HANDOFF_STATE_INDEX] != HANDOFF_STATE_LIVE || p_element[HANDOFF_STAMP_INDEX] != expected_stamp)
+            {
+                ++p_thread_context->num_violations;
+            }
+
+            p_element[HANDOFF_STATE_INDEX] = HANDOFF_STATE_FREED;
+            concurrent_memory_pool_dealloc(p_cache, p_element);
+        }
+    }
+
+    return THREAD_RETURN;
+}
+#endif // SAFE99_GENERIC_HEADER_ONLY
+
+static bool create_thread(thread_t* p_out_thread, thread_func pf_thread, void* p_param)
+{
+#if defined(_WIN32)
+    *p_out_thread = CreateThread(NULL, 0, pf_thread, p_param, 0, NULL);
+    return *p_out_thread != NULL;
+#else
+    return pthread_create(p_out_thread, NULL, pf_thread, p_param) == 0;
+#endif // _WIN32
+}
+
+static void join_threads(thread_t* pa_threads, const size_t num_threads)
+{
+#if defined(_WIN32)
+    WaitForMultipleObjects((DWORD)num_threads, pa_threads, TRUE, INFINITE);
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        CloseHandle(pa_threads[i]);
+    }
+#else
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        pthread_join(pa_threads[i], NULL);
+    }
+#endif // _WIN32
+}
+
+static size_t get_num_processors(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO system_info;
+    GetSystemInfo(&system_info);
+    return (size_t)system_info.dwNumberOfProcessors;
+#else
+    const long num_processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return (num_processors > 0) ? (size_t)num_processors : 1;
+#endif // _WIN32
+}
+
+static void lock_init(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    InitializeCriticalSection(p_lock);
+#else
+    pthread_mutex_init(p_lock, NULL);
+#endif // _WIN32
+}
+
+static void lock_delete(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    DeleteCriticalSection(p_lock);
+#else
+    pthread_mutex_destroy(p_lock);
+#endif // _WIN32
+}
+
+#if !defined(SAFE99_GENERIC_HEADER_ONLY)
+static void lock_enter(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    EnterCriticalSection(p_lock);
+#else
+    pthread_mutex_lock(p_lock);
+#endif // _WIN32
+}
+
+static void lock_leave(lock_t* p_lock)
+{
+#if defined(_WIN32)
+    LeaveCriticalSection(p_lock);
+#else
+    pthread_mutex_unlock(p_lock);
+#endif // _WIN32
+}
+
+// 코어보다 스레드가 많아도 짝 스레드가 진행하도록 양보
+static void yield_thread(void)
+{
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    sched_yield();
+#endif // _WIN32
+}
+#endif // SAFE99_GENERIC_HEADER_ONLY
\ No newline at end of file
@@ -0,0 +1,91 @@
+﻿//***************************************************************************
+// 
+// 파일: main.c
+// 
+// 설명: safe99_generic 벤치마크 main 함수
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 사용법: safe99_generic_bench [--out file.json] [--warmups n] [--reps n] [--filter name]
+// 
+// 컨테이너나 할당자를 바꿀 때 바꾸기 전과 후의 JSON을 비교
+// ns/op 외에 캐시 미스/op (Linux perf_event 사용 가능할 때)와 최대 상주 메모리를 기록함
+// 
+// Linux에서는 헤더만으로 이루어진 컨테이너와 lockfree_memory_pool만 빌드됨
+//   gcc -O2 -DSAFE99_GENERIC_HEADER_ONLY -I source -I source/safe99_generic_bench -I source/minesweeper_bench
+//       source/minesweeper_bench/bench.c source/safe99_generic_bench/*.c -lm -lpthread -o safe99_generic_bench
+// SAFE99_GENERIC_HEADER_ONLY는 safe99_generic DLL이 필요한 케이스를 뺌
+// (map_t, list_t, chunked/static/concurrent_memory_pool, hash32/64_fnv1a)
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_math/math_misc.h"
+#include "bench.h"
+#include "bench_cases.h"
+
+int main(int argc, char** argv)
+{
+    const char* out_filename = NULL;
+    const char* filter = NULL;
+    size_t num_warmups = BENCH_DEFAULT_NUM_WARMUPS;
+    size_t num_repetitions = BENCH_DEFAULT_NUM_REPETITIONS;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool b_has_value = (i + 1 < argc);
+
+        if (strcmp(argv[i], "--out") == 0 && b_has_value)
+        {
+            out_filename = argv[++i];
+        }
+        else if (strcmp(argv[i], "--warmups") == 0 && b_has_value)
+        {
+            num_warmups = (size_t)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--reps") == 0 && b_has_value)
+        {
+            // MAX는 인자를 두 번 평가하므로 ++i를 밖에서
+            const int num_reps = atoi(argv[++i]);
+            num_repetitions = (size_t)MAX(1, num_reps);
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && b_has_value)
+        {
+            filter = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--out file.json] [--warmups n] [--reps n] [--filter name]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bench_t bench;
+    if (!bench_init(&bench, out_filename, num_warmups, num_repetitions, filter))
+    {
+        fprintf(stderr, "Failed to open %s\n", out_filename);
+        return 1;
+    }
+
+    run_generic_benchmarks(&bench);
+    run_container_benchmarks(&bench);
+    run_allocator_benchmarks(&bench);
+    run_hash_benchmarks(&bench);
+    run_pool_benchmarks(&bench);
+
+    const size_t num_failures = bench.num_failures;
+    bench_shutdown(&bench);
+
+    if (num_failures > 0)
+    {
+        fprintf(stderr, "%zu check(s) failed\n", num_failures);
+        return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
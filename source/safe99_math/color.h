@@ -3,6 +3,7 @@
 // 파일: color.h
 // 
 // 설명: float4 색상
+//       color_t는 16바이트 정렬 (배열 변환은 SSE2)
 // 
 // 작성자: bumpsgoodman
 // 
@@ -40,9 +41,10 @@ FORCEINLINE color_t __stdcall color_set(const float r, const float g, const floa
     };
     */
     
+    // color_t는 구조체 안의 익명 union 안의 익명 구조체
     const color_t color =
     {
-        r, g, b, a
+        { { r, g, b, a } }
     };
     return color;
 }
@@ -64,6 +66,64 @@ FORCEINLINE color_t __stdcall argb_to_color(const uint32_t argb)
                      (float)(GET_ALPHA_ARGB(argb) / 255.0f));
 }
 
+// SSE2 배열 변환 (colors_to_argbs는 색 하나씩, argbs_to_colors는 픽셀 4개씩)
+// 결과는 color_to_argb(), argb_to_color()와 같음 (범위를 벗어난 성분은 0 ~ 255로 포화)
+FORCEINLINE void __stdcall colors_to_argbs(const color_t* p_colors, uint32_t* p_out_argbs, const size_t count)
+{
+    ASSERT(p_colors != NULL, "p_colors == NULL");
+    ASSERT(p_out_argbs != NULL, "p_out_argbs == NULL");
+
+    const __m128 scale = _mm_set_ps1(255.0f);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // (r, g, b, a) -> (b, g, r, a)로 바꾸면 바이트로 줄였을 때 리틀 엔디안 ARGB
+        __m128 rgba = _mm_mul_ps(_mm_load_ps(p_colors[i].rgba), scale);
+        rgba = _mm_shuffle_ps(rgba, rgba, _MM_SHUFFLE(3, 0, 1, 2));
+
+        __m128i bgra = _mm_cvttps_epi32(rgba);
+        bgra = _mm_packs_epi32(bgra, bgra);
+        bgra = _mm_packus_epi16(bgra, bgra);
+        p_out_argbs[i] = (uint32_t)_mm_cvtsi128_si32(bgra);
+    }
+}
+
+FORCEINLINE void __stdcall argbs_to_colors(const uint32_t* p_argbs, color_t* p_out_colors, const size_t count)
+{
+    ASSERT(p_argbs != NULL, "p_argbs == NULL");
+    ASSERT(p_out_colors != NULL, "p_out_colors == NULL");
+
+    const __m128 scale = _mm_set_ps1(255.0f);
+    const __m128i zero = _mm_setzero_si128();
+
+    const size_t num_vector_pixels = count & ~(size_t)3;
+
+    size_t i = 0;
+    for (; i < num_vector_pixels; i += 4)
+    {
+        const __m128i argbs = _mm_loadu_si128((const __m128i*)(p_argbs + i));
+        const __m128i lo = _mm_unpacklo_epi8(argbs, zero);
+        const __m128i hi = _mm_unpackhi_epi8(argbs, zero);
+
+        // 픽셀마다 (b, g, r, a) 정수 -> float -> (r, g, b, a)
+        // argb_to_color()와 같은 값이 나오도록 역수 곱셈 대신 나눗셈
+        __m128 bgra0 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale);
+        __m128 bgra1 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale);
+        __m128 bgra2 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale);
+        __m128 bgra3 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale);
+
+        _mm_store_ps(p_out_colors[i + 0].rgba, _mm_shuffle_ps(bgra0, bgra0, _MM_SHUFFLE(3, 0, 1, 2)));
+        _mm_store_ps(p_out_colors[i + 1].rgba, _mm_shuffle_ps(bgra1, bgra1, _MM_SHUFFLE(3, 0, 1, 2)));
+        _mm_store_ps(p_out_colors[i + 2].rgba, _mm_shuffle_ps(bgra2, bgra2, _MM_SHUFFLE(3, 0, 1, 2)));
+        _mm_store_ps(p_out_colors[i + 3].rgba, _mm_shuffle_ps(bgra3, bgra3, _MM_SHUFFLE(3, 0, 1, 2)));
+    }
+
+    for (; i < count; ++i)
+    {
+        p_out_colors[i] = argb_to_color(p_argbs[i]);
+    }
+}
+
 END_EXTERN_C
 
 #endif // COLOR_H
\ No newline at end of file
@@ -13,14 +13,13 @@
 #ifndef SAFE99_MATH_H
 #define SAFE99_MATH_H
 
-#include <intrin.h>
-
 #include "safe99_common/defines.h"
 
 #include "color.h"
 #include "math_defines.h"
 #include "math_misc.h"
 #include "matrix.h"
+#include "transform.h"
 
 START_EXTERN_C
 
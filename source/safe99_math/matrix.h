@@ -3,6 +3,7 @@
 // 파일: matrix.h
 // 
 // 설명: SSE로 작성한 4x4 행렬
+//       SSE2 명령만 사용
 // 
 // 작성자: bumpsgoodman
 // 
@@ -52,37 +53,40 @@ FORCEINLINE matrix_t __vectorcall matrix_set(const float m00, const float m01, c
     return result;
 }
 
+// result[i] = dot(v, m_tr.r[i])
+// 행별 곱을 전치해서 더하면 성분별 수평 합이 한 번에 끝남
 FORCEINLINE vector_t __vectorcall matrix_mul_vector(const vector_t v, const matrix_t m_tr)
 {
-    const vector_t result = vector_set(_mm_cvtss_f32(_mm_dp_ps(v, m_tr.r0, 0xff)),
-                                       _mm_cvtss_f32(_mm_dp_ps(v, m_tr.r1, 0xff)),
-                                       _mm_cvtss_f32(_mm_dp_ps(v, m_tr.r2, 0xff)),
-                                       _mm_cvtss_f32(_mm_dp_ps(v, m_tr.r3, 0xff)));
-    return result;
+    vector_t x = _mm_mul_ps(v, m_tr.r0);
+    vector_t y = _mm_mul_ps(v, m_tr.r1);
+    vector_t z = _mm_mul_ps(v, m_tr.r2);
+    vector_t w = _mm_mul_ps(v, m_tr.r3);
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+
+    return _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w));
+}
+
+// result.r[i] = m0.r[i].x * m1.r0 + m0.r[i].y * m1.r1 + m0.r[i].z * m1.r2 + m0.r[i].w * m1.r3
+// m1_tr을 한 번만 전치하고 행마다 브로드캐스트 곱셈 4번 + 덧셈 3번
+FORCEINLINE vector_t __vectorcall matrix_mul_row(const vector_t row, const matrix_t m1)
+{
+    const vector_t x = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), m1.r0);
+    const vector_t y = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), m1.r1);
+    const vector_t z = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), m1.r2);
+    const vector_t w = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), m1.r3);
+
+    return _mm_add_ps(_mm_add_ps(x, y), _mm_add_ps(z, w));
 }
 
 FORCEINLINE matrix_t __vectorcall matrix_mul(const matrix_t m0, const matrix_t m1_tr)
 {
+    const matrix_t m1 = matrix_get_transpose(m1_tr);
+
     matrix_t result;
-    result.r0 = vector_set(_mm_cvtss_f32(_mm_dp_ps(m0.r0, m1_tr.r0, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r0, m1_tr.r1, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r0, m1_tr.r2, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r0, m1_tr.r3, 0xff)));
-
-    result.r1 = vector_set(_mm_cvtss_f32(_mm_dp_ps(m0.r1, m1_tr.r0, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r1, m1_tr.r1, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r1, m1_tr.r2, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r1, m1_tr.r3, 0xff)));
-
-    result.r2 = vector_set(_mm_cvtss_f32(_mm_dp_ps(m0.r2, m1_tr.r0, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r2, m1_tr.r1, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r2, m1_tr.r2, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r2, m1_tr.r3, 0xff)));
-
-    result.r3 = vector_set(_mm_cvtss_f32(_mm_dp_ps(m0.r3, m1_tr.r0, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r3, m1_tr.r1, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r3, m1_tr.r2, 0xff)),
-                           _mm_cvtss_f32(_mm_dp_ps(m0.r3, m1_tr.r3, 0xff)));
+    result.r0 = matrix_mul_row(m0.r0, m1);
+    result.r1 = matrix_mul_row(m0.r1, m1);
+    result.r2 = matrix_mul_row(m0.r2, m1);
+    result.r3 = matrix_mul_row(m0.r3, m1);
     return result;
 }
 
@@ -0,0 +1,180 @@
+﻿//***************************************************************************
+// 
+// 파일: transform.h
+// 
+// 설명: SoA 정점 배열 변환
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 정점을 x, y, z 배열로 나누고 행렬 성분을 미리 브로드캐스트해서
+// 명령 하나로 SSE2는 정점 4개, AVX는 정점 8개를 변환
+// 정점마다 matrix_mul_vector()를 호출하면 전치와 수평 합이 필요하지만 SoA는 곱셈과 덧셈만 필요
+// AVX 경로는 실행 시간에 CPU를 확인해서 선택하므로 /arch:AVX 없이 빌드해도 사용됨
+// 
+//***************************************************************************
+
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+#include "safe99_common/defines.h"
+
+START_EXTERN_C
+
+// 행렬은 matrix_mul_vector()와 같은 규약: out.x = dot((x, y, z, 1), p_m_tr->r0)
+// 입력과 출력은 정렬되지 않아도 되며 같은 배열이어도 됨
+// p_out_ws_or_null이 NULL이면 w를 저장하지 않음 (2D/아핀 변환)
+static INLINE void matrix_transform_points_soa_scalar(const matrix_t* p_m_tr,
+                                                      const float* p_xs, const float* p_ys, const float* p_zs, const size_t num_points,
+                                                      float* p_out_xs, float* p_out_ys, float* p_out_zs, float* p_out_ws_or_null)
+{
+    ASSERT(p_m_tr != NULL, "p_m_tr == NULL");
+
+    const float* p_m = (const float*)p_m_tr;
+
+    for (size_t i = 0; i < num_points; ++i)
+    {
+        const float x = p_xs[i];
+        const float y = p_ys[i];
+        const float z = p_zs[i];
+
+        p_out_xs[i] = p_m[0] * x + p_m[1] * y + p_m[2] * z + p_m[3];
+        p_out_ys[i] = p_m[4] * x + p_m[5] * y + p_m[6] * z + p_m[7];
+        p_out_zs[i] = p_m[8] * x + p_m[9] * y + p_m[10] * z + p_m[11];
+        if (p_out_ws_or_null != NULL)
+        {
+            p_out_ws_or_null[i] = p_m[12] * x + p_m[13] * y + p_m[14] * z + p_m[15];
+        }
+    }
+}
+
+static INLINE void matrix_transform_points_soa_sse2(const matrix_t* p_m_tr,
+                                                    const float* p_xs, const float* p_ys, const float* p_zs, const size_t num_points,
+                                                    float* p_out_xs, float* p_out_ys, float* p_out_zs, float* p_out_ws_or_null)
+{
+    ASSERT(p_m_tr != NULL, "p_m_tr == NULL");
+
+    const float* p_m = (const float*)p_m_tr;
+
+    __m128 m[16];
+    for (size_t k = 0; k < 16; ++k)
+    {
+        m[k] = _mm_set1_ps(p_m[k]);
+    }
+
+    size_t i = 0;
+    for (; i + 4 <= num_points; i += 4)
+    {
+        const __m128 x = _mm_loadu_ps(p_xs + i);
+        const __m128 y = _mm_loadu_ps(p_ys + i);
+        const __m128 z = _mm_loadu_ps(p_zs + i);
+
+        const __m128 out_x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[0]), _mm_mul_ps(y, m[1])), _mm_add_ps(_mm_mul_ps(z, m[2]), m[3]));
+        const __m128 out_y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[4]), _mm_mul_ps(y, m[5])), _mm_add_ps(_mm_mul_ps(z, m[6]), m[7]));
+        const __m128 out_z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[8]), _mm_mul_ps(y, m[9])), _mm_add_ps(_mm_mul_ps(z, m[10]), m[11]));
+        _mm_storeu_ps(p_out_xs + i, out_x);
+        _mm_storeu_ps(p_out_ys + i, out_y);
+        _mm_storeu_ps(p_out_zs + i, out_z);
+
+        if (p_out_ws_or_null != NULL)
+        {
+            const __m128 out_w = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m[12]), _mm_mul_ps(y, m[13])), _mm_add_ps(_mm_mul_ps(z, m[14]), m[15]));
+            _mm_storeu_ps(p_out_ws_or_null + i, out_w);
+        }
+    }
+
+    // 남은 3개 이하
+    matrix_transform_points_soa_scalar(p_m_tr, p_xs + i, p_ys + i, p_zs + i, num_points - i,
+                                       p_out_xs + i, p_out_ys + i, p_out_zs + i,
+                                       (p_out_ws_or_null != NULL) ? p_out_ws_or_null + i : NULL);
+}
+
+// CPU가 AVX를 지원하는지 확인한 뒤에만 호출
+static INLINE TARGET_AVX void matrix_transform_points_soa_avx(const matrix_t* p_m_tr,
+                                                              const float* p_xs, const float* p_ys, const float* p_zs, const size_t num_points,
+                                                              float* p_out_xs, float* p_out_ys, float* p_out_zs, float* p_out_ws_or_null)
+{
+    ASSERT(p_m_tr != NULL, "p_m_tr == NULL");
+
+    const float* p_m = (const float*)p_m_tr;
+
+    __m256 m[16];
+    for (size_t k = 0; k < 16; ++k)
+    {
+        m[k] = _mm256_set1_ps(p_m[k]);
+    }
+
+    size_t i = 0;
+    for (; i + 8 <= num_points; i += 8)
+    {
+        const __m256 x = _mm256_loadu_ps(p_xs + i);
+        const __m256 y = _mm256_loadu_ps(p_ys + i);
+        const __m256 z = _mm256_loadu_ps(p_zs + i);
+
+        const __m256 out_x = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m[0]), _mm256_mul_ps(y, m[1])), _mm256_add_ps(_mm256_mul_ps(z, m[2]), m[3]));
+        const __m256 out_y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m[4]), _mm256_mul_ps(y, m[5])), _mm256_add_ps(_mm256_mul_ps(z, m[6]), m[7]));
+        const __m256 out_z = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m[8]), _mm256_mul_ps(y, m[9])), _mm256_add_ps(_mm256_mul_ps(z, m[10]), m[11]));
+        _mm256_storeu_ps(p_out_xs + i, out_x);
+        _mm256_storeu_ps(p_out_ys + i, out_y);
+        _mm256_storeu_ps(p_out_zs + i, out_z);
+
+        if (p_out_ws_or_null != NULL)
+        {
+            const __m256 out_w = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m[12]), _mm256_mul_ps(y, m[13])), _mm256_add_ps(_mm256_mul_ps(z, m[14]), m[15]));
+            _mm256_storeu_ps(p_out_ws_or_null + i, out_w);
+        }
+    }
+
+    // 남은 7개 이하
+    matrix_transform_points_soa_sse2(p_m_tr, p_xs + i, p_ys + i, p_zs + i, num_points - i,
+                                     p_out_xs + i, p_out_ys + i, p_out_zs + i,
+                                     (p_out_ws_or_null != NULL) ? p_out_ws_or_null + i : NULL);
+}
+
+// CPU와 OS가 모두 AVX(YMM 레지스터 저장)를 지원하는지
+static INLINE bool math_is_avx_supported(void)
+{
+#if defined(_MSC_VER)
+    int cpu_info[4];
+    __cpuid(cpu_info, 1);
+
+    // OSXSAVE, AVX
+    const int osxsave_avx = (1 << 27) | (1 << 28);
+    if ((cpu_info[2] & osxsave_avx) != osxsave_avx)
+    {
+        return false;
+    }
+
+    // XMM, YMM 상태를 OS가 저장하는지
+    return (_xgetbv(0) & 0x6) == 0x6;
+#else
+    return __builtin_cpu_supports("avx") != 0;
+#endif // _MSC_VER
+}
+
+// AVX를 지원하면 AVX, 아니면 SSE2 경로
+static INLINE void matrix_transform_points_soa(const matrix_t* p_m_tr,
+                                               const float* p_xs, const float* p_ys, const float* p_zs, const size_t num_points,
+                                               float* p_out_xs, float* p_out_ys, float* p_out_zs, float* p_out_ws_or_null)
+{
+    // 처음 호출할 때 한 번만 확인 (여러 스레드가 동시에 써도 같은 값)
+    static int s_avx_supported = -1;
+    if (s_avx_supported < 0)
+    {
+        s_avx_supported = math_is_avx_supported() ? 1 : 0;
+    }
+
+    if (s_avx_supported)
+    {
+        matrix_transform_points_soa_avx(p_m_tr, p_xs, p_ys, p_zs, num_points, p_out_xs, p_out_ys, p_out_zs, p_out_ws_or_null);
+    }
+    else
+    {
+        matrix_transform_points_soa_sse2(p_m_tr, p_xs, p_ys, p_zs, num_points, p_out_xs, p_out_ys, p_out_zs, p_out_ws_or_null);
+    }
+}
+
+END_EXTERN_C
+
+#endif // TRANSFORM_H
\ No newline at end of file
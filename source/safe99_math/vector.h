@@ -4,6 +4,7 @@
 // 
 // 설명: SSE로 작성한 vector
 //       모든 벡터는 16바이트 정렬
+//       SSE2 명령만 사용 (내적은 dpps(SSE4.1) 대신 셔플 + 덧셈)
 // 
 // 작성자: bumpsgoodman
 // 
@@ -14,8 +15,6 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
-#include <intrin.h>
-
 #include "safe99_common/defines.h"
 
 #define TO_VECTOR(v) (*(vector_t*)(&v))
@@ -55,19 +54,28 @@ FORCEINLINE vector_t __vectorcall vector_mul_scalar(const vector_t v, const floa
     return _mm_mul_ps(v, _mm_set_ps1(scalar));
 }
 
+// 4성분 내적을 모든 성분에 채움
+FORCEINLINE vector_t __vectorcall vector_dot4(const vector_t v0, const vector_t v1)
+{
+    vector_t result = _mm_mul_ps(v0, v1);
+    result = _mm_add_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(2, 3, 0, 1)));
+    result = _mm_add_ps(result, _mm_shuffle_ps(result, result, _MM_SHUFFLE(1, 0, 3, 2)));
+    return result;
+}
+
 FORCEINLINE float __vectorcall vector_get_length(const vector_t v)
 {
-    return _mm_cvtss_f32(_mm_sqrt_ps(_mm_dp_ps(v, v, 0xff)));
+    return _mm_cvtss_f32(_mm_sqrt_ss(vector_dot4(v, v)));
 }
 
 FORCEINLINE float __vectorcall vector_get_length_sqaured(const vector_t v)
 {
-    return _mm_cvtss_f32(_mm_dp_ps(v, v, 0xff));
+    return _mm_cvtss_f32(vector_dot4(v, v));
 }
 
 FORCEINLINE vector_t __vectorcall vector_get_norm(const vector_t v)
 {
-    return _mm_mul_ps(v, _mm_rsqrt_ps(_mm_dp_ps(v, v, 0xff)));
+    return _mm_mul_ps(v, _mm_rsqrt_ps(vector_dot4(v, v)));
 }
 
 FORCEINLINE float __vectorcall vector_get_x(const vector_t v)
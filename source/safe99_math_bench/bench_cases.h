@@ -0,0 +1,31 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_cases.h
+// 
+// 설명: safe99_math 벤치마크 항목
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#ifndef BENCH_CASES_H
+#define BENCH_CASES_H
+
+#include "bench.h"
+
+START_EXTERN_C
+
+// 행렬 곱, 행렬 x 벡터, 정규화 (SSE2 / dpps / 스칼라)
+void run_math_benchmarks(bench_t* p_bench);
+
+// SoA 정점 배열 변환 (정점마다 matrix_mul_vector / 스칼라 / SSE2 / AVX)
+void run_transform_benchmarks(bench_t* p_bench);
+
+// 색상 배열 변환, 프레임 버퍼 채우기 (GB/s)
+void run_color_benchmarks(bench_t* p_bench);
+
+END_EXTERN_C
+
+#endif // BENCH_CASES_H
\ No newline at end of file
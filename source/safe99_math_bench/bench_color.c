@@ -0,0 +1,482 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_color.c
+// 
+// 설명: 색상 변환과 프레임 버퍼 채우기 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// - color_convert: color_to_argb/argb_to_color 반복 vs SSE2 배열 변환
+// - clear: 기존 경로 (ARGB -> color_t -> ARGB 후 스칼라 루프) vs fill_argb 일반/스트리밍 저장
+//   해상도별로 GB/s를 함께 기록
+// - palette_expand: 팔레트 인덱스 -> ARGB 스칼라 vs SSSE3, 32비트 memcpy 기준
+// - scale_nearest: 스프라이트 시트 크기 비트맵 2/3/4배 최근접 확대 스칼라 vs SSE2
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_math/color.h"
+#include "safe99_soft_renderer/argb_fill.h"
+#include "safe99_soft_renderer/argb_scale.h"
+#include "safe99_soft_renderer/palette_expand.h"
+#include "bench_cases.h"
+
+#define NUM_COLORS 4096
+#define CLEAR_ARGB 0xffc6c6c6
+
+// 보드 한 줄 (타일 30개 * 16픽셀)부터 256x256 보드 전체까지
+#define NUM_MAX_PALETTE_PIXELS (256 * 256 * 16 * 16)
+
+// 타일 시트 (8 x 2 타일)
+#define SCALE_SRC_WIDTH 128
+#define SCALE_SRC_HEIGHT 32
+#define NUM_MAX_SCALE 4
+
+typedef struct color_context
+{
+    color_t* pa_colors;
+    uint32_t* pa_argbs;
+
+    color_t* pa_out_colors;
+    uint32_t* pa_out_argbs;
+} color_context_t;
+
+typedef struct clear_context
+{
+    uint32_t* pa_buffer;
+    size_t num_pixels;
+} clear_context_t;
+
+typedef struct clear_case
+{
+    const char* impl;
+    bench_func pf_run;
+} clear_case_t;
+
+typedef struct palette_context
+{
+    palette_t palette;
+
+    uint8_t* pa_indices;
+    uint32_t* pa_source_pixels;
+    uint32_t* pa_pixels;
+    size_t num_pixels;
+} palette_context_t;
+
+typedef struct scale_context
+{
+    uint32_t* pa_src;
+    uint32_t* pa_dst;
+    uint32_t* pa_expected;
+    int scale;
+} scale_context_t;
+
+typedef struct resolution
+{
+    size_t width;
+    size_t height;
+} resolution_t;
+
+// 게임 기본 창 크기 수준부터 4K까지
+static const resolution_t s_resolutions[] =
+{
+    { 256, 256 },
+    { 1280, 720 },
+    { 1920, 1080 },
+    { 3840, 2160 }
+};
+
+static void run_color_to_argb_scalar(void* p_context);
+static void run_color_to_argb_sse2(void* p_context);
+static void run_argb_to_color_scalar(void* p_context);
+static void run_argb_to_color_sse2(void* p_context);
+
+static void run_clear_color(void* p_context);
+static void run_clear_cached(void* p_context);
+static void run_clear_stream(void* p_context);
+static void run_clear_auto(void* p_context);
+
+static void run_palette_expand_scalar(void* p_context);
+static void run_palette_expand_ssse3(void* p_context);
+static void run_palette_copy_argb(void* p_context);
+
+static void run_scale_nearest_scalar(void* p_context);
+static void run_scale_nearest_sse2(void* p_context);
+
+static const size_t s_palette_pixel_counts[] = { 30 * 16, 64 * 64 * 16, NUM_MAX_PALETTE_PIXELS };
+
+static const clear_case_t s_clear_cases[] =
+{
+    { "color", run_clear_color },
+    { "cached", run_clear_cached },
+    { "stream", run_clear_stream },
+    { "auto", run_clear_auto }
+};
+
+void run_color_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    // 변환
+    {
+        color_context_t context;
+        context.pa_colors = (color_t*)malloc(sizeof(color_t) * NUM_COLORS);
+        context.pa_argbs = (uint32_t*)malloc(sizeof(uint32_t) * NUM_COLORS);
+        context.pa_out_colors = (color_t*)malloc(sizeof(color_t) * NUM_COLORS);
+        context.pa_out_argbs = (uint32_t*)malloc(sizeof(uint32_t) * NUM_COLORS);
+        if (context.pa_colors == NULL || context.pa_argbs == NULL
+            || context.pa_out_colors == NULL || context.pa_out_argbs == NULL)
+        {
+            ASSERT(false, "Failed to malloc color context");
+            goto exit_convert;
+        }
+
+        srand(BENCH_SEED);
+        for (size_t i = 0; i < NUM_COLORS; ++i)
+        {
+            context.pa_argbs[i] = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+            context.pa_colors[i] = argb_to_color(context.pa_argbs[i]);
+        }
+
+        bench_run(p_bench, "color_to_argb", "\"impl\": \"scalar\"", NULL, run_color_to_argb_scalar, &context, NUM_COLORS, NULL);
+        bench_run(p_bench, "color_to_argb", "\"impl\": \"sse2\"", NULL, run_color_to_argb_sse2, &context, NUM_COLORS, NULL);
+        bench_run(p_bench, "argb_to_color", "\"impl\": \"scalar\"", NULL, run_argb_to_color_scalar, &context, NUM_COLORS, NULL);
+        bench_run(p_bench, "argb_to_color", "\"impl\": \"sse2\"", NULL, run_argb_to_color_sse2, &context, NUM_COLORS, NULL);
+
+        // 배열 변환이 스칼라와 같은 값을 내는지
+        size_t num_argb_mismatches = 0;
+        size_t num_color_mismatches = 0;
+
+        colors_to_argbs(context.pa_colors, context.pa_out_argbs, NUM_COLORS);
+        argbs_to_colors(context.pa_argbs, context.pa_out_colors, NUM_COLORS);
+        for (size_t i = 0; i < NUM_COLORS; ++i)
+        {
+            if (context.pa_out_argbs[i] != color_to_argb(context.pa_colors[i]))
+            {
+                ++num_argb_mismatches;
+            }
+
+            const color_t expected = argb_to_color(context.pa_argbs[i]);
+            if (memcmp(&context.pa_out_colors[i], &expected, sizeof(color_t)) != 0)
+            {
+                ++num_color_mismatches;
+            }
+        }
+
+        char metrics[128];
+        snprintf(metrics, sizeof(metrics), "\"color_to_argb_mismatches\": %zu, \"argb_to_color_mismatches\": %zu",
+                 num_argb_mismatches, num_color_mismatches);
+        bench_report(p_bench, "color_convert_check", "\"impl\": \"sse2\"", metrics);
+
+    exit_convert:
+        SAFE_FREE(context.pa_out_argbs);
+        SAFE_FREE(context.pa_out_colors);
+        SAFE_FREE(context.pa_argbs);
+        SAFE_FREE(context.pa_colors);
+    }
+
+    // 채우기
+    for (size_t i = 0; i < sizeof(s_resolutions) / sizeof(s_resolutions[0]); ++i)
+    {
+        clear_context_t context;
+        context.num_pixels = s_resolutions[i].width * s_resolutions[i].height;
+        context.pa_buffer = (uint32_t*)malloc(sizeof(uint32_t) * context.num_pixels);
+        if (context.pa_buffer == NULL)
+        {
+            ASSERT(false, "Failed to malloc clear buffer");
+            continue;
+        }
+
+        for (size_t j = 0; j < sizeof(s_clear_cases) / sizeof(s_clear_cases[0]); ++j)
+        {
+            char params[96];
+            snprintf(params, sizeof(params), "\"impl\": \"%s\", \"width\": %zu, \"height\": %zu",
+                     s_clear_cases[j].impl, s_resolutions[i].width, s_resolutions[i].height);
+
+            bench_result_t result;
+            if (!bench_run(p_bench, "clear", params, NULL, s_clear_cases[j].pf_run, &context, context.num_pixels, &result))
+            {
+                continue;
+            }
+
+            // ns/pixel -> GB/s
+            char metrics[64];
+            snprintf(metrics, sizeof(metrics), "\"gb_per_s\": %.3f",
+                     (result.ns_per_op > 0.0) ? (double)sizeof(uint32_t) / result.ns_per_op : 0.0);
+            bench_report(p_bench, "clear_gbps", params, metrics);
+        }
+
+        SAFE_FREE(context.pa_buffer);
+    }
+
+    // 팔레트 확장
+    {
+        palette_context_t context;
+        context.pa_indices = (uint8_t*)malloc(NUM_MAX_PALETTE_PIXELS);
+        context.pa_source_pixels = (uint32_t*)malloc(sizeof(uint32_t) * NUM_MAX_PALETTE_PIXELS);
+        context.pa_pixels = (uint32_t*)malloc(sizeof(uint32_t) * NUM_MAX_PALETTE_PIXELS);
+        if (context.pa_indices == NULL || context.pa_source_pixels == NULL || context.pa_pixels == NULL)
+        {
+            ASSERT(false, "Failed to malloc palette context");
+            goto exit_palette;
+        }
+
+        uint32_t colors[PALETTE_NUM_MAX_COLORS];
+        srand(BENCH_SEED);
+        for (size_t i = 0; i < PALETTE_NUM_MAX_COLORS; ++i)
+        {
+            colors[i] = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        }
+        palette_set_colors(&context.palette, colors, PALETTE_NUM_MAX_COLORS);
+
+        for (size_t i = 0; i < NUM_MAX_PALETTE_PIXELS; ++i)
+        {
+            context.pa_indices[i] = (uint8_t)(rand() % PALETTE_NUM_MAX_COLORS);
+            context.pa_source_pixels[i] = colors[context.pa_indices[i]];
+        }
+
+        const bool b_ssse3 = palette_is_ssse3_supported();
+
+        for (size_t i = 0; i < sizeof(s_palette_pixel_counts) / sizeof(s_palette_pixel_counts[0]); ++i)
+        {
+            context.num_pixels = s_palette_pixel_counts[i];
+
+            char params[64];
+            snprintf(params, sizeof(params), "\"impl\": \"scalar\", \"pixels\": %zu", context.num_pixels);
+            bench_run(p_bench, "palette_expand", params, NULL, run_palette_expand_scalar, &context, context.num_pixels, NULL);
+
+            if (b_ssse3)
+            {
+                snprintf(params, sizeof(params), "\"impl\": \"ssse3\", \"pixels\": %zu", context.num_pixels);
+                bench_run(p_bench, "palette_expand", params, NULL, run_palette_expand_ssse3, &context, context.num_pixels, NULL);
+            }
+
+            // ARGB 타일을 그대로 복사하는 기존 경로의 하한
+            snprintf(params, sizeof(params), "\"impl\": \"copy_argb\", \"pixels\": %zu", context.num_pixels);
+            bench_run(p_bench, "palette_expand", params, NULL, run_palette_copy_argb, &context, context.num_pixels, NULL);
+        }
+
+        // SSSE3 결과가 스칼라와 같은지 (길이가 16의 배수가 아닌 꼬리 포함)
+        size_t num_mismatches = 0;
+        if (b_ssse3)
+        {
+            const size_t count = NUM_MAX_PALETTE_PIXELS - 7;
+            palette_expand_ssse3(&context.palette, context.pa_indices, context.pa_pixels, count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (context.pa_pixels[i] != context.pa_source_pixels[i])
+                {
+                    ++num_mismatches;
+                }
+            }
+        }
+
+        char metrics[64];
+        snprintf(metrics, sizeof(metrics), "\"mismatches\": %zu, \"ssse3\": %s", num_mismatches, b_ssse3 ? "true" : "false");
+        bench_report(p_bench, "palette_expand_check", "\"impl\": \"ssse3\"", metrics);
+
+    exit_palette:
+        SAFE_FREE(context.pa_pixels);
+        SAFE_FREE(context.pa_source_pixels);
+        SAFE_FREE(context.pa_indices);
+    }
+
+    // 확대
+    {
+        const size_t num_max_dst_pixels = (size_t)SCALE_SRC_WIDTH * SCALE_SRC_HEIGHT * NUM_MAX_SCALE * NUM_MAX_SCALE;
+
+        scale_context_t context;
+        context.pa_src = (uint32_t*)malloc(sizeof(uint32_t) * SCALE_SRC_WIDTH * SCALE_SRC_HEIGHT);
+        context.pa_dst = (uint32_t*)malloc(sizeof(uint32_t) * num_max_dst_pixels);
+        context.pa_expected = (uint32_t*)malloc(sizeof(uint32_t) * num_max_dst_pixels);
+        if (context.pa_src == NULL || context.pa_dst == NULL || context.pa_expected == NULL)
+        {
+            ASSERT(false, "Failed to malloc scale context");
+            goto exit_scale;
+        }
+
+        srand(BENCH_SEED);
+        for (size_t i = 0; i < (size_t)SCALE_SRC_WIDTH * SCALE_SRC_HEIGHT; ++i)
+        {
+            context.pa_src[i] = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        }
+
+        size_t num_mismatches = 0;
+        for (int scale = 2; scale <= NUM_MAX_SCALE; ++scale)
+        {
+            context.scale = scale;
+
+            const size_t num_dst_pixels = (size_t)SCALE_SRC_WIDTH * SCALE_SRC_HEIGHT * scale * scale;
+
+            char params[64];
+            snprintf(params, sizeof(params), "\"impl\": \"scalar\", \"scale\": %d", scale);
+            bench_run(p_bench, "scale_nearest", params, NULL, run_scale_nearest_scalar, &context, num_dst_pixels, NULL);
+            snprintf(params, sizeof(params), "\"impl\": \"sse2\", \"scale\": %d", scale);
+            bench_run(p_bench, "scale_nearest", params, NULL, run_scale_nearest_sse2, &context, num_dst_pixels, NULL);
+
+            // SSE2 결과가 스칼라와 같은지
+            run_scale_nearest_scalar(&context);
+            memcpy(context.pa_expected, context.pa_dst, sizeof(uint32_t) * num_dst_pixels);
+            run_scale_nearest_sse2(&context);
+            for (size_t i = 0; i < num_dst_pixels; ++i)
+            {
+                if (context.pa_dst[i] != context.pa_expected[i])
+                {
+                    ++num_mismatches;
+                }
+            }
+        }
+
+        char metrics[32];
+        snprintf(metrics, sizeof(metrics), "\"mismatches\": %zu", num_mismatches);
+        bench_report(p_bench, "scale_nearest_check", "\"impl\": \"sse2\"", metrics);
+
+    exit_scale:
+        SAFE_FREE(context.pa_expected);
+        SAFE_FREE(context.pa_dst);
+        SAFE_FREE(context.pa_src);
+    }
+}
+
+static void run_color_to_argb_scalar(void* p_context)
+{
+    color_context_t* p_color_context = (color_context_t*)p_context;
+
+    for (size_t i = 0; i < NUM_COLORS; ++i)
+    {
+        p_color_context->pa_out_argbs[i] = color_to_argb(p_color_context->pa_colors[i]);
+    }
+
+    bench_do_not_optimize(p_color_context->pa_out_argbs);
+}
+
+static void run_color_to_argb_sse2(void* p_context)
+{
+    color_context_t* p_color_context = (color_context_t*)p_context;
+
+    colors_to_argbs(p_color_context->pa_colors, p_color_context->pa_out_argbs, NUM_COLORS);
+
+    bench_do_not_optimize(p_color_context->pa_out_argbs);
+}
+
+static void run_argb_to_color_scalar(void* p_context)
+{
+    color_context_t* p_color_context = (color_context_t*)p_context;
+
+    for (size_t i = 0; i < NUM_COLORS; ++i)
+    {
+        p_color_context->pa_out_colors[i] = argb_to_color(p_color_context->pa_argbs[i]);
+    }
+
+    bench_do_not_optimize(p_color_context->pa_out_colors);
+}
+
+static void run_argb_to_color_sse2(void* p_context)
+{
+    color_context_t* p_color_context = (color_context_t*)p_context;
+
+    argbs_to_colors(p_color_context->pa_argbs, p_color_context->pa_out_colors, NUM_COLORS);
+
+    bench_do_not_optimize(p_color_context->pa_out_colors);
+}
+
+// draw()가 clear(argb_to_color(...))를 호출하고 렌더러가 다시 ARGB로 바꿔 채우던 경로
+static void run_clear_color(void* p_context)
+{
+    clear_context_t* p_clear_context = (clear_context_t*)p_context;
+
+    const color_t color = argb_to_color(CLEAR_ARGB);
+    bench_do_not_optimize(&color);
+
+    const uint32_t argb = color_to_argb(color);
+    for (size_t i = 0; i < p_clear_context->num_pixels; ++i)
+    {
+        p_clear_context->pa_buffer[i] = argb;
+    }
+
+    bench_do_not_optimize(p_clear_context->pa_buffer);
+}
+
+static void run_clear_cached(void* p_context)
+{
+    clear_context_t* p_clear_context = (clear_context_t*)p_context;
+
+    fill_argb_cached(p_clear_context->pa_buffer, p_clear_context->num_pixels, CLEAR_ARGB);
+
+    bench_do_not_optimize(p_clear_context->pa_buffer);
+}
+
+static void run_clear_stream(void* p_context)
+{
+    clear_context_t* p_clear_context = (clear_context_t*)p_context;
+
+    fill_argb_stream(p_clear_context->pa_buffer, p_clear_context->num_pixels, CLEAR_ARGB);
+
+    bench_do_not_optimize(p_clear_context->pa_buffer);
+}
+
+static void run_clear_auto(void* p_context)
+{
+    clear_context_t* p_clear_context = (clear_context_t*)p_context;
+
+    fill_argb(p_clear_context->pa_buffer, p_clear_context->num_pixels, CLEAR_ARGB);
+
+    bench_do_not_optimize(p_clear_context->pa_buffer);
+}
+
+static void run_palette_expand_scalar(void* p_context)
+{
+    palette_context_t* p_palette_context = (palette_context_t*)p_context;
+
+    palette_expand_scalar(&p_palette_context->palette, p_palette_context->pa_indices,
+                          p_palette_context->pa_pixels, p_palette_context->num_pixels);
+
+    bench_do_not_optimize(p_palette_context->pa_pixels);
+}
+
+static void run_palette_expand_ssse3(void* p_context)
+{
+    palette_context_t* p_palette_context = (palette_context_t*)p_context;
+
+    palette_expand_ssse3(&p_palette_context->palette, p_palette_context->pa_indices,
+                         p_palette_context->pa_pixels, p_palette_context->num_pixels);
+
+    bench_do_not_optimize(p_palette_context->pa_pixels);
+}
+
+static void run_palette_copy_argb(void* p_context)
+{
+    palette_context_t* p_palette_context = (palette_context_t*)p_context;
+
+    memcpy(p_palette_context->pa_pixels, p_palette_context->pa_source_pixels, sizeof(uint32_t) * p_palette_context->num_pixels);
+
+    bench_do_not_optimize(p_palette_context->pa_pixels);
+}
+
+static void run_scale_nearest_scalar(void* p_context)
+{
+    scale_context_t* p_scale_context = (scale_context_t*)p_context;
+
+    const size_t dst_width = (size_t)SCALE_SRC_WIDTH * p_scale_context->scale;
+    for (size_t y = 0; y < SCALE_SRC_HEIGHT * (size_t)p_scale_context->scale; ++y)
+    {
+        scale_argb_row_nearest_scalar(p_scale_context->pa_src + (y / p_scale_context->scale) * SCALE_SRC_WIDTH,
+                                      p_scale_context->pa_dst + y * dst_width, SCALE_SRC_WIDTH, p_scale_context->scale);
+    }
+
+    bench_do_not_optimize(p_scale_context->pa_dst);
+}
+
+static void run_scale_nearest_sse2(void* p_context)
+{
+    scale_context_t* p_scale_context = (scale_context_t*)p_context;
+
+    scale_argb_nearest(p_scale_context->pa_src, SCALE_SRC_WIDTH, SCALE_SRC_HEIGHT, p_scale_context->pa_dst, p_scale_context->scale);
+
+    bench_do_not_optimize(p_scale_context->pa_dst);
+}
\ No newline at end of file
@@ -0,0 +1,370 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_math.c
+// 
+// 설명: safe99_math 벡터/행렬 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// matrix_mul, matrix_mul_vector, vector_get_norm을 배열 단위로 측정
+// - sse2: safe99_math 구현 (MSVC, GCC, Clang 모두 SSE2 명령만 생성)
+// - dpps: 이전 SSE4.1 _mm_dp_ps 구현 (SSE4.1로 컴파일한 경우만)
+// - scalar: 스칼라 참조 구현
+// 정확도는 double 참조 대비 최대 절대 오차로 기록 (vector_get_norm은 rsqrt 근사 포함)
+// 
+//***************************************************************************
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_math/matrix.h"
+#include "safe99_math/vector.h"
+#include "bench_cases.h"
+
+#define NUM_ELEMENTS 1024
+
+#if defined(__SSE4_1__) || defined(__AVX__)
+#define SUPPORT_DPPS
+#endif // __SSE4_1__
+
+typedef struct math_context
+{
+    matrix_t* pa_matrices;
+    matrix_t* pa_matrices_tr;
+    vector_t* pa_vectors;
+
+    matrix_t* pa_out_matrices;
+    vector_t* pa_out_vectors;
+} math_context_t;
+
+typedef struct math_case
+{
+    const char* name;
+    const char* impl;
+    bench_func pf_run;
+} math_case_t;
+
+static float get_random_float(void);
+static double get_max_error(const float* p_values, const double* p_expected, const size_t count);
+
+static void run_matrix_mul_sse2(void* p_context);
+static void run_matrix_mul_scalar(void* p_context);
+static void run_matrix_mul_vector_sse2(void* p_context);
+static void run_matrix_mul_vector_scalar(void* p_context);
+static void run_vector_get_norm_sse2(void* p_context);
+static void run_vector_get_norm_scalar(void* p_context);
+
+#if defined(SUPPORT_DPPS)
+static void run_matrix_mul_dpps(void* p_context);
+static void run_matrix_mul_vector_dpps(void* p_context);
+static void run_vector_get_norm_dpps(void* p_context);
+#endif // SUPPORT_DPPS
+
+static const math_case_t s_cases[] =
+{
+    { "matrix_mul", "sse2", run_matrix_mul_sse2 },
+    { "matrix_mul", "scalar", run_matrix_mul_scalar },
+    { "matrix_mul_vector", "sse2", run_matrix_mul_vector_sse2 },
+    { "matrix_mul_vector", "scalar", run_matrix_mul_vector_scalar },
+    { "vector_get_norm", "sse2", run_vector_get_norm_sse2 },
+    { "vector_get_norm", "scalar", run_vector_get_norm_scalar },
+#if defined(SUPPORT_DPPS)
+    { "matrix_mul", "dpps", run_matrix_mul_dpps },
+    { "matrix_mul_vector", "dpps", run_matrix_mul_vector_dpps },
+    { "vector_get_norm", "dpps", run_vector_get_norm_dpps },
+#endif // SUPPORT_DPPS
+};
+
+void run_math_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    math_context_t context;
+    context.pa_matrices = (matrix_t*)malloc(sizeof(matrix_t) * NUM_ELEMENTS);
+    context.pa_matrices_tr = (matrix_t*)malloc(sizeof(matrix_t) * NUM_ELEMENTS);
+    context.pa_vectors = (vector_t*)malloc(sizeof(vector_t) * NUM_ELEMENTS);
+    context.pa_out_matrices = (matrix_t*)malloc(sizeof(matrix_t) * NUM_ELEMENTS);
+    context.pa_out_vectors = (vector_t*)malloc(sizeof(vector_t) * NUM_ELEMENTS);
+    if (context.pa_matrices == NULL || context.pa_matrices_tr == NULL || context.pa_vectors == NULL
+        || context.pa_out_matrices == NULL || context.pa_out_vectors == NULL)
+    {
+        ASSERT(false, "Failed to malloc math context");
+        goto exit;
+    }
+
+    srand(BENCH_SEED);
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i)
+    {
+        context.pa_matrices[i] = matrix_set(get_random_float(), get_random_float(), get_random_float(), get_random_float(),
+                                            get_random_float(), get_random_float(), get_random_float(), get_random_float(),
+                                            get_random_float(), get_random_float(), get_random_float(), get_random_float(),
+                                            get_random_float(), get_random_float(), get_random_float(), get_random_float());
+        context.pa_matrices_tr[i] = matrix_get_transpose(context.pa_matrices[(i * 7 + 3) % NUM_ELEMENTS]);
+        context.pa_vectors[i] = vector_set(get_random_float(), get_random_float(), get_random_float(), get_random_float());
+    }
+
+    for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); ++i)
+    {
+        char params[64];
+        snprintf(params, sizeof(params), "\"impl\": \"%s\"", s_cases[i].impl);
+        bench_run(p_bench, s_cases[i].name, params, NULL, s_cases[i].pf_run, &context, NUM_ELEMENTS, NULL);
+    }
+
+    // 정확도
+    {
+        double* pa_expected = (double*)malloc(sizeof(double) * 16 * NUM_ELEMENTS);
+        if (pa_expected == NULL)
+        {
+            ASSERT(false, "Failed to malloc expected");
+            goto exit;
+        }
+
+        for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+        {
+            const float* p_m0 = (const float*)&context.pa_matrices[n];
+            const float* p_m1_tr = (const float*)&context.pa_matrices_tr[n];
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    double sum = 0.0;
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        sum += (double)p_m0[i * 4 + k] * (double)p_m1_tr[j * 4 + k];
+                    }
+                    pa_expected[n * 16 + i * 4 + j] = sum;
+                }
+            }
+        }
+
+        run_matrix_mul_sse2(&context);
+        const double matrix_mul_error = get_max_error((const float*)context.pa_out_matrices, pa_expected, 16 * NUM_ELEMENTS);
+
+        for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+        {
+            const float* p_v = (const float*)&context.pa_vectors[n];
+            const float* p_m_tr = (const float*)&context.pa_matrices_tr[n];
+            for (size_t j = 0; j < 4; ++j)
+            {
+                double sum = 0.0;
+                for (size_t k = 0; k < 4; ++k)
+                {
+                    sum += (double)p_v[k] * (double)p_m_tr[j * 4 + k];
+                }
+                pa_expected[n * 4 + j] = sum;
+            }
+        }
+
+        run_matrix_mul_vector_sse2(&context);
+        const double matrix_mul_vector_error = get_max_error((const float*)context.pa_out_vectors, pa_expected, 4 * NUM_ELEMENTS);
+
+        for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+        {
+            const float* p_v = (const float*)&context.pa_vectors[n];
+            double length_squared = 0.0;
+            for (size_t k = 0; k < 4; ++k)
+            {
+                length_squared += (double)p_v[k] * (double)p_v[k];
+            }
+
+            for (size_t k = 0; k < 4; ++k)
+            {
+                pa_expected[n * 4 + k] = (double)p_v[k] / sqrt(length_squared);
+            }
+        }
+
+        run_vector_get_norm_sse2(&context);
+        const double vector_get_norm_error = get_max_error((const float*)context.pa_out_vectors, pa_expected, 4 * NUM_ELEMENTS);
+
+        char metrics[192];
+        snprintf(metrics, sizeof(metrics), "\"matrix_mul\": %.3e, \"matrix_mul_vector\": %.3e, \"vector_get_norm\": %.3e",
+                 matrix_mul_error, matrix_mul_vector_error, vector_get_norm_error);
+        bench_report(p_bench, "math_max_abs_error", "\"impl\": \"sse2\"", metrics);
+
+        free(pa_expected);
+    }
+
+exit:
+    SAFE_FREE(context.pa_out_vectors);
+    SAFE_FREE(context.pa_out_matrices);
+    SAFE_FREE(context.pa_vectors);
+    SAFE_FREE(context.pa_matrices_tr);
+    SAFE_FREE(context.pa_matrices);
+}
+
+// [-1, 1]
+static float get_random_float(void)
+{
+    return (float)rand() / (float)RAND_MAX * 2.0f - 1.0f;
+}
+
+static double get_max_error(const float* p_values, const double* p_expected, const size_t count)
+{
+    double max_error = 0.0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const double error = fabs((double)p_values[i] - p_expected[i]);
+        max_error = MAX(max_error, error);
+    }
+
+    return max_error;
+}
+
+static void run_matrix_mul_sse2(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i)
+    {
+        p_math_context->pa_out_matrices[i] = matrix_mul(p_math_context->pa_matrices[i], p_math_context->pa_matrices_tr[i]);
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_matrices);
+}
+
+static void run_matrix_mul_scalar(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+    {
+        const float* p_m0 = (const float*)&p_math_context->pa_matrices[n];
+        const float* p_m1_tr = (const float*)&p_math_context->pa_matrices_tr[n];
+        float* p_out = (float*)&p_math_context->pa_out_matrices[n];
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                p_out[i * 4 + j] = p_m0[i * 4 + 0] * p_m1_tr[j * 4 + 0]
+                    + p_m0[i * 4 + 1] * p_m1_tr[j * 4 + 1]
+                    + p_m0[i * 4 + 2] * p_m1_tr[j * 4 + 2]
+                    + p_m0[i * 4 + 3] * p_m1_tr[j * 4 + 3];
+            }
+        }
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_matrices);
+}
+
+static void run_matrix_mul_vector_sse2(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i)
+    {
+        p_math_context->pa_out_vectors[i] = matrix_mul_vector(p_math_context->pa_vectors[i], p_math_context->pa_matrices_tr[i]);
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_vectors);
+}
+
+static void run_matrix_mul_vector_scalar(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+    {
+        const float* p_v = (const float*)&p_math_context->pa_vectors[n];
+        const float* p_m_tr = (const float*)&p_math_context->pa_matrices_tr[n];
+        float* p_out = (float*)&p_math_context->pa_out_vectors[n];
+
+        for (size_t j = 0; j < 4; ++j)
+        {
+            p_out[j] = p_v[0] * p_m_tr[j * 4 + 0] + p_v[1] * p_m_tr[j * 4 + 1]
+                + p_v[2] * p_m_tr[j * 4 + 2] + p_v[3] * p_m_tr[j * 4 + 3];
+        }
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_vectors);
+}
+
+static void run_vector_get_norm_sse2(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t i = 0; i < NUM_ELEMENTS; ++i)
+    {
+        p_math_context->pa_out_vectors[i] = vector_get_norm(p_math_context->pa_vectors[i]);
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_vectors);
+}
+
+static void run_vector_get_norm_scalar(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+    {
+        const float* p_v = (const float*)&p_math_context->pa_vectors[n];
+        float* p_out = (float*)&p_math_context->pa_out_vectors[n];
+
+        const float inv_length = 1.0f / sqrtf(p_v[0] * p_v[0] + p_v[1] * p_v[1] + p_v[2] * p_v[2] + p_v[3] * p_v[3]);
+        for (size_t k = 0; k < 4; ++k)
+        {
+            p_out[k] = p_v[k] * inv_length;
+        }
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_vectors);
+}
+
+#if defined(SUPPORT_DPPS)
+static void run_matrix_mul_dpps(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+    {
+        const matrix_t m0 = p_math_context->pa_matrices[n];
+        const matrix_t m1_tr = p_math_context->pa_matrices_tr[n];
+        matrix_t* p_out = &p_math_context->pa_out_matrices[n];
+
+        for (size_t i = 0; i < 4; ++i)
+        {
+            p_out->r[i] = vector_set(_mm_cvtss_f32(_mm_dp_ps(m0.r[i], m1_tr.r0, 0xff)),
+                                     _mm_cvtss_f32(_mm_dp_ps(m0.r[i], m1_tr.r1, 0xff)),
+                                     _mm_cvtss_f32(_mm_dp_ps(m0.r[i], m1_tr.r2, 0xff)),
+                                     _mm_cvtss_f32(_mm_dp_ps(m0.r[i], m1_tr.r3, 0xff)));
+        }
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_matrices);
+}
+
+static void run_matrix_mul_vector_dpps(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+    {
+        const vector_t v = p_math_context->pa_vectors[n];
+        const matrix_t m_tr = p_math_context->pa_matrices_tr[n];
+
+        p_math_context->pa_out_vectors[n] = vector_set(_mm_cvtss_f32(_mm_dp_ps(v, m_tr.r0, 0xff)),
+                                                       _mm_cvtss_f32(_mm_dp_ps(v, m_tr.r1, 0xff)),
+                                                       _mm_cvtss_f32(_mm_dp_ps(v, m_tr.r2, 0xff)),
+                                                       _mm_cvtss_f32(_mm_dp_ps(v, m_tr.r3, 0xff)));
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_vectors);
+}
+
+static void run_vector_get_norm_dpps(void* p_context)
+{
+    math_context_t* p_math_context = (math_context_t*)p_context;
+
+    for (size_t n = 0; n < NUM_ELEMENTS; ++n)
+    {
+        const vector_t v = p_math_context->pa_vectors[n];
+        p_math_context->pa_out_vectors[n] = _mm_mul_ps(v, _mm_rsqrt_ps(_mm_dp_ps(v, v, 0xff)));
+    }
+
+    bench_do_not_optimize(p_math_context->pa_out_vectors);
+}
+#endif // SUPPORT_DPPS
\ No newline at end of file
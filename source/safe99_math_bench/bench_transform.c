@@ -0,0 +1,240 @@
+﻿//***************************************************************************
+// 
+// 파일: bench_transform.c
+// 
+// 설명: SoA 정점 배열 변환 벤치마크
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 정점 1K ~ 1M개를 변환
+// - per_vertex: AoS vector_t 배열에 정점마다 matrix_mul_vector() (기존 방식)
+// - soa_scalar, soa_sse2, soa_avx: matrix_transform_points_soa_* (soa_avx는 CPU가 지원할 때만)
+// 정확도는 per_vertex 결과 대비 최대 절대 오차로 기록
+// 
+//***************************************************************************
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_math/matrix.h"
+#include "safe99_math/transform.h"
+#include "bench_cases.h"
+
+typedef struct transform_context
+{
+    matrix_t m_tr;
+    size_t num_points;
+
+    vector_t* pa_points;
+    vector_t* pa_out_points;
+
+    float* pa_xs;
+    float* pa_ys;
+    float* pa_zs;
+    float* pa_out_xs;
+    float* pa_out_ys;
+    float* pa_out_zs;
+    float* pa_out_ws;
+} transform_context_t;
+
+typedef struct transform_case
+{
+    const char* impl;
+    bench_func pf_run;
+} transform_case_t;
+
+static const size_t s_num_points[] = { 1024, 16 * 1024, 256 * 1024, 1024 * 1024 };
+
+static float get_random_float(void);
+static double get_max_error(const transform_context_t* p_context);
+
+static void run_per_vertex(void* p_context);
+static void run_soa_scalar(void* p_context);
+static void run_soa_sse2(void* p_context);
+static void run_soa_avx(void* p_context);
+
+static const transform_case_t s_cases[] =
+{
+    { "per_vertex", run_per_vertex },
+    { "soa_scalar", run_soa_scalar },
+    { "soa_sse2", run_soa_sse2 },
+    { "soa_avx", run_soa_avx },
+};
+
+void run_transform_benchmarks(bench_t* p_bench)
+{
+    ASSERT(p_bench != NULL, "p_bench == NULL");
+
+    const size_t num_max_points = s_num_points[sizeof(s_num_points) / sizeof(s_num_points[0]) - 1];
+    const bool b_avx_supported = math_is_avx_supported();
+
+    transform_context_t context;
+    memset(&context, 0, sizeof(context));
+
+    context.pa_points = (vector_t*)malloc(sizeof(vector_t) * num_max_points);
+    context.pa_out_points = (vector_t*)malloc(sizeof(vector_t) * num_max_points);
+    context.pa_xs = (float*)malloc(sizeof(float) * num_max_points);
+    context.pa_ys = (float*)malloc(sizeof(float) * num_max_points);
+    context.pa_zs = (float*)malloc(sizeof(float) * num_max_points);
+    context.pa_out_xs = (float*)malloc(sizeof(float) * num_max_points);
+    context.pa_out_ys = (float*)malloc(sizeof(float) * num_max_points);
+    context.pa_out_zs = (float*)malloc(sizeof(float) * num_max_points);
+    context.pa_out_ws = (float*)malloc(sizeof(float) * num_max_points);
+    if (context.pa_points == NULL || context.pa_out_points == NULL
+        || context.pa_xs == NULL || context.pa_ys == NULL || context.pa_zs == NULL
+        || context.pa_out_xs == NULL || context.pa_out_ys == NULL || context.pa_out_zs == NULL || context.pa_out_ws == NULL)
+    {
+        ASSERT(false, "Failed to malloc transform context");
+        goto exit;
+    }
+
+    srand(BENCH_SEED);
+
+    // 원근 투영처럼 w 행이 0이 아닌 행렬
+    context.m_tr = matrix_set(get_random_float(), get_random_float(), get_random_float(), get_random_float(),
+                              get_random_float(), get_random_float(), get_random_float(), get_random_float(),
+                              get_random_float(), get_random_float(), get_random_float(), get_random_float(),
+                              0.0f, 0.0f, 1.0f, 0.0f);
+
+    for (size_t i = 0; i < num_max_points; ++i)
+    {
+        const float x = get_random_float() * 100.0f;
+        const float y = get_random_float() * 100.0f;
+        const float z = get_random_float() * 100.0f;
+
+        context.pa_points[i] = vector_set(x, y, z, 1.0f);
+        context.pa_xs[i] = x;
+        context.pa_ys[i] = y;
+        context.pa_zs[i] = z;
+    }
+
+    for (size_t n = 0; n < sizeof(s_num_points) / sizeof(s_num_points[0]); ++n)
+    {
+        context.num_points = s_num_points[n];
+
+        for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); ++i)
+        {
+            if (s_cases[i].pf_run == run_soa_avx && !b_avx_supported)
+            {
+                continue;
+            }
+
+            char params[64];
+            snprintf(params, sizeof(params), "\"impl\": \"%s\", \"vertices\": %zu", s_cases[i].impl, context.num_points);
+            bench_run(p_bench, "matrix_transform_points", params, NULL, s_cases[i].pf_run, &context, context.num_points, NULL);
+        }
+    }
+
+    // 정확도
+    context.num_points = num_max_points;
+    run_per_vertex(&context);
+
+    for (size_t i = 1; i < sizeof(s_cases) / sizeof(s_cases[0]); ++i)
+    {
+        if (s_cases[i].pf_run == run_soa_avx && !b_avx_supported)
+        {
+            continue;
+        }
+
+        s_cases[i].pf_run(&context);
+
+        char params[64];
+        snprintf(params, sizeof(params), "\"impl\": \"%s\"", s_cases[i].impl);
+
+        char metrics[64];
+        snprintf(metrics, sizeof(metrics), "\"max_abs_error\": %.3e", get_max_error(&context));
+        bench_report(p_bench, "matrix_transform_points_error", params, metrics);
+    }
+
+exit:
+    SAFE_FREE(context.pa_out_ws);
+    SAFE_FREE(context.pa_out_zs);
+    SAFE_FREE(context.pa_out_ys);
+    SAFE_FREE(context.pa_out_xs);
+    SAFE_FREE(context.pa_zs);
+    SAFE_FREE(context.pa_ys);
+    SAFE_FREE(context.pa_xs);
+    SAFE_FREE(context.pa_out_points);
+    SAFE_FREE(context.pa_points);
+}
+
+// [-1, 1]
+static float get_random_float(void)
+{
+    return (float)rand() / (float)RAND_MAX * 2.0f - 1.0f;
+}
+
+// per_vertex 결과 대비
+static double get_max_error(const transform_context_t* p_context)
+{
+    double max_error = 0.0;
+    for (size_t i = 0; i < p_context->num_points; ++i)
+    {
+        const float* p_expected = (const float*)&p_context->pa_out_points[i];
+        const float actual[4] = { p_context->pa_out_xs[i], p_context->pa_out_ys[i], p_context->pa_out_zs[i], p_context->pa_out_ws[i] };
+
+        for (size_t k = 0; k < 4; ++k)
+        {
+            const double error = fabs((double)actual[k] - (double)p_expected[k]);
+            max_error = MAX(max_error, error);
+        }
+    }
+
+    return max_error;
+}
+
+static void run_per_vertex(void* p_context)
+{
+    transform_context_t* p_transform_context = (transform_context_t*)p_context;
+    const matrix_t m_tr = p_transform_context->m_tr;
+
+    for (size_t i = 0; i < p_transform_context->num_points; ++i)
+    {
+        p_transform_context->pa_out_points[i] = matrix_mul_vector(p_transform_context->pa_points[i], m_tr);
+    }
+
+    bench_do_not_optimize(p_transform_context->pa_out_points);
+}
+
+static void run_soa_scalar(void* p_context)
+{
+    transform_context_t* p_transform_context = (transform_context_t*)p_context;
+
+    matrix_transform_points_soa_scalar(&p_transform_context->m_tr,
+                                       p_transform_context->pa_xs, p_transform_context->pa_ys, p_transform_context->pa_zs,
+                                       p_transform_context->num_points,
+                                       p_transform_context->pa_out_xs, p_transform_context->pa_out_ys,
+                                       p_transform_context->pa_out_zs, p_transform_context->pa_out_ws);
+
+    bench_do_not_optimize(p_transform_context->pa_out_ws);
+}
+
+static void run_soa_sse2(void* p_context)
+{
+    transform_context_t* p_transform_context = (transform_context_t*)p_context;
+
+    matrix_transform_points_soa_sse2(&p_transform_context->m_tr,
+                                     p_transform_context->pa_xs, p_transform_context->pa_ys, p_transform_context->pa_zs,
+                                     p_transform_context->num_points,
+                                     p_transform_context->pa_out_xs, p_transform_context->pa_out_ys,
+                                     p_transform_context->pa_out_zs, p_transform_context->pa_out_ws);
+
+    bench_do_not_optimize(p_transform_context->pa_out_ws);
+}
+
+static void run_soa_avx(void* p_context)
+{
+    transform_context_t* p_transform_context = (transform_context_t*)p_context;
+
+    matrix_transform_points_soa_avx(&p_transform_context->m_tr,
+                                    p_transform_context->pa_xs, p_transform_context->pa_ys, p_transform_context->pa_zs,
+                                    p_transform_context->num_points,
+                                    p_transform_context->pa_out_xs, p_transform_context->pa_out_ys,
+                                    p_transform_context->pa_out_zs, p_transform_context->pa_out_ws);
+
+    bench_do_not_optimize(p_transform_context->pa_out_ws);
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+﻿//***************************************************************************
+// 
+// 파일: main.c
+// 
+// 설명: safe99_math 벤치마크 main 함수
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 사용법: safe99_math_bench [--out file.json] [--warmups n] [--reps n] [--filter name]
+// 
+// safe99_math는 헤더만으로 이루어져 있으므로 Linux에서도 그대로 빌드됨
+//   gcc -O2 -I source -I source/safe99_math_bench -I source/minesweeper_bench
+//       source/minesweeper_bench/bench.c source/safe99_math_bench/*.c -lm -o safe99_math_bench
+// MSVC와 같은 SSE2 코드로 측정하려면 -march를 주지 않음 (x64 기본값이 SSE2)
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "safe99_math/math_misc.h"
+#include "bench.h"
+#include "bench_cases.h"
+
+int main(int argc, char** argv)
+{
+    const char* out_filename = NULL;
+    const char* filter = NULL;
+    size_t num_warmups = BENCH_DEFAULT_NUM_WARMUPS;
+    size_t num_repetitions = BENCH_DEFAULT_NUM_REPETITIONS;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool b_has_value = (i + 1 < argc);
+
+        if (strcmp(argv[i], "--out") == 0 && b_has_value)
+        {
+            out_filename = argv[++i];
+        }
+        else if (strcmp(argv[i], "--warmups") == 0 && b_has_value)
+        {
+            num_warmups = (size_t)atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--reps") == 0 && b_has_value)
+        {
+            // MAX는 인자를 두 번 평가하므로 ++i를 밖에서
+            const int num_reps = atoi(argv[++i]);
+            num_repetitions = (size_t)MAX(1, num_reps);
+        }
+        else if (strcmp(argv[i], "--filter") == 0 && b_has_value)
+        {
+            filter = argv[++i];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [--out file.json] [--warmups n] [--reps n] [--filter name]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    bench_t bench;
+    if (!bench_init(&bench, out_filename, num_warmups, num_repetitions, filter))
+    {
+        fprintf(stderr, "Failed to open %s\n", out_filename);
+        return 1;
+    }
+
+    run_math_benchmarks(&bench);
+    run_transform_benchmarks(&bench);
+    run_color_benchmarks(&bench);
+
+    bench_shutdown(&bench);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+﻿//***************************************************************************
+// 
+// 파일: argb_fill.h
+// 
+// 설명: ARGB 정수 색상으로 프레임 버퍼 채우기
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// clear(color_t)는 float 색상을 다시 ARGB로 바꿔서 채우므로
+// 렌더러 구현이 정수 색상을 바로 채울 수 있도록 헤더로 제공
+// 버퍼가 ARGB_FILL_STREAM_MIN_BYTES 이상이면 캐시를 거치지 않는 스트리밍 저장 사용
+// (작은 버퍼는 곧 다시 읽으므로 캐시에 남기는 편이 빠름)
+// 
+// safe99_soft_renderer는 미리 빌드된 DLL이라 i_soft_renderer_t에 함수를 추가하면
+// vtbl 배치가 달라지므로 인터페이스는 그대로 두고 헤더 함수로 구현
+// 
+//***************************************************************************
+
+#ifndef ARGB_FILL_H
+#define ARGB_FILL_H
+
+#include "safe99_common/defines.h"
+#include "safe99_math/math_misc.h"
+
+#define ARGB_FILL_STREAM_MIN_BYTES (1024 * 1024)
+
+START_EXTERN_C
+
+// 항상 일반 저장 (캐시에 남음)
+FORCEINLINE void fill_argb_cached(uint32_t* p_dst, const size_t count, const uint32_t argb)
+{
+    ASSERT(p_dst != NULL || count == 0, "p_dst == NULL");
+
+    const __m128i value = _mm_set1_epi32((int)argb);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        _mm_storeu_si128((__m128i*)(p_dst + i), value);
+    }
+
+    for (; i < count; ++i)
+    {
+        p_dst[i] = argb;
+    }
+}
+
+// 항상 스트리밍 저장 (캐시를 거치지 않음)
+FORCEINLINE void fill_argb_stream(uint32_t* p_dst, const size_t count, const uint32_t argb)
+{
+    ASSERT(p_dst != NULL || count == 0, "p_dst == NULL");
+
+    const __m128i value = _mm_set1_epi32((int)argb);
+
+    // _mm_stream_si128은 16바이트 정렬 필요
+    size_t i = 0;
+    for (; i < count && ((uintptr_t)(p_dst + i) & 15) != 0; ++i)
+    {
+        p_dst[i] = argb;
+    }
+
+    // 캐시 라인(64바이트) 단위
+    for (; i + 16 <= count; i += 16)
+    {
+        _mm_stream_si128((__m128i*)(p_dst + i + 0), value);
+        _mm_stream_si128((__m128i*)(p_dst + i + 4), value);
+        _mm_stream_si128((__m128i*)(p_dst + i + 8), value);
+        _mm_stream_si128((__m128i*)(p_dst + i + 12), value);
+    }
+
+    for (; i < count; ++i)
+    {
+        p_dst[i] = argb;
+    }
+
+    // 이후 읽는 쪽(화면 출력)이 채운 값을 보도록
+    _mm_sfence();
+}
+
+// 버퍼 크기에 따라 스트리밍/일반 저장 선택
+FORCEINLINE void fill_argb(uint32_t* p_dst, const size_t count, const uint32_t argb)
+{
+    if (count * sizeof(uint32_t) >= ARGB_FILL_STREAM_MIN_BYTES)
+    {
+        fill_argb_stream(p_dst, count, argb);
+    }
+    else
+    {
+        fill_argb_cached(p_dst, count, argb);
+    }
+}
+
+// 버퍼 밖으로 나가는 부분은 잘라냄
+FORCEINLINE void fill_rect_argb(uint32_t* p_buffer, const size_t buffer_width, const size_t buffer_height,
+                                const int x, const int y, const size_t width, const size_t height,
+                                const uint32_t argb)
+{
+    ASSERT(p_buffer != NULL, "p_buffer == NULL");
+
+    const int64_t left = MAX((int64_t)x, 0);
+    const int64_t top = MAX((int64_t)y, 0);
+    const int64_t right = MIN((int64_t)x + (int64_t)width, (int64_t)buffer_width);
+    const int64_t bottom = MIN((int64_t)y + (int64_t)height, (int64_t)buffer_height);
+    if (left >= right || top >= bottom)
+    {
+        return;
+    }
+
+    // 버퍼 전체 너비면 한 번에
+    if (left == 0 && right == (int64_t)buffer_width)
+    {
+        fill_argb(p_buffer + top * buffer_width, (size_t)((bottom - top) * right), argb);
+        return;
+    }
+
+    for (int64_t row = top; row < bottom; ++row)
+    {
+        fill_argb_cached(p_buffer + row * buffer_width + left, (size_t)(right - left), argb);
+    }
+}
+
+END_EXTERN_C
+
+#endif // ARGB_FILL_H
\ No newline at end of file
@@ -0,0 +1,112 @@
+﻿//***************************************************************************
+// 
+// 파일: argb_scale.h
+// 
+// 설명: ARGB 비트맵 정수배 최근접 확대
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 로드 시점에 스프라이트를 한 번만 확대해 두는 용도 (프레임마다 호출하지 않음)
+// - 가로: 2/3/4배는 SSE2 셔플로 픽셀 4개를 8/12/16개로 늘림, 그 외 배율은 스칼라
+// - 세로: 확대한 첫 줄을 나머지 scale - 1줄에 memcpy
+// 
+//***************************************************************************
+
+#ifndef ARGB_SCALE_H
+#define ARGB_SCALE_H
+
+#include <string.h>
+
+#include "safe99_common/defines.h"
+
+START_EXTERN_C
+
+FORCEINLINE void scale_argb_row_nearest_scalar(const uint32_t* p_src, uint32_t* p_dst, const size_t width, const int scale)
+{
+    ASSERT(p_src != NULL, "p_src == NULL");
+    ASSERT(p_dst != NULL, "p_dst == NULL");
+    ASSERT(scale >= 1, "scale < 1");
+
+    for (size_t i = 0; i < width; ++i)
+    {
+        for (int j = 0; j < scale; ++j)
+        {
+            *p_dst++ = p_src[i];
+        }
+    }
+}
+
+// 2/3/4배가 아니면 스칼라
+static INLINE void scale_argb_row_nearest_sse2(const uint32_t* p_src, uint32_t* p_dst, const size_t width, const int scale)
+{
+    ASSERT(p_src != NULL, "p_src == NULL");
+    ASSERT(p_dst != NULL, "p_dst == NULL");
+
+    const size_t num_vector_pixels = width & ~(size_t)3;
+
+    size_t i = 0;
+    switch (scale)
+    {
+    case 2:
+        for (; i < num_vector_pixels; i += 4)
+        {
+            const __m128i pixels = _mm_loadu_si128((const __m128i*)(p_src + i));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 2 + 0), _mm_unpacklo_epi32(pixels, pixels));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 2 + 4), _mm_unpackhi_epi32(pixels, pixels));
+        }
+        break;
+    case 3:
+        // (0 0 0 1) (1 1 2 2) (2 3 3 3)
+        for (; i < num_vector_pixels; i += 4)
+        {
+            const __m128i pixels = _mm_loadu_si128((const __m128i*)(p_src + i));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 3 + 0), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 0, 0)));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 3 + 4), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(2, 2, 1, 1)));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 3 + 8), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(3, 3, 3, 2)));
+        }
+        break;
+    case 4:
+        for (; i < num_vector_pixels; i += 4)
+        {
+            const __m128i pixels = _mm_loadu_si128((const __m128i*)(p_src + i));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 4 + 0), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 0, 0, 0)));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 4 + 4), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 1, 1, 1)));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 4 + 8), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(2, 2, 2, 2)));
+            _mm_storeu_si128((__m128i*)(p_dst + i * 4 + 12), _mm_shuffle_epi32(pixels, _MM_SHUFFLE(3, 3, 3, 3)));
+        }
+        break;
+    default:
+        break;
+    }
+
+    scale_argb_row_nearest_scalar(p_src + i, p_dst + i * scale, width - i, scale);
+}
+
+// p_dst는 (src_width * scale) x (src_height * scale), pitch == 너비
+static INLINE void scale_argb_nearest(const uint32_t* p_src, const size_t src_width, const size_t src_height,
+                                      uint32_t* p_dst, const int scale)
+{
+    ASSERT(p_src != NULL, "p_src == NULL");
+    ASSERT(p_dst != NULL, "p_dst == NULL");
+    ASSERT(scale >= 1, "scale < 1");
+
+    const size_t dst_width = src_width * scale;
+    const size_t dst_row_size = sizeof(uint32_t) * dst_width;
+
+    for (size_t y = 0; y < src_height; ++y)
+    {
+        uint32_t* p_dst_row = p_dst + y * scale * dst_width;
+        scale_argb_row_nearest_sse2(p_src + y * src_width, p_dst_row, src_width, scale);
+
+        for (int i = 1; i < scale; ++i)
+        {
+            memcpy(p_dst_row + i * dst_width, p_dst_row, dst_row_size);
+        }
+    }
+}
+
+END_EXTERN_C
+
+#endif // ARGB_SCALE_H
\ No newline at end of file
@@ -0,0 +1,687 @@
+﻿//***************************************************************************
+// 
+// 파일: headless_renderer.c
+// 
+// 설명: 윈도우 없이 메모리 프레임 버퍼에 그리는 렌더러
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+//***************************************************************************
+
+#include <stdio.h>
+#include <string.h>
+
+#include "safe99_math/color.h"
+#include "safe99_soft_renderer/argb_fill.h"
+#include "safe99_soft_renderer/headless_renderer.h"
+
+// 파일 이름 "<prefix>_000000.ppm"
+#define HEADLESS_RENDERER_MAX_FILENAME_LENGTH 260
+
+// stored deflate 블록 하나의 최대 바이트 수
+#define PNG_MAX_STORED_BLOCK_SIZE 65535
+
+typedef struct headless_renderer
+{
+    i_soft_renderer_t base;
+
+    size_t ref_count;
+
+    size_t width;
+    size_t height;
+    uint32_t* pa_buffer;
+
+    // 그리는 대상 (pa_buffer 또는 headless_renderer_set_target()으로 지정한 외부 버퍼)
+    uint32_t* p_buffer;
+
+    size_t num_frames;
+    const char* dump_prefix_or_null;
+
+    // PPM 한 행 (RGB)
+    uint8_t* pa_row;
+} headless_renderer_t;
+
+// IDAT 청크 하나에 zlib 스트림 전체를 쓰면서 CRC32와 Adler-32를 함께 계산
+typedef struct png_writer
+{
+    FILE* p_file;
+    bool b_ok;
+
+    uint32_t crc_table[256];
+    uint32_t crc;
+
+    uint32_t adler_a;
+    uint32_t adler_b;
+
+    // 현재 stored 블록에 남은 바이트 수, 아직 쓰지 않은 원본 바이트 수
+    size_t num_block_remaining;
+    size_t num_remaining;
+} png_writer_t;
+
+static size_t __stdcall renderer_add_ref(i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_release(i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_get_ref_count(const i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_get_width(const i_soft_renderer_t* p_this);
+static size_t __stdcall renderer_get_height(const i_soft_renderer_t* p_this);
+static void __stdcall renderer_update_window_size(i_soft_renderer_t* p_this);
+static bool __stdcall renderer_initialize(i_soft_renderer_t* p_this, HWND hwnd, const bool b_full_screen);
+static void __stdcall renderer_on_draw(const i_soft_renderer_t* p_this);
+static void __stdcall renderer_clear(i_soft_renderer_t* p_this, const color_t color);
+static void __stdcall renderer_draw_pixel(i_soft_renderer_t* p_this, const int x, const int y, const color_t color);
+static void __stdcall renderer_draw_horizontal_line(i_soft_renderer_t* p_this, const int y, const color_t color);
+static void __stdcall renderer_draw_vertical_line(i_soft_renderer_t* p_this, const int x, const color_t color);
+static void __stdcall renderer_draw_line(i_soft_renderer_t* p_this,
+                                         const int start_x, const int start_y,
+                                         const int end_x, const int end_y,
+                                         const color_t color);
+static void __stdcall renderer_draw_rectangle(i_soft_renderer_t* p_this,
+                                              const int x, const int y,
+                                              const size_t width, const size_t height,
+                                              const color_t color);
+static void __stdcall renderer_draw_bitmap(i_soft_renderer_t* p_this,
+                                           const int x, const int y,
+                                           const int sprite_x, const int sprite_y, const size_t sprite_width, const size_t sprite_height,
+                                           const uint32_t* p_bitmap, const size_t width, const size_t height);
+static void __stdcall renderer_draw_text(i_soft_renderer_t* p_this, const int x, const int y,
+                                         const wchar_t* text, const size_t length, const color_t color);
+static bool __stdcall renderer_clip_line(int* p_out_start_x, int* p_out_start_y,
+                                         int* p_out_end_x, int* p_out_end_y,
+                                         const rect_t* p_clip_window);
+static bool __stdcall renderer_create_vertex_buffer(const i_soft_renderer_t* p_this,
+                                                    const size_t* p_offsets, const semantic_t* p_semantics, const size_t num_semantics,
+                                                    const void* p_vertices, const size_t num_vertices,
+                                                    i_vertex_buffer_t** pp_out_vertex_buffer);
+static bool __stdcall renderer_create_index_buffer(const i_soft_renderer_t* p_this,
+                                                   const uint_t* p_indices, const size_t num_indices,
+                                                   i_index_buffer_t** pp_out_index_buffer);
+static bool __stdcall renderer_create_mesh(const i_soft_renderer_t* p_this,
+                                           i_vertex_buffer_t* p_vertex_buffer,
+                                           i_index_buffer_t* p_index_buffer,
+                                           i_texture_t* p_texture_or_null,
+                                           const color_t wireframe_color,
+                                           i_mesh_t** pp_out_mesh);
+static void __stdcall renderer_draw_mesh(i_soft_renderer_t* p_this,
+                                         const i_mesh_t* p_mesh, const matrix_t* p_transform_mat, const bool b_wireframe);
+
+static void png_write_chunk_begin(png_writer_t* p_writer, const char* type, const size_t size);
+static void png_write_chunk_end(png_writer_t* p_writer);
+static void png_write_bytes(png_writer_t* p_writer, const void* p_bytes, const size_t size);
+static void png_write_u32(png_writer_t* p_writer, const uint32_t value);
+static void png_write_deflate(png_writer_t* p_writer, const uint8_t* p_bytes, size_t size);
+
+
+static i_soft_renderer_vtbl_t s_renderer_vtbl =
+{
+    renderer_add_ref,
+    renderer_release,
+    renderer_get_ref_count,
+    renderer_get_width,
+    renderer_get_height,
+    renderer_update_window_size,
+    renderer_initialize,
+    renderer_on_draw,
+    renderer_clear,
+    renderer_draw_pixel,
+    renderer_draw_horizontal_line,
+    renderer_draw_vertical_line,
+    renderer_draw_line,
+    renderer_draw_rectangle,
+    renderer_draw_bitmap,
+    renderer_draw_text,
+    renderer_clip_line,
+    renderer_create_vertex_buffer,
+    renderer_create_index_buffer,
+    renderer_create_mesh,
+    renderer_draw_mesh,
+    renderer_draw_mesh
+};
+
+bool create_headless_renderer(const size_t width, const size_t height, i_soft_renderer_t** pp_out_renderer)
+{
+    ASSERT(width > 0, "width == 0");
+    ASSERT(height > 0, "height == 0");
+    ASSERT(pp_out_renderer != NULL, "pp_out_renderer == NULL");
+
+    headless_renderer_t* p_renderer = (headless_renderer_t*)malloc(sizeof(headless_renderer_t));
+    if (p_renderer == NULL)
+    {
+        ASSERT(false, "Failed to malloc renderer");
+        return false;
+    }
+
+    memset(p_renderer, 0, sizeof(headless_renderer_t));
+
+    p_renderer->pa_buffer = (uint32_t*)malloc(sizeof(uint32_t) * width * height);
+    p_renderer->pa_row = (uint8_t*)malloc(3 * width);
+    if (p_renderer->pa_buffer == NULL || p_renderer->pa_row == NULL)
+    {
+        ASSERT(false, "Failed to malloc frame buffer");
+        SAFE_FREE(p_renderer->pa_row);
+        SAFE_FREE(p_renderer->pa_buffer);
+        free(p_renderer);
+        return false;
+    }
+
+    p_renderer->base.vtbl = &s_renderer_vtbl;
+    p_renderer->ref_count = 1;
+    p_renderer->width = width;
+    p_renderer->height = height;
+    p_renderer->p_buffer = p_renderer->pa_buffer;
+
+    // 첫 clear() 전에 저장해도 실행마다 같은 이미지가 나오도록
+    fill_argb(p_renderer->pa_buffer, width * height, 0xff000000);
+
+    *pp_out_renderer = &p_renderer->base;
+    return true;
+}
+
+const uint32_t* headless_renderer_get_buffer(const i_soft_renderer_t* p_renderer)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+    return ((const headless_renderer_t*)p_renderer)->p_buffer;
+}
+
+size_t headless_renderer_get_num_frames(const i_soft_renderer_t* p_renderer)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+    return ((const headless_renderer_t*)p_renderer)->num_frames;
+}
+
+void headless_renderer_set_target(i_soft_renderer_t* p_renderer, uint32_t* p_target_or_null)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+
+    headless_renderer_t* p_headless_renderer = (headless_renderer_t*)p_renderer;
+    p_headless_renderer->p_buffer = (p_target_or_null != NULL) ? p_target_or_null : p_headless_renderer->pa_buffer;
+}
+
+void headless_renderer_set_frame_dump(i_soft_renderer_t* p_renderer, const char* prefix_or_null)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+    ((headless_renderer_t*)p_renderer)->dump_prefix_or_null = prefix_or_null;
+}
+
+bool headless_renderer_write_ppm(const i_soft_renderer_t* p_renderer, const char* filename)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+    ASSERT(filename != NULL, "filename == NULL");
+
+    const headless_renderer_t* p_headless_renderer = (const headless_renderer_t*)p_renderer;
+    const size_t width = p_headless_renderer->width;
+    const size_t height = p_headless_renderer->height;
+
+    FILE* p_file = fopen(filename, "wb");
+    if (p_file == NULL)
+    {
+        return false;
+    }
+
+    bool b_result = (fprintf(p_file, "P6\n%zu %zu\n255\n", width, height) > 0);
+
+    // 행 단위로 RGB 변환 후 쓰기
+    uint8_t* p_row = p_headless_renderer->pa_row;
+    for (size_t y = 0; y < height && b_result; ++y)
+    {
+        const uint32_t* p_pixels = p_headless_renderer->p_buffer + y * width;
+        for (size_t x = 0; x < width; ++x)
+        {
+            p_row[x * 3 + 0] = (uint8_t)(p_pixels[x] >> 16);
+            p_row[x * 3 + 1] = (uint8_t)(p_pixels[x] >> 8);
+            p_row[x * 3 + 2] = (uint8_t)p_pixels[x];
+        }
+
+        b_result = (fwrite(p_row, 3, width, p_file) == width);
+    }
+
+    fclose(p_file);
+    return b_result;
+}
+
+bool headless_renderer_write_png(const i_soft_renderer_t* p_renderer, const char* filename)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+    ASSERT(filename != NULL, "filename == NULL");
+
+    const headless_renderer_t* p_headless_renderer = (const headless_renderer_t*)p_renderer;
+    const size_t width = p_headless_renderer->width;
+    const size_t height = p_headless_renderer->height;
+
+    // 행마다 필터 바이트 (0, 필터 없음) + RGB
+    const size_t num_raw_bytes = height * (1 + width * 3);
+    const size_t num_blocks = (num_raw_bytes + PNG_MAX_STORED_BLOCK_SIZE - 1) / PNG_MAX_STORED_BLOCK_SIZE;
+
+    // zlib 헤더 2 + 블록마다 헤더 5 + 원본 + Adler-32 4
+    const size_t num_idat_bytes = 2 + num_blocks * 5 + num_raw_bytes + 4;
+    if (width > UINT32_MAX || height > UINT32_MAX || num_idat_bytes > UINT32_MAX)
+    {
+        return false;
+    }
+
+    png_writer_t writer;
+    writer.p_file = fopen(filename, "wb");
+    if (writer.p_file == NULL)
+    {
+        return false;
+    }
+    writer.b_ok = true;
+
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+        uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc & 1) ? 0xedb88320u ^ (crc >> 1) : crc >> 1;
+        }
+        writer.crc_table[i] = crc;
+    }
+
+    static const uint8_t s_signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    png_write_bytes(&writer, s_signature, sizeof(s_signature));
+
+    // IHDR: 너비, 높이, 8비트, 색 타입 2 (RGB), 압축/필터/인터레이스 0
+    static const uint8_t s_ihdr_tail[5] = { 8, 2, 0, 0, 0 };
+    png_write_chunk_begin(&writer, "IHDR", 13);
+    png_write_u32(&writer, (uint32_t)width);
+    png_write_u32(&writer, (uint32_t)height);
+    png_write_bytes(&writer, s_ihdr_tail, sizeof(s_ihdr_tail));
+    png_write_chunk_end(&writer);
+
+    // IDAT: zlib 헤더 (deflate, 32K 창, 압축 없음)
+    static const uint8_t s_zlib_header[2] = { 0x78, 0x01 };
+    png_write_chunk_begin(&writer, "IDAT", num_idat_bytes);
+    png_write_bytes(&writer, s_zlib_header, sizeof(s_zlib_header));
+
+    writer.adler_a = 1;
+    writer.adler_b = 0;
+    writer.num_block_remaining = 0;
+    writer.num_remaining = num_raw_bytes;
+
+    uint8_t* p_row = p_headless_renderer->pa_row;
+    for (size_t y = 0; y < height && writer.b_ok; ++y)
+    {
+        const uint32_t* p_pixels = p_headless_renderer->p_buffer + y * width;
+        for (size_t x = 0; x < width; ++x)
+        {
+            p_row[x * 3 + 0] = (uint8_t)(p_pixels[x] >> 16);
+            p_row[x * 3 + 1] = (uint8_t)(p_pixels[x] >> 8);
+            p_row[x * 3 + 2] = (uint8_t)p_pixels[x];
+        }
+
+        static const uint8_t s_filter_none = 0;
+        png_write_deflate(&writer, &s_filter_none, 1);
+        png_write_deflate(&writer, p_row, width * 3);
+    }
+
+    png_write_u32(&writer, (writer.adler_b << 16) | writer.adler_a);
+    png_write_chunk_end(&writer);
+
+    png_write_chunk_begin(&writer, "IEND", 0);
+    png_write_chunk_end(&writer);
+
+    const bool b_result = writer.b_ok;
+    fclose(writer.p_file);
+    return b_result;
+}
+
+uint64_t headless_renderer_hash_frame(const i_soft_renderer_t* p_renderer)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+
+    const headless_renderer_t* p_headless_renderer = (const headless_renderer_t*)p_renderer;
+    const size_t num_pixels = p_headless_renderer->width * p_headless_renderer->height;
+
+    // FNV-1a 64, 픽셀 단위
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (size_t i = 0; i < num_pixels; ++i)
+    {
+        hash ^= p_headless_renderer->p_buffer[i] & 0x00ffffff;
+        hash *= 0x100000001b3ull;
+    }
+
+    return hash;
+}
+
+void headless_renderer_clear_argb(i_soft_renderer_t* p_renderer, const uint32_t argb)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+
+    headless_renderer_t* p_headless_renderer = (headless_renderer_t*)p_renderer;
+    fill_argb(p_headless_renderer->p_buffer, p_headless_renderer->width * p_headless_renderer->height, argb);
+}
+
+void headless_renderer_fill_rect_argb(i_soft_renderer_t* p_renderer,
+                                      const int x, const int y, const size_t width, const size_t height,
+                                      const uint32_t argb)
+{
+    ASSERT(p_renderer != NULL, "p_renderer == NULL");
+
+    headless_renderer_t* p_headless_renderer = (headless_renderer_t*)p_renderer;
+    fill_rect_argb(p_headless_renderer->p_buffer, p_headless_renderer->width, p_headless_renderer->height,
+                   x, y, width, height, argb);
+}
+
+static size_t __stdcall renderer_add_ref(i_soft_renderer_t* p_this)
+{
+    headless_renderer_t* p_renderer = (headless_renderer_t*)p_this;
+    return ++p_renderer->ref_count;
+}
+
+static size_t __stdcall renderer_release(i_soft_renderer_t* p_this)
+{
+    headless_renderer_t* p_renderer = (headless_renderer_t*)p_this;
+    if (--p_renderer->ref_count == 0)
+    {
+        SAFE_FREE(p_renderer->pa_row);
+        SAFE_FREE(p_renderer->pa_buffer);
+        free(p_renderer);
+        return 0;
+    }
+
+    return p_renderer->ref_count;
+}
+
+static size_t __stdcall renderer_get_ref_count(const i_soft_renderer_t* p_this)
+{
+    return ((const headless_renderer_t*)p_this)->ref_count;
+}
+
+static size_t __stdcall renderer_get_width(const i_soft_renderer_t* p_this)
+{
+    return ((const headless_renderer_t*)p_this)->width;
+}
+
+static size_t __stdcall renderer_get_height(const i_soft_renderer_t* p_this)
+{
+    return ((const headless_renderer_t*)p_this)->height;
+}
+
+static void __stdcall renderer_update_window_size(i_soft_renderer_t* p_this)
+{
+    (void)p_this;
+}
+
+static bool __stdcall renderer_initialize(i_soft_renderer_t* p_this, HWND hwnd, const bool b_full_screen)
+{
+    (void)p_this;
+    (void)hwnd;
+    (void)b_full_screen;
+
+    return true;
+}
+
+// 화면이 없으므로 프레임 수만 세고 설정한 경우 파일로 저장
+static void __stdcall renderer_on_draw(const i_soft_renderer_t* p_this)
+{
+    // vtbl 시그니처가 const이지만 렌더러는 항상 create_headless_renderer()에서 할당한 객체
+    headless_renderer_t* p_renderer = (headless_renderer_t*)p_this;
+
+    if (p_renderer->dump_prefix_or_null != NULL)
+    {
+        char filename[HEADLESS_RENDERER_MAX_FILENAME_LENGTH];
+        snprintf(filename, sizeof(filename), "%s_%06zu.ppm", p_renderer->dump_prefix_or_null, p_renderer->num_frames);
+        if (!headless_renderer_write_ppm(p_this, filename))
+        {
+            ASSERT(false, "Failed to write frame");
+        }
+    }
+
+    ++p_renderer->num_frames;
+}
+
+static void __stdcall renderer_clear(i_soft_renderer_t* p_this, const color_t color)
+{
+    headless_renderer_clear_argb(p_this, color_to_argb(color));
+}
+
+static void __stdcall renderer_draw_pixel(i_soft_renderer_t* p_this, const int x, const int y, const color_t color)
+{
+    headless_renderer_t* p_renderer = (headless_renderer_t*)p_this;
+    if (x < 0 || x >= (int)p_renderer->width || y < 0 || y >= (int)p_renderer->height)
+    {
+        return;
+    }
+
+    p_renderer->p_buffer[y * p_renderer->width + x] = color_to_argb(color);
+}
+
+static void __stdcall renderer_draw_horizontal_line(i_soft_renderer_t* p_this, const int y, const color_t color)
+{
+    headless_renderer_t* p_renderer = (headless_renderer_t*)p_this;
+    for (int x = 0; x < (int)p_renderer->width; ++x)
+    {
+        renderer_draw_pixel(p_this, x, y, color);
+    }
+}
+
+static void __stdcall renderer_draw_vertical_line(i_soft_renderer_t* p_this, const int x, const color_t color)
+{
+    headless_renderer_t* p_renderer = (headless_renderer_t*)p_this;
+    for (int y = 0; y < (int)p_renderer->height; ++y)
+    {
+        renderer_draw_pixel(p_this, x, y, color);
+    }
+}
+
+static void __stdcall renderer_draw_line(i_soft_renderer_t* p_this,
+                                         const int start_x, const int start_y,
+                                         const int end_x, const int end_y,
+                                         const color_t color)
+{
+    // Bresenham
+    const int dx = ABS(end_x - start_x);
+    const int dy = -ABS(end_y - start_y);
+    const int step_x = (start_x < end_x) ? 1 : -1;
+    const int step_y = (start_y < end_y) ? 1 : -1;
+    int error = dx + dy;
+    int x = start_x;
+    int y = start_y;
+
+    while (true)
+    {
+        renderer_draw_pixel(p_this, x, y, color);
+        if (x == end_x && y == end_y)
+        {
+            break;
+        }
+
+        const int error2 = error * 2;
+        if (error2 >= dy)
+        {
+            error += dy;
+            x += step_x;
+        }
+        if (error2 <= dx)
+        {
+            error += dx;
+            y += step_y;
+        }
+    }
+}
+
+static void __stdcall renderer_draw_rectangle(i_soft_renderer_t* p_this,
+                                              const int x, const int y,
+                                              const size_t width, const size_t height,
+                                              const color_t color)
+{
+    headless_renderer_fill_rect_argb(p_this, x, y, width, height, color_to_argb(color));
+}
+
+static void __stdcall renderer_draw_bitmap(i_soft_renderer_t* p_this,
+                                           const int x, const int y,
+                                           const int sprite_x, const int sprite_y, const size_t sprite_width, const size_t sprite_height,
+                                           const uint32_t* p_bitmap, const size_t width, const size_t height)
+{
+    headless_renderer_t* p_renderer = (headless_renderer_t*)p_this;
+
+    // 화면과 비트맵 범위로 한 번만 자름
+    const int start_i = MAX(0, MAX(-y, -sprite_y));
+    const int start_j = MAX(0, MAX(-x, -sprite_x));
+    const int end_i = MIN((int)sprite_height, MIN((int)p_renderer->height - y, (int)height - sprite_y));
+    const int end_j = MIN((int)sprite_width, MIN((int)p_renderer->width - x, (int)width - sprite_x));
+
+    for (int i = start_i; i < end_i; ++i)
+    {
+        const uint32_t* p_src = p_bitmap + (size_t)(sprite_y + i) * width + sprite_x;
+        uint32_t* p_dst = p_renderer->p_buffer + (size_t)(y + i) * p_renderer->width + x;
+
+        for (int j = start_j; j < end_j; ++j)
+        {
+            // 알파가 0이면 투명
+            const uint32_t pixel = p_src[j];
+            if ((pixel & 0xff000000) != 0)
+            {
+                p_dst[j] = pixel;
+            }
+        }
+    }
+}
+
+// GDI 없음
+static void __stdcall renderer_draw_text(i_soft_renderer_t* p_this, const int x, const int y,
+                                         const wchar_t* text, const size_t length, const color_t color)
+{
+    (void)p_this;
+    (void)x;
+    (void)y;
+    (void)text;
+    (void)length;
+    (void)color;
+}
+
+static bool __stdcall renderer_clip_line(int* p_out_start_x, int* p_out_start_y,
+                                         int* p_out_end_x, int* p_out_end_y,
+                                         const rect_t* p_clip_window)
+{
+    (void)p_out_start_x;
+    (void)p_out_start_y;
+    (void)p_out_end_x;
+    (void)p_out_end_y;
+    (void)p_clip_window;
+
+    return true;
+}
+
+static bool __stdcall renderer_create_vertex_buffer(const i_soft_renderer_t* p_this,
+                                                    const size_t* p_offsets, const semantic_t* p_semantics, const size_t num_semantics,
+                                                    const void* p_vertices, const size_t num_vertices,
+                                                    i_vertex_buffer_t** pp_out_vertex_buffer)
+{
+    (void)p_this;
+    (void)p_offsets;
+    (void)p_semantics;
+    (void)num_semantics;
+    (void)p_vertices;
+    (void)num_vertices;
+    (void)pp_out_vertex_buffer;
+
+    return false;
+}
+
+static bool __stdcall renderer_create_index_buffer(const i_soft_renderer_t* p_this,
+                                                   const uint_t* p_indices, const size_t num_indices,
+                                                   i_index_buffer_t** pp_out_index_buffer)
+{
+    (void)p_this;
+    (void)p_indices;
+    (void)num_indices;
+    (void)pp_out_index_buffer;
+
+    return false;
+}
+
+static bool __stdcall renderer_create_mesh(const i_soft_renderer_t* p_this,
+                                           i_vertex_buffer_t* p_vertex_buffer,
+                                           i_index_buffer_t* p_index_buffer,
+                                           i_texture_t* p_texture_or_null,
+                                           const color_t wireframe_color,
+                                           i_mesh_t** pp_out_mesh)
+{
+    (void)p_this;
+    (void)p_vertex_buffer;
+    (void)p_index_buffer;
+    (void)p_texture_or_null;
+    (void)wireframe_color;
+    (void)pp_out_mesh;
+
+    return false;
+}
+
+static void __stdcall renderer_draw_mesh(i_soft_renderer_t* p_this,
+                                         const i_mesh_t* p_mesh, const matrix_t* p_transform_mat, const bool b_wireframe)
+{
+    (void)p_this;
+    (void)p_mesh;
+    (void)p_transform_mat;
+    (void)b_wireframe;
+}
+
+// size는 청크 데이터 크기, CRC는 타입부터 계산
+static void png_write_chunk_begin(png_writer_t* p_writer, const char* type, const size_t size)
+{
+    png_write_u32(p_writer, (uint32_t)size);
+    p_writer->crc = 0xffffffffu;
+    png_write_bytes(p_writer, type, 4);
+}
+
+static void png_write_chunk_end(png_writer_t* p_writer)
+{
+    const uint32_t crc = p_writer->crc ^ 0xffffffffu;
+    png_write_u32(p_writer, crc);
+}
+
+static void png_write_bytes(png_writer_t* p_writer, const void* p_bytes, const size_t size)
+{
+    const uint8_t* p = (const uint8_t*)p_bytes;
+    for (size_t i = 0; i < size; ++i)
+    {
+        p_writer->crc = p_writer->crc_table[(p_writer->crc ^ p[i]) & 0xff] ^ (p_writer->crc >> 8);
+    }
+
+    p_writer->b_ok = p_writer->b_ok && (fwrite(p_bytes, 1, size, p_writer->p_file) == size);
+}
+
+// 빅 엔디언
+static void png_write_u32(png_writer_t* p_writer, const uint32_t value)
+{
+    const uint8_t bytes[4] = { (uint8_t)(value >> 24), (uint8_t)(value >> 16), (uint8_t)(value >> 8), (uint8_t)value };
+    png_write_bytes(p_writer, bytes, sizeof(bytes));
+}
+
+// 원본 바이트를 stored 블록으로 나눠 쓰고 Adler-32 갱신
+static void png_write_deflate(png_writer_t* p_writer, const uint8_t* p_bytes, size_t size)
+{
+    ASSERT(size <= p_writer->num_remaining, "too many bytes");
+
+    while (size > 0)
+    {
+        if (p_writer->num_block_remaining == 0)
+        {
+            // 블록 헤더: BFINAL, BTYPE 00 (바이트 경계로 맞춤), LEN, NLEN (리틀 엔디언)
+            const size_t block_size = MIN(p_writer->num_remaining, (size_t)PNG_MAX_STORED_BLOCK_SIZE);
+            const uint8_t b_final = (block_size == p_writer->num_remaining) ? 1 : 0;
+            const uint8_t header[5] =
+            {
+                b_final,
+                (uint8_t)block_size, (uint8_t)(block_size >> 8),
+                (uint8_t)~block_size, (uint8_t)(~block_size >> 8)
+            };
+            png_write_bytes(p_writer, header, sizeof(header));
+            p_writer->num_block_remaining = block_size;
+        }
+
+        const size_t num_bytes = MIN(size, p_writer->num_block_remaining);
+        for (size_t i = 0; i < num_bytes; ++i)
+        {
+            p_writer->adler_a = (p_writer->adler_a + p_bytes[i]) % 65521;
+            p_writer->adler_b = (p_writer->adler_b + p_writer->adler_a) % 65521;
+        }
+        png_write_bytes(p_writer, p_bytes, num_bytes);
+
+        p_writer->num_block_remaining -= num_bytes;
+        p_writer->num_remaining -= num_bytes;
+        p_bytes += num_bytes;
+        size -= num_bytes;
+    }
+}
\ No newline at end of file
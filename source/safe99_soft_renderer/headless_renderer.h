@@ -0,0 +1,63 @@
+﻿//***************************************************************************
+// 
+// 파일: headless_renderer.h
+// 
+// 설명: 윈도우 없이 메모리 프레임 버퍼에 그리는 렌더러
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// i_soft_renderer_t를 그대로 구현하므로 draw_game() 등 게임 코드를 바꾸지 않고 사용
+// - initialize()의 hwnd는 무시, on_draw()는 화면 대신 (설정한 경우) PPM 파일로 저장
+// - GDI가 없으므로 draw_text()는 아무것도 그리지 않음 (오버레이는 bitmap_font 사용)
+//   GDI 텍스트가 들어간 프레임은 창 렌더러와 다르게 나오므로 골든 이미지로 비교하지 않음
+// - 3D 메시 함수는 지원하지 않음 (생성 함수는 false)
+// Windows.h 없이 빌드되므로 리눅스 CI에서 벤치마크와 골든 이미지 비교에 사용
+// 
+//***************************************************************************
+
+#ifndef HEADLESS_RENDERER_H
+#define HEADLESS_RENDERER_H
+
+#include "safe99_common/defines.h"
+#include "safe99_soft_renderer/i_soft_renderer.h"
+
+START_EXTERN_C
+
+bool create_headless_renderer(const size_t width, const size_t height, i_soft_renderer_t** pp_out_renderer);
+
+// 아래 함수는 create_headless_renderer()로 만든 렌더러에만 사용
+
+// 현재 그리는 대상, ARGB, pitch == 너비
+const uint32_t* headless_renderer_get_buffer(const i_soft_renderer_t* p_renderer);
+
+// 외부 버퍼에 바로 그림 (너비 x 높이 이상, 복사 없이 캡처 슬롯 등에 그릴 때), NULL이면 자체 버퍼로 돌아감
+void headless_renderer_set_target(i_soft_renderer_t* p_renderer, uint32_t* p_target_or_null);
+
+// on_draw() 호출 횟수
+size_t headless_renderer_get_num_frames(const i_soft_renderer_t* p_renderer);
+
+// NULL이 아니면 on_draw()마다 "<prefix>_<프레임 번호 6자리>.ppm"으로 저장, prefix는 렌더러보다 오래 살아야 함
+void headless_renderer_set_frame_dump(i_soft_renderer_t* p_renderer, const char* prefix_or_null);
+
+// 바이너리 PPM (P6), 알파는 버림
+bool headless_renderer_write_ppm(const i_soft_renderer_t* p_renderer, const char* filename);
+
+// 8비트 RGB PNG, 알파는 버림
+// zlib 없이 쓰므로 압축하지 않은 deflate 블록 (stored)을 사용, 크기는 PPM과 비슷하지만 일반 이미지 뷰어와 diff 도구로 열 수 있음
+bool headless_renderer_write_png(const i_soft_renderer_t* p_renderer, const char* filename);
+
+// 프레임 버퍼 RGB 해시 (알파 제외), 골든 이미지 대신 해시만 비교할 때
+uint64_t headless_renderer_hash_frame(const i_soft_renderer_t* p_renderer);
+
+// 정수 색상으로 채움 (vtbl은 DLL과 같게 유지해야 하므로 별도 함수)
+// clear(), draw_rectangle()도 색을 한 번 변환한 뒤 이 함수를 사용
+void headless_renderer_clear_argb(i_soft_renderer_t* p_renderer, const uint32_t argb);
+void headless_renderer_fill_rect_argb(i_soft_renderer_t* p_renderer,
+                                      const int x, const int y, const size_t width, const size_t height,
+                                      const uint32_t argb);
+
+END_EXTERN_C
+
+#endif // HEADLESS_RENDERER_H
\ No newline at end of file
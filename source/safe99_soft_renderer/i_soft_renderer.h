@@ -13,7 +13,12 @@
 #ifndef I_SOFT_RENDERER_H
 #define I_SOFT_RENDERER_H
 
+#if defined(_WIN32)
 #include <Windows.h>
+#else
+// 헤드리스 렌더러 (headless_renderer.h)를 윈도우 없이 빌드할 때, initialize()의 hwnd는 사용하지 않음
+typedef void* HWND;
+#endif // _WIN32
 
 #include "safe99_common/defines.h"
 
@@ -0,0 +1,133 @@
+﻿//***************************************************************************
+// 
+// 파일: palette_expand.h
+// 
+// 설명: 8비트 팔레트 인덱스 -> ARGB 확장
+// 
+// 작성자: bumpsgoodman
+// 
+// 작성일: 2026/10/19
+// 
+// 팔레트는 최대 16색, 인덱스는 0 ~ 15
+// SSSE3 경로는 palette_set_colors()가 나눠 둔 바이트 평면 4개(B, G, R, A)에서
+// pshufb 4번으로 16픽셀의 각 바이트를 찾은 뒤 unpack으로 ARGB로 합침
+// SSSE3는 실행 시간에 확인하므로 SSE2만 켜고 빌드해도 사용됨
+// 
+//***************************************************************************
+
+#ifndef PALETTE_EXPAND_H
+#define PALETTE_EXPAND_H
+
+#include "safe99_common/defines.h"
+
+#define PALETTE_NUM_MAX_COLORS 16
+
+ALIGN16 typedef struct palette
+{
+    // 바이트 평면 (planes[k][i] = colors[i]의 k번째 바이트, B, G, R, A 순)
+    uint8_t planes[4][PALETTE_NUM_MAX_COLORS];
+    uint32_t colors[PALETTE_NUM_MAX_COLORS];
+} palette_t;
+
+START_EXTERN_C
+
+// 남는 칸은 colors[0]으로 채움
+FORCEINLINE void palette_set_colors(palette_t* p_palette, const uint32_t* p_colors, const size_t num_colors)
+{
+    ASSERT(p_palette != NULL, "p_palette == NULL");
+    ASSERT(p_colors != NULL, "p_colors == NULL");
+    ASSERT(num_colors > 0 && num_colors <= PALETTE_NUM_MAX_COLORS, "invalid num_colors");
+
+    for (size_t i = 0; i < PALETTE_NUM_MAX_COLORS; ++i)
+    {
+        const uint32_t color = (i < num_colors) ? p_colors[i] : p_colors[0];
+
+        p_palette->colors[i] = color;
+        p_palette->planes[0][i] = (uint8_t)(color);
+        p_palette->planes[1][i] = (uint8_t)(color >> 8);
+        p_palette->planes[2][i] = (uint8_t)(color >> 16);
+        p_palette->planes[3][i] = (uint8_t)(color >> 24);
+    }
+}
+
+FORCEINLINE void palette_expand_scalar(const palette_t* p_palette, const uint8_t* p_indices, uint32_t* p_dst, const size_t count)
+{
+    ASSERT(p_palette != NULL, "p_palette == NULL");
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        ASSERT(p_indices[i] < PALETTE_NUM_MAX_COLORS, "invalid index");
+        p_dst[i] = p_palette->colors[p_indices[i]];
+    }
+}
+
+// CPU가 SSSE3를 지원하는지 확인한 뒤에만 호출
+static INLINE TARGET_SSSE3 void palette_expand_ssse3(const palette_t* p_palette, const uint8_t* p_indices, uint32_t* p_dst, const size_t count)
+{
+    ASSERT(p_palette != NULL, "p_palette == NULL");
+
+    const __m128i blue_lut = _mm_load_si128((const __m128i*)p_palette->planes[0]);
+    const __m128i green_lut = _mm_load_si128((const __m128i*)p_palette->planes[1]);
+    const __m128i red_lut = _mm_load_si128((const __m128i*)p_palette->planes[2]);
+    const __m128i alpha_lut = _mm_load_si128((const __m128i*)p_palette->planes[3]);
+
+    const size_t num_vector_pixels = count & ~(size_t)15;
+
+    size_t i = 0;
+    for (; i < num_vector_pixels; i += 16)
+    {
+        const __m128i indices = _mm_loadu_si128((const __m128i*)(p_indices + i));
+
+        const __m128i blue = _mm_shuffle_epi8(blue_lut, indices);
+        const __m128i green = _mm_shuffle_epi8(green_lut, indices);
+        const __m128i red = _mm_shuffle_epi8(red_lut, indices);
+        const __m128i alpha = _mm_shuffle_epi8(alpha_lut, indices);
+
+        // (B, G), (R, A) 쌍 -> 리틀 엔디안 ARGB
+        const __m128i bg_lo = _mm_unpacklo_epi8(blue, green);
+        const __m128i bg_hi = _mm_unpackhi_epi8(blue, green);
+        const __m128i ra_lo = _mm_unpacklo_epi8(red, alpha);
+        const __m128i ra_hi = _mm_unpackhi_epi8(red, alpha);
+
+        _mm_storeu_si128((__m128i*)(p_dst + i + 0), _mm_unpacklo_epi16(bg_lo, ra_lo));
+        _mm_storeu_si128((__m128i*)(p_dst + i + 4), _mm_unpackhi_epi16(bg_lo, ra_lo));
+        _mm_storeu_si128((__m128i*)(p_dst + i + 8), _mm_unpacklo_epi16(bg_hi, ra_hi));
+        _mm_storeu_si128((__m128i*)(p_dst + i + 12), _mm_unpackhi_epi16(bg_hi, ra_hi));
+    }
+
+    palette_expand_scalar(p_palette, p_indices + i, p_dst + i, count - i);
+}
+
+static INLINE bool palette_is_ssse3_supported(void)
+{
+#if defined(_MSC_VER)
+    int cpu_info[4];
+    __cpuid(cpu_info, 1);
+    return (cpu_info[2] & (1 << 9)) != 0;
+#else
+    return __builtin_cpu_supports("ssse3") != 0;
+#endif // _MSC_VER
+}
+
+static INLINE void palette_expand(const palette_t* p_palette, const uint8_t* p_indices, uint32_t* p_dst, const size_t count)
+{
+    // 처음 호출할 때 한 번만 확인 (여러 스레드가 동시에 써도 같은 값)
+    static int s_ssse3_supported = -1;
+    if (s_ssse3_supported < 0)
+    {
+        s_ssse3_supported = palette_is_ssse3_supported() ? 1 : 0;
+    }
+
+    if (s_ssse3_supported)
+    {
+        palette_expand_ssse3(p_palette, p_indices, p_dst, count);
+    }
+    else
+    {
+        palette_expand_scalar(p_palette, p_indices, p_dst, count);
+    }
+}
+
+END_EXTERN_C
+
+#endif // PALETTE_EXPAND_H
\ No newline at end of file